@@ -420,6 +420,7 @@ extern bg96_shared_variables_t bg96_shared;
   */
 void        ATCustom_BG96_init(atparser_context_t *p_atp_ctxt);
 uint8_t     ATCustom_BG96_checkEndOfMsgCallback(uint8_t rxChar);
+uint16_t    ATCustom_BG96_checkEndOfMsgSpanCallback(const uint8_t *p_span, uint16_t span_size);
 at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t ATCustom_BG96_extractElement(atparser_context_t *p_atp_ctxt,
                                          const IPC_RxMessage_t *p_msg_in,
@@ -436,6 +437,7 @@ at_status_t ATCustom_BG96_get_rsp(atparser_context_t *p_atp_ctxt, at_buf_t *p_rs
 at_status_t ATCustom_BG96_get_urc(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_BG96_get_error(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_BG96_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+uint8_t     *ATCustom_BG96_getRxDataBuffer(atparser_context_t *p_atp_ctxt, uint16_t *p_size);
 
 void ATC_BG96_modem_reset(atcustom_modem_context_t *p_modem_ctxt);
 void ATC_BG96_reset_variables(void);
@@ -62,6 +62,8 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   funcPtrs->f_get_urc = ATCustom_BG96_get_urc;
   funcPtrs->f_get_error = ATCustom_BG96_get_error;
   funcPtrs->f_hw_event = ATCustom_BG96_hw_event;
+  funcPtrs->f_getRxDataBuffer = ATCustom_BG96_getRxDataBuffer;
+  funcPtrs->f_checkEndOfMsgSpanCallback = ATCustom_BG96_checkEndOfMsgSpanCallback;
 #else
 #error AT custom does not match with selected modem
 #endif /* USE_MODEM_BG96 */
@@ -382,6 +382,7 @@ at_status_t fCmdBuild_QIRD_BG96(atparser_context_t *p_atp_ctxt, atcustom_modem_c
 
       /* ready to start receive socket buffer */
       p_modem_ctxt->socket_ctxt.socket_RxData_state = SocketRxDataState_waiting_header;
+      p_modem_ctxt->socket_ctxt.socket_rx_zero_copy = AT_FALSE;
     }
     else
     {
@@ -1259,11 +1260,17 @@ at_action_rsp_t fRspAnalyze_QIRD_data_BG96(at_context_t *p_at_ctxt, atcustom_mod
   PRINT_DBG("DATA received: size=%ld vs %d", p_modem_ctxt->socket_ctxt.socket_rx_expected_buf_size,
             element_infos->str_size)
 
+  if (p_modem_ctxt->socket_ctxt.socket_rx_zero_copy == AT_TRUE)
+  {
+    /* data have already been copied to client buffer (see ATCustom_BG96_getRxDataBuffer) */
+    p_modem_ctxt->socket_ctxt.socketReceivedata.buffer_size = element_infos->str_size;
+    p_modem_ctxt->socket_ctxt.socket_rx_zero_copy = AT_FALSE;
+  }
   /* Recopy data to client buffer if:
   *   - pointer on data buffer exists
   *   - and size of data <= maximum size
   */
-  if ((p_modem_ctxt->socket_ctxt.socketReceivedata.p_buffer_addr_rcv != NULL) &&
+  else if ((p_modem_ctxt->socket_ctxt.socketReceivedata.p_buffer_addr_rcv != NULL) &&
       (element_infos->str_size <= p_modem_ctxt->socket_ctxt.socketReceivedata.max_buffer_size))
   {
     /* recopy data to client buffer */
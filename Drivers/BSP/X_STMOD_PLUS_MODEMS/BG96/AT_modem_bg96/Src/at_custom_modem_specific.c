@@ -97,6 +97,10 @@
   * @{
   */
 static atcustom_modem_context_t BG96_ctxt;
+
+/* Socket Data receive: data header prefix detection (shared by end of message callbacks) */
+static const uint8_t QIRD_string[] = "+QIRD";
+static uint8_t QIRD_Counter = 0U;
 /**
   * @}
   */
@@ -269,12 +273,29 @@ void ATCustom_BG96_init(atparser_context_t *p_atp_ctxt)
   };
 #define SIZE_ATCMD_BG96_LUT ((uint16_t) (sizeof (ATCMD_BG96_LUT) / sizeof (atcustom_LUT_t)))
 
+  /* commands which can be concatenated on a single AT line (AT+CEREG?;+CREG?;+CGREG?):
+   * only queries with an answer prefixed by the command name and whose answer is not used to select
+   * the next command of the SID
+   */
+  static const uint32_t ATCMD_BG96_PIPELINE_LUT[] =
+  {
+    CMD_AT_CSQ,
+    CMD_AT_QCSQ,
+    CMD_AT_CEREG,
+    CMD_AT_CREG,
+    CMD_AT_CGREG,
+  };
+#define SIZE_ATCMD_BG96_PIPELINE_LUT ((uint16_t) (sizeof (ATCMD_BG96_PIPELINE_LUT) / sizeof (uint32_t)))
+
   /* common init */
   bg96_modem_init(&BG96_ctxt);
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
   BG96_ctxt.modem_LUT_size = SIZE_ATCMD_BG96_LUT;
   BG96_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_BG96_LUT;
+  atcm_build_LUT_index(&BG96_ctxt);
+  BG96_ctxt.pipeline_LUT_size = SIZE_ATCMD_BG96_PIPELINE_LUT;
+  BG96_ctxt.p_pipeline_LUT = ATCMD_BG96_PIPELINE_LUT;
 
   /* override default termination string for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -291,10 +312,6 @@ uint8_t ATCustom_BG96_checkEndOfMsgCallback(uint8_t rxChar)
 {
   uint8_t last_char = 0U;
 
-  /* static variables */
-  static const uint8_t QIRD_string[] = "+QIRD";
-  static uint8_t QIRD_Counter = 0U;
-
   /*---------------------------------------------------------------------------------------*/
   if (BG96_ctxt.state_SyntaxAutomaton == WAITING_FOR_INIT_CR)
   {
@@ -498,6 +515,91 @@ uint8_t ATCustom_BG96_checkEndOfMsgCallback(uint8_t rxChar)
   return (last_char);
 }
 
+/**
+  * @brief  Search end of message in a span of characters received from modem.
+  * @note   Same automaton as ATCustom_BG96_checkEndOfMsgCallback: the characters which can not
+  *         change its state (message body, socket data) are skipped by block,
+  *         other characters are analyzed one by one by ATCustom_BG96_checkEndOfMsgCallback.
+  * @param  p_span Ptr to the characters received from modem.
+  * @param  span_size Number of characters received.
+  * @retval uint16_t Returns the number of characters up to the end of message (included),
+  *         0 if the span does not contain an end of message.
+  */
+uint16_t ATCustom_BG96_checkEndOfMsgSpanCallback(const uint8_t *p_span, uint16_t span_size)
+{
+  uint16_t idx = 0U;
+  uint16_t msg_size = 0U;
+  atcustom_modem_SyntaxAutomatonState_t state;
+  atcustom_socket_RxData_state_t rx_data_state;
+
+  while ((idx < span_size) && (msg_size == 0U))
+  {
+    state = BG96_ctxt.state_SyntaxAutomaton;
+    rx_data_state = BG96_ctxt.socket_ctxt.socket_RxData_state;
+
+    /* characters are analyzed one by one when waiting for socket prompt */
+    if (BG96_ctxt.socket_ctxt.socket_send_state == SocketSendState_No_Activity)
+    {
+      if ((state == WAITING_FOR_SOCKET_DATA)
+          && (BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received < BG96_ctxt.socket_ctxt.socket_rx_expected_buf_size))
+      {
+        /* socket data: only count them */
+        uint32_t count = BG96_ctxt.socket_ctxt.socket_rx_expected_buf_size
+                         - BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+        if (count > ((uint32_t)span_size - idx))
+        {
+          count = (uint32_t)span_size - idx;
+        }
+        BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received += count;
+        idx += (uint16_t)count;
+        /* check if full buffer has been received */
+        if (BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received == BG96_ctxt.socket_ctxt.socket_rx_expected_buf_size)
+        {
+          BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_data_received;
+          BG96_ctxt.state_SyntaxAutomaton = WAITING_FOR_CR;
+        }
+      }
+      else if ((state == WAITING_FOR_INIT_CR) || (state == WAITING_FOR_CR)
+               || ((state == WAITING_FOR_FIRST_CHAR)
+                   && (rx_data_state != SocketRxDataState_waiting_header)
+                   && (rx_data_state != SocketRxDataState_receiving_header)
+                   && (rx_data_state != SocketRxDataState_receiving_data)))
+      {
+        /* only <CR> can change the automaton state: jump to it */
+        idx += ATutil_findChar(&p_span[idx], (span_size - idx), (uint8_t)'\r');
+      }
+      else if ((state == WAITING_FOR_FIRST_CHAR)
+               && (rx_data_state == SocketRxDataState_waiting_header)
+               && (QIRD_Counter == 0U)
+               && (ATutil_isPrefix(&p_span[idx], (span_size - idx), QIRD_string,
+                                   (uint16_t)(sizeof(QIRD_string) - 1U)) == 1U))
+      {
+        /* +QIRD detected, next step */
+        QIRD_Counter = (uint8_t)(sizeof(QIRD_string) - 1U);
+        socketHeaderRX_reset();
+        BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_receiving_header;
+        idx += (uint16_t)(sizeof(QIRD_string) - 1U);
+      }
+      else
+      {
+        /* nothing to skip */
+      }
+    }
+
+    /* analyze next character */
+    if (idx < span_size)
+    {
+      if (ATCustom_BG96_checkEndOfMsgCallback(p_span[idx]) == 1U)
+      {
+        msg_size = idx + 1U;
+      }
+      idx++;
+    }
+  }
+
+  return (msg_size);
+}
+
 /**
   * @brief  Returns the next AT command to send in the current context.
   * @param  p_at_ctxt Pointer to the structure of AT context.
@@ -612,20 +714,35 @@ at_endmsg_t ATCustom_BG96_extractElement(atparser_context_t *p_atp_ctxt,
     }
 
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-    exit_loop = false;
-    for (uint16_t idx = *p_parseIndex; (idx < (p_msg_in->size - 1U)) && (exit_loop == false); idx++)
+    if (BG96_ctxt.socket_ctxt.socket_rx_zero_copy == AT_TRUE)
     {
-      if ((p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_QIRD) &&
-          (BG96_ctxt.socket_ctxt.socket_receive_state == SocketRcvState_RequestData_Payload) &&
-          (BG96_ctxt.socket_ctxt.socket_RxData_state != SocketRxDataState_finished))
+      /* socket data payload has already been copied to client buffer by IPC,
+       * p_msg_in only contains the end of the message (<CR><LF>)
+       */
+      PRINT_DBG("socket data received in client buffer (real size=%d)", SocketHeaderRX_getSize())
+      element_infos->str_start_idx = 0U;
+      element_infos->str_end_idx = 0U;
+      element_infos->str_size = (uint16_t) BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+      BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_finished;
+      retval_msg_end_detected = ATENDMSG_YES;
+    }
+    else
+    {
+      exit_loop = false;
+      for (uint16_t idx = *p_parseIndex; (idx < (p_msg_in->size - 1U)) && (exit_loop == false); idx++)
       {
-        PRINT_DBG("receiving socket data (real size=%d)", SocketHeaderRX_getSize())
-        element_infos->str_start_idx = 0U;
-        element_infos->str_end_idx = (uint16_t) BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
-        element_infos->str_size = (uint16_t) BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
-        BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_finished;
-        retval_msg_end_detected = ATENDMSG_YES;
-        exit_loop = true;
+        if ((p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_QIRD) &&
+            (BG96_ctxt.socket_ctxt.socket_receive_state == SocketRcvState_RequestData_Payload) &&
+            (BG96_ctxt.socket_ctxt.socket_RxData_state != SocketRxDataState_finished))
+        {
+          PRINT_DBG("receiving socket data (real size=%d)", SocketHeaderRX_getSize())
+          element_infos->str_start_idx = 0U;
+          element_infos->str_end_idx = (uint16_t) BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+          element_infos->str_size = (uint16_t) BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+          BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_finished;
+          retval_msg_end_detected = ATENDMSG_YES;
+          exit_loop = true;
+        }
       }
     }
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
@@ -707,13 +824,29 @@ at_action_rsp_t ATCustom_BG96_analyzeCmd(at_context_t *p_at_ctxt,
 {
   atparser_context_t *p_atp_ctxt = &(p_at_ctxt->parser);
   at_action_rsp_t retval;
+  at_status_t lut_status;
 
   PRINT_API("enter ATCustom_BG96_analyzeCmd()")
 
   /* Analyze data received from the modem and
     * search in LUT the ID corresponding to command received
   */
-  if (ATSTATUS_OK != atcm_searchCmdInLUT(&BG96_ctxt, p_atp_ctxt, p_msg_in, element_infos))
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  if (BG96_ctxt.socket_ctxt.socket_rx_zero_copy == AT_TRUE)
+  {
+    /* socket data payload has been received directly in client buffer:
+     * no command name to search in the LUT, data are analyzed below (QIRD data part)
+     */
+    element_infos->cmd_id_received = CMD_AT_INVALID;
+    lut_status = ATSTATUS_ERROR;
+  }
+  else
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+  {
+    lut_status = atcm_searchCmdInLUT(&BG96_ctxt, p_atp_ctxt, p_msg_in, element_infos);
+  }
+
+  if (ATSTATUS_OK != lut_status)
   {
     /* No command corresponding to a LUT entry has been found.
      * May be we received a text line without command prefix.
@@ -1313,6 +1446,40 @@ at_status_t ATCustom_BG96_hw_event(sysctrl_device_type_t deviceType, at_hw_event
   return (retval);
 }
 
+/**
+  * @brief  Returns the client buffer where the next received message has to be copied directly.
+  * @note   When the socket data payload of +QIRD answer is the next message in IPC, the payload is
+  *         copied once from IPC to the buffer provided by the client in CDS_socket_receive().
+  * @param  p_atp_ctxt Pointer to the structure of Parser context.
+  * @param  p_size Pointer to the size of the data payload to copy in the client buffer.
+  * @retval uint8_t* Pointer to the client buffer, NULL if next message is not a socket data payload.
+  */
+uint8_t *ATCustom_BG96_getRxDataBuffer(atparser_context_t *p_atp_ctxt, uint16_t *p_size)
+{
+  uint8_t *p_buffer = NULL;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  /* socket data payload is fully received when socket_RxData_state = SocketRxDataState_data_received
+   * (updated by ATCustom_BG96_checkEndOfMsgCallback when the message is complete)
+   */
+  if ((p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_QIRD) &&
+      (BG96_ctxt.socket_ctxt.socket_receive_state == SocketRcvState_RequestData_Payload) &&
+      (BG96_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_data_received) &&
+      (BG96_ctxt.socket_ctxt.socketReceivedata.p_buffer_addr_rcv != NULL) &&
+      (BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received <= BG96_ctxt.socket_ctxt.socketReceivedata.max_buffer_size))
+  {
+    p_buffer = (uint8_t *) BG96_ctxt.socket_ctxt.socketReceivedata.p_buffer_addr_rcv;
+    *p_size = (uint16_t) BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+    BG96_ctxt.socket_ctxt.socket_rx_zero_copy = AT_TRUE;
+  }
+#else
+  UNUSED(p_atp_ctxt);
+  UNUSED(p_size);
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+
+  return (p_buffer);
+}
+
 /**
   * @brief  Global reset of modem parameters.
   * @param  p_modem_ctxt Pointer to the structure of Modem context.
@@ -186,6 +186,7 @@ extern monarch_shared_variables_t monarch_shared;
   */
 void        ATCustom_MONARCH_init(atparser_context_t *p_atp_ctxt);
 uint8_t     ATCustom_MONARCH_checkEndOfMsgCallback(uint8_t rxChar);
+uint16_t    ATCustom_MONARCH_checkEndOfMsgSpanCallback(const uint8_t *p_span, uint16_t span_size);
 at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t ATCustom_MONARCH_extractElement(atparser_context_t *p_atp_ctxt,
                                             const IPC_RxMessage_t *p_msg_in,
@@ -247,6 +247,7 @@ void ATCustom_MONARCH_init(atparser_context_t *p_atp_ctxt)
   /* ###########################  START CUSTOMIZATION PART  ########################### */
   SEQMONARCH_ctxt.modem_LUT_size = SIZE_ATCMD_SEQMONARCH_LUT;
   SEQMONARCH_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_SEQMONARCH_LUT;
+  atcm_build_LUT_index(&SEQMONARCH_ctxt);
 
   /* set default termination char for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -466,6 +467,80 @@ uint8_t ATCustom_MONARCH_checkEndOfMsgCallback(uint8_t rxChar)
   return (last_char);
 }
 
+/**
+  * @brief  Search end of message in a span of characters received from modem.
+  * @note   Same automaton as ATCustom_MONARCH_checkEndOfMsgCallback: the characters which can not
+  *         change its state (message body, socket data) are skipped by block,
+  *         other characters are analyzed one by one by ATCustom_MONARCH_checkEndOfMsgCallback.
+  * @param  p_span Ptr to the characters received from modem.
+  * @param  span_size Number of characters received.
+  * @retval uint16_t Returns the number of characters up to the end of message (included),
+  *         0 if the span does not contain an end of message.
+  */
+uint16_t ATCustom_MONARCH_checkEndOfMsgSpanCallback(const uint8_t *p_span, uint16_t span_size)
+{
+  uint16_t idx = 0U;
+  uint16_t msg_size = 0U;
+  atcustom_modem_SyntaxAutomatonState_t state;
+  atcustom_socket_RxData_state_t rx_data_state;
+
+  while ((idx < span_size) && (msg_size == 0U))
+  {
+    state = SEQMONARCH_ctxt.state_SyntaxAutomaton;
+    rx_data_state = SEQMONARCH_ctxt.socket_ctxt.socket_RxData_state;
+
+    /* characters are analyzed one by one when waiting for socket prompt */
+    if (SEQMONARCH_ctxt.socket_ctxt.socket_send_state == SocketSendState_No_Activity)
+    {
+      if ((state == WAITING_FOR_SOCKET_DATA)
+          && (SEQMONARCH_ctxt.socket_ctxt.socket_rx_count_bytes_received <
+              SEQMONARCH_ctxt.socket_ctxt.socket_rx_expected_buf_size))
+      {
+        /* socket data: only count them */
+        uint32_t count = SEQMONARCH_ctxt.socket_ctxt.socket_rx_expected_buf_size
+                         - SEQMONARCH_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+        if (count > ((uint32_t)span_size - idx))
+        {
+          count = (uint32_t)span_size - idx;
+        }
+        SEQMONARCH_ctxt.socket_ctxt.socket_rx_count_bytes_received += count;
+        idx += (uint16_t)count;
+        /* check if full buffer has been received */
+        if (SEQMONARCH_ctxt.socket_ctxt.socket_rx_count_bytes_received ==
+            SEQMONARCH_ctxt.socket_ctxt.socket_rx_expected_buf_size)
+        {
+          SEQMONARCH_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_data_received;
+          SEQMONARCH_ctxt.state_SyntaxAutomaton = WAITING_FOR_CR;
+        }
+      }
+      else if ((state == WAITING_FOR_INIT_CR) || (state == WAITING_FOR_CR)
+               || ((state == WAITING_FOR_FIRST_CHAR)
+                   && (rx_data_state != SocketRxDataState_receiving_header)
+                   && (rx_data_state != SocketRxDataState_receiving_data)))
+      {
+        /* only <CR> can change the automaton state: jump to it */
+        idx += ATutil_findChar(&p_span[idx], (span_size - idx), (uint8_t)'\r');
+      }
+      else
+      {
+        /* nothing to skip */
+      }
+    }
+
+    /* analyze next character */
+    if (idx < span_size)
+    {
+      if (ATCustom_MONARCH_checkEndOfMsgCallback(p_span[idx]) == 1U)
+      {
+        msg_size = idx + 1U;
+      }
+      idx++;
+    }
+  }
+
+  return (msg_size);
+}
+
 /**
   * @brief  Returns the next AT command to send in the current context.
   * @param  p_at_ctxt Pointer to the structure of AT context.
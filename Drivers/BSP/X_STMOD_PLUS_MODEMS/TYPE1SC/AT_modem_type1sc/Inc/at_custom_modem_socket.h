@@ -57,6 +57,7 @@ at_status_t fCmdBuild_SOCKETCMD_INFO(atparser_context_t *p_atp_ctxt, atcustom_mo
 at_status_t fCmdBuild_SOCKETCMD_DEACTIVATE(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
 at_status_t fCmdBuild_SOCKETCMD_DELETE(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
 at_status_t fCmdBuild_SOCKETDATA_SEND(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
+at_status_t fCmdBuild_SOCKETDATA_WRITE_DATA(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
 at_status_t fCmdBuild_SOCKETDATA_RECEIVE(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
 at_status_t fCmdBuild_DNSRSLV(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
 at_status_t fCmdBuild_PINGCMD(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt);
@@ -68,6 +69,8 @@ at_action_rsp_t fRspAnalyze_SOCKETCMD(at_context_t *p_at_ctxt, atcustom_modem_co
                                       const IPC_RxMessage_t *p_msg_in, at_element_info_t *element_infos);
 at_action_rsp_t fRspAnalyze_SOCKETDATA(at_context_t *p_at_ctxt, atcustom_modem_context_t *p_modem_ctxt,
                                        const IPC_RxMessage_t *p_msg_in, at_element_info_t *element_infos);
+at_action_rsp_t fRspAnalyze_SOCKETDATA_data(at_context_t *p_at_ctxt, atcustom_modem_context_t *p_modem_ctxt,
+                                            const IPC_RxMessage_t *p_msg_in, at_element_info_t *element_infos);
 at_action_rsp_t fRspAnalyze_SOCKETEV(at_context_t *p_at_ctxt, atcustom_modem_context_t *p_modem_ctxt,
                                      const IPC_RxMessage_t *p_msg_in, at_element_info_t *element_infos);
 at_action_rsp_t fRspAnalyze_DNSRSLV(at_context_t *p_at_ctxt, atcustom_modem_context_t *p_modem_ctxt,
@@ -72,6 +72,9 @@ extern "C" {
 
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 #define TYPE1SC_PING_TIMEOUT          ((uint32_t)15000)  /* 15 sec */
+
+/* %SOCKETDATA binary format: value of the <data> parameter in the commands and in the header of the response */
+#define TYPE1SC_SOCKETDATA_BIN_FORMAT "\"BIN\""
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)*/
 
 #define TYPE1SC_MODEM_SYNCHRO_AT_MAX_RETRIES ((uint8_t)30U)
@@ -116,6 +119,9 @@ enum
   CMD_AT_SOCKETCMD_SSLINFO,                   /* */
   CMD_AT_SOCKETDATA_SEND,                     /* send DATA */
   CMD_AT_SOCKETDATA_RECEIVE,                  /* received DATA */
+  CMD_AT_SOCKETDATA_FORMATS,                  /* list the socket data formats (test command) */
+  CMD_AT_SOCKETDATA_WRITE_DATA,               /* send DATA in binary format (after the prompt) */
+  CMD_AT_SOCKET_PROMPT,                       /* when sending socket data in binary format: prompt = "> " */
   CMD_AT_SOCKETEV,                            /* notify about socket events */
   CMD_AT_DNSRSLV,                             /* resolve a specific domain name */
   CMD_AT_PINGCMD,                             /* execute PING services */
@@ -149,6 +155,13 @@ typedef struct
   AT_CHAR_t hostIPaddr[MAX_SIZE_IPADDR]; /* = host_name parameter from CS_DnsReq_t */
 } ATCustom_TYPE1SC_dns_t;
 
+typedef enum
+{
+  SOCKETDATA_FORMAT_UNKNOWN, /* not probed yet */
+  SOCKETDATA_FORMAT_HEX,     /* data as an hexadecimal string */
+  SOCKETDATA_FORMAT_BIN,     /* data as raw bytes, framed by their length */
+} ATCustom_T1SC_SocketData_format_t;
+
 typedef enum
 {
   HOST_LP_STATE_IDLE,               /* state 0: */
@@ -181,6 +194,8 @@ typedef struct
   bool                          modem_bootev_received;
   uint8_t                       notifyev_mode; /* define which NOTIFYEV are requested */
   bool                          modem_sim_same_as_selected;
+  ATCustom_T1SC_SocketData_format_t socketdata_format; /* format used by %SOCKETDATA */
+  bool                          socketdata_retry_hex; /* binary command rejected: to send again in HEX */
   /* low-power variables */
   ATCustom_T1SC_Host_LP_state_t   host_lp_state;         /* to manage automaton Host Low Power state */
 
@@ -204,6 +219,7 @@ extern type1sc_shared_variables_t type1sc_shared;
 /* generic functions exported */
 void        ATCustom_TYPE1SC_init(atparser_context_t *p_atp_ctxt);
 uint8_t     ATCustom_TYPE1SC_checkEndOfMsgCallback(uint8_t rxChar);
+uint16_t    ATCustom_TYPE1SC_checkEndOfMsgSpanCallback(const uint8_t *p_span, uint16_t span_size);
 at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t ATCustom_TYPE1SC_extractElement(atparser_context_t *p_atp_ctxt,
                                             const IPC_RxMessage_t *p_msg_in,
@@ -224,6 +240,7 @@ at_status_t ATCustom_TYPE1SC_hw_event(sysctrl_device_type_t deviceType, at_hw_ev
 void ATC_TYPE1SC_modem_reset(atcustom_modem_context_t *p_modem_ctxt);
 void ATC_TYPE1SC_reset_variables(void);
 void ATC_TYPE1SC_reinitSyntaxAutomaton(void);
+void ATC_TYPE1SC_socketdata_fallback_hex(atcustom_modem_context_t *p_modem_ctxt);
 void ATC_TYPE1SC_modem_init(atcustom_modem_context_t *p_modem_ctxt);
 at_bool_t ATC_TYPE1SC_init_low_power(atcustom_modem_context_t *p_modem_ctxt);
 at_bool_t ATC_TYPE1SC_set_low_power(atcustom_modem_context_t *p_modem_ctxt);
@@ -56,6 +56,22 @@ extern "C" {
 
 #define UDP_SERVICE_SUPPORTED                (1U)
 #define CONFIG_MODEM_UDP_SERVICE_CONNECT_IP  ((uint8_t *)"0.0.0.0")
+/* AT%SOCKETDATA socket data format:
+ * - HEX: the data are carried as an hexadecimal string in the command / response (2 characters per byte),
+ *        supported by all the firmware versions.
+ * - BIN: EXPERIMENTAL - the data are carried as raw bytes, framed by their length: "SEND" waits for the
+ *        prompt "> " then <length> bytes are sent, "RECEIVE" answers a header line with <rlength> followed by
+ *        <rlength> bytes. This syntax is not the one of the modem AT commands manual and has not been validated
+ *        on modem firmware: it is only tested against the host modem simulator (Projects/Host).
+ * When TYPE1SC_SOCKETDATA_BINARY is set, the format is probed at modem init (AT%SOCKETDATA=?: "BIN" listed
+ * in the formats) and the driver falls back to HEX if the modem does not list it or rejects a binary command.
+ * When it is not set (default), only the HEX format is used and the binary commands are never sent.
+ * The maximum socket data sizes below are the ones of the HEX format (half of the AT command/response sizes),
+ * so that a fall back to HEX never has to split the data.
+ */
+#if !defined TYPE1SC_SOCKETDATA_BINARY
+#define TYPE1SC_SOCKETDATA_BINARY            (0U) /* 0: HEX format only, 1: EXPERIMENTAL binary format probed */
+#endif /* !defined TYPE1SC_SOCKETDATA_BINARY */
 #define CONFIG_MODEM_MAX_SOCKET_TX_DATA_SIZE ((uint32_t)710U) /* sendto managed, remote IP/port should be send
                                                                  IPv6/IPv4: protocol around 80/50 bytes
                                                                  data send in ASCII format:(1500-80)/2 = 710 */
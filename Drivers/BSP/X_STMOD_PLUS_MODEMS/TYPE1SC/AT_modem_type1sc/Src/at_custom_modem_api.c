@@ -62,6 +62,8 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   funcPtrs->f_get_urc = ATCustom_TYPE1SC_get_urc;
   funcPtrs->f_get_error = ATCustom_TYPE1SC_get_error;
   funcPtrs->f_hw_event = ATCustom_TYPE1SC_hw_event;
+  funcPtrs->f_getRxDataBuffer = NULL; /* socket data are not received directly in client buffer */
+  funcPtrs->f_checkEndOfMsgSpanCallback = ATCustom_TYPE1SC_checkEndOfMsgSpanCallback;
 #else
 #error AT custom does not match with selected modem
 #endif /* USE_MODEM_TYPE1SC */
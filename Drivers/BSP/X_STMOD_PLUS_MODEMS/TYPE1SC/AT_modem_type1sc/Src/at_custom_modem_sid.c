@@ -725,10 +725,37 @@ static at_status_t at_SID_CS_INIT_MODEM(atcustom_modem_context_t *p_mdm_ctxt, at
 
   if CHECK_STEP((0U))
   {
+#if ((USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (TYPE1SC_SOCKETDATA_BINARY == 1U))
+    if (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_UNKNOWN)
+    {
+      /* probe the socket data formats supported by the modem: binary format used if "BIN" is listed */
+      atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt, ATTYPE_TEST_CMD, (CMD_ID_t) CMD_AT_SOCKETDATA_FORMATS,
+                          INTERMEDIATE_CMD);
+    }
+    else
+    {
+      /* already probed since modem power on */
+      atcm_program_SKIP_CMD(p_atp_ctxt);
+    }
+#else
+    atcm_program_SKIP_CMD(p_atp_ctxt);
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (TYPE1SC_SOCKETDATA_BINARY == 1U) */
+  }
+  else if CHECK_STEP((1U))
+  {
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+    if (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_UNKNOWN)
+    {
+      type1sc_shared.socketdata_format = SOCKETDATA_FORMAT_HEX;
+    }
+    PRINT_INFO("socket data format: %s",
+               (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_BIN) ? "binary" : "HEX")
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+
     /* cfun parameters coming from client API for SID_CS_INIT_MODEM */
     atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CFUN, INTERMEDIATE_CMD);
   }
-  else if CHECK_STEP((1U))
+  else if CHECK_STEP((2U))
   {
     if (p_mdm_ctxt->SID_ctxt.modem_init.init == CS_CMI_MINI)
     {
@@ -748,7 +775,7 @@ static at_status_t at_SID_CS_INIT_MODEM(atcustom_modem_context_t *p_mdm_ctxt, at
       atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CPIN, INTERMEDIATE_CMD);
     }
   }
-  else if CHECK_STEP((2U))
+  else if CHECK_STEP((3U))
   {
     if (type1sc_shared.sim_status_retries > TYPE1SC_MAX_SIM_STATUS_RETRIES)
     {
@@ -776,7 +803,7 @@ static at_status_t at_SID_CS_INIT_MODEM(atcustom_modem_context_t *p_mdm_ctxt, at
       }
     }
   }
-  else if CHECK_STEP((3U))
+  else if CHECK_STEP((4U))
   {
     /* reset sim_status_retries */
     type1sc_shared.sim_status_retries = 0U;
@@ -1821,11 +1848,47 @@ static at_status_t at_SID_CS_SEND_DATA(atcustom_modem_context_t *p_mdm_ctxt, at_
       atcm_program_NO_MORE_CMD(p_atp_ctxt);
       retval = ATSTATUS_ERROR;
     }
+    else if (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_BIN)
+    {
+      /* binary format: command then wait for the socket prompt before to send the data */
+      type1sc_shared.socketdata_retry_hex = false;
+      p_mdm_ctxt->socket_ctxt.socket_send_state = SocketSendState_WaitingPrompt1st_greaterthan;
+      atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt,
+                          ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_SOCKETDATA_SEND, INTERMEDIATE_CMD);
+    }
     else
     {
       atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_SOCKETDATA_SEND, FINAL_CMD);
     }
   }
+  else if (type1sc_shared.socketdata_retry_hex == true)
+  {
+    /* binary format rejected by the modem (see ATC_TYPE1SC_socketdata_fallback_hex): send again in HEX */
+    type1sc_shared.socketdata_retry_hex = false;
+    atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_SOCKETDATA_SEND, FINAL_CMD);
+  }
+  else if CHECK_STEP((1U))
+  {
+    if (p_mdm_ctxt->socket_ctxt.socket_send_state == SocketSendState_Prompt_Received)
+    {
+      PRINT_DBG("SOCKET PROMPT ALREADY RECEIVED")
+      /* go to next step */
+      atcm_program_SKIP_CMD(p_atp_ctxt);
+    }
+    else
+    {
+      PRINT_DBG("WAITING FOR SOCKET PROMPT")
+      atcm_program_WAIT_EVENT(p_atp_ctxt, TYPE1SC_SOCKET_PROMPT_TIMEOUT, INTERMEDIATE_CMD);
+    }
+  }
+  else if CHECK_STEP((2U))
+  {
+    /* socket prompt received: send DATA */
+    atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt, ATTYPE_RAW_CMD, (CMD_ID_t) CMD_AT_SOCKETDATA_WRITE_DATA, FINAL_CMD);
+
+    /* reinit automaton to receive answer */
+    ATC_TYPE1SC_reinitSyntaxAutomaton();
+  }
   else
   {
     /* error, invalid step */
@@ -1868,7 +1931,14 @@ static at_status_t at_SID_CS_RECEIVE_DATA(atcustom_modem_context_t *p_mdm_ctxt,
       atcm_program_NO_MORE_CMD(p_atp_ctxt);
     }
   }
-  else if CHECK_STEP((1U))
+  else if (CHECK_STEP((1U)) && (type1sc_shared.socketdata_retry_hex == true))
+  {
+    /* binary format rejected by the modem (see ATC_TYPE1SC_socketdata_fallback_hex): request again in HEX */
+    type1sc_shared.socketdata_retry_hex = false;
+    atcm_program_AT_CMD(p_mdm_ctxt, p_atp_ctxt,
+                        ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_SOCKETDATA_RECEIVE, INTERMEDIATE_CMD);
+  }
+  else if (CHECK_STEP((1U)) || CHECK_STEP((2U)))
   {
     /* reset data available flag if no data received */
     if (p_mdm_ctxt->socket_ctxt.socketReceivedata.buffer_size == 0U)
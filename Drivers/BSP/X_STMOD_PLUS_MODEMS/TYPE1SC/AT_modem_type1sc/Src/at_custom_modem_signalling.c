@@ -613,6 +613,26 @@ at_action_rsp_t fRspAnalyze_Error_TYPE1SC(at_context_t *p_at_ctxt, atcustom_mode
        */
       retval = ATACTION_RSP_FRC_CONTINUE;
       break;
+
+    case CMD_AT_SOCKETDATA_FORMATS:
+      /* error is ignored: socket data formats not listed by this FW version, HEX format is used */
+      retval = ATACTION_RSP_FRC_END;
+      break;
+
+    case CMD_AT_SOCKETDATA_SEND:
+    case CMD_AT_SOCKETDATA_RECEIVE:
+      if (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_BIN)
+      {
+        /* binary format rejected by the modem: the SID sends the command again in HEX format */
+        (void) fRspAnalyze_Error(p_at_ctxt, p_modem_ctxt, p_msg_in, element_infos);
+        ATC_TYPE1SC_socketdata_fallback_hex(p_modem_ctxt);
+        retval = ATACTION_RSP_FRC_CONTINUE;
+      }
+      else
+      {
+        retval = fRspAnalyze_Error(p_at_ctxt, p_modem_ctxt, p_msg_in, element_infos);
+      }
+      break;
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
 
     default:
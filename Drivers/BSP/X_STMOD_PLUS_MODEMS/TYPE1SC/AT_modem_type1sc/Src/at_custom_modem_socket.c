@@ -94,19 +94,6 @@
   * @}
   */
 
-
-/** @defgroup AT_CUSTOM_ALTAIR_T1SC_SOCKET_Private_Functions_Prototypes
-  *  AT_CUSTOM ALTAIR_T1SC SOCKET Private Functions Prototypes
-  * @{
-  */
-static uint8_t convertToASCII(uint8_t nbr);
-static void convertCharToHEX(uint8_t val, uint8_t *p_msd, uint8_t *p_lsd);
-static at_status_t convertDigitToValue(uint8_t digit, uint8_t *res);
-static at_status_t convertHEXToChar(uint8_t MSD, uint8_t LSD, uint8_t *res);
-/**
-  * @}
-  */
-
 /** @defgroup AT_CUSTOM_ALTAIR_T1SC_SOCKET_Exported_Functions AT_CUSTOM ALTAIR_T1SC SOCKET Exported Functions
   * @{
   */
@@ -418,10 +405,35 @@ at_status_t fCmdBuild_SOCKETDATA_SEND(atparser_context_t *p_atp_ctxt, atcustom_m
     * <param1>: decimal, the socket ID
     * <param2>: decimal, the length in bytes of the data which needs to be written (1-3000)
     * <param3>: string, the data in HEX format (in quotes)
+    *           or "BIN": the <param2> bytes are sent in binary format after the prompt "> "
     * <param4>: string, destination IPv4 or IPv6 address(in quotes) for UDP datagram only
     * <param5>: decimal, destination port number (1-65535) for UDP datagram only
     */
-    if (p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send != NULL)
+    if (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_BIN)
+    {
+      /* binary format: AT%SOCKETDATA="SEND",<param1>,<param2>,"BIN"[,<param4>,<param5>]
+       * DATA are sent using fCmdBuild_SOCKETDATA_WRITE_DATA()
+       */
+      uint32_t socketID = atcm_socket_get_modem_cid(p_modem_ctxt,
+                                                    p_modem_ctxt->SID_ctxt.socketSendData_struct.socket_handle);
+      if (p_modem_ctxt->SID_ctxt.socketSendData_struct.ip_addr_type != CS_IPAT_INVALID)
+      {
+        (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params, "\"SEND\",%ld,%ld,%s,\"%s\",%d",
+                       socketID,
+                       p_modem_ctxt->SID_ctxt.socketSendData_struct.buffer_size,
+                       TYPE1SC_SOCKETDATA_BIN_FORMAT,
+                       p_modem_ctxt->SID_ctxt.socketSendData_struct.ip_addr_value,
+                       p_modem_ctxt->SID_ctxt.socketSendData_struct.remote_port);
+      }
+      else
+      {
+        (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params, "\"SEND\",%ld,%ld,%s",
+                       socketID,
+                       p_modem_ctxt->SID_ctxt.socketSendData_struct.buffer_size,
+                       TYPE1SC_SOCKETDATA_BIN_FORMAT);
+      }
+    }
+    else if (p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send != NULL)
     {
       uint32_t socketID = atcm_socket_get_modem_cid(p_modem_ctxt,
                                                     p_modem_ctxt->SID_ctxt.socketSendData_struct.socket_handle);
@@ -434,25 +446,12 @@ at_status_t fCmdBuild_SOCKETDATA_SEND(atparser_context_t *p_atp_ctxt, atcustom_m
                      socketID,
                      str_size);
 
-      /* now copy the buffer */
+      /* now copy the buffer, converting each char to its hexadecimal value (example 'A' is converted to '41') */
       uint16_t cmd_params_size = (uint16_t) strlen((CRC_CHAR_t *)&p_atp_ctxt->current_atcmd.params);
-      for (uint16_t idx = 0U; idx < str_size; idx++)
-      {
-        /* char by char */
-        uint8_t onechar = p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send[idx];
-        PRINT_DBG("[ %c -> HEX= %2x / DEC= %2d]", onechar, onechar, onechar)
-
-        /* convert this char to its hexadecimal value (example 'A' is converted to '65') - ASCII */
-        uint8_t ms;
-        uint8_t ls;
-        convertCharToHEX(onechar, &ms, &ls);
-        (void) memcpy((void *) &p_atp_ctxt->current_atcmd.params[cmd_params_size + (2U * idx)],
-                      (const CS_CHAR_t *)&ms,
-                      1);
-        (void) memcpy((void *) &p_atp_ctxt->current_atcmd.params[cmd_params_size + (1U + (2U * idx))],
-                      (const CS_CHAR_t *)&ls,
-                      1);
-      }
+      ATutil_convertBufferToHexaString(
+        (const uint8_t *)p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send,
+        str_size,
+        (uint8_t *)&p_atp_ctxt->current_atcmd.params[cmd_params_size]);
 
       /* Don't use strlen for next instruction due to data buffer */
       cmd_params_size += (2U * str_size);
@@ -487,6 +486,43 @@ at_status_t fCmdBuild_SOCKETDATA_SEND(atparser_context_t *p_atp_ctxt, atcustom_m
   return (retval);
 }
 
+/**
+  * @brief  Build specific modem command : SOCKETDATA SEND (write data in binary format).
+  * @note   EXPERIMENTAL binary format, see TYPE1SC_SOCKETDATA_BINARY.
+  * @param  p_atp_ctxt Pointer to the structure of Parser context.
+  * @param  p_modem_ctxt Pointer to the structure of Modem context.
+  * @retval at_status_t
+  */
+at_status_t fCmdBuild_SOCKETDATA_WRITE_DATA(atparser_context_t *p_atp_ctxt, atcustom_modem_context_t *p_modem_ctxt)
+{
+  at_status_t retval = ATSTATUS_OK;
+  PRINT_API("enter fCmdBuild_SOCKETDATA_WRITE_DATA()")
+
+  /* after having send AT%SOCKETDATA="SEND",<id>,<length>,"BIN" and prompt received, now send DATA */
+
+  /* only for raw command, set parameters */
+  if (p_atp_ctxt->current_atcmd.type == ATTYPE_RAW_CMD)
+  {
+    if (p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send != NULL)
+    {
+      uint32_t str_size = p_modem_ctxt->SID_ctxt.socketSendData_struct.buffer_size;
+      (void) memcpy((void *)p_atp_ctxt->current_atcmd.params,
+                    (const CS_CHAR_t *)p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send,
+                    (size_t) str_size);
+
+      /* set raw command size */
+      p_atp_ctxt->current_atcmd.raw_cmd_size = str_size;
+    }
+    else
+    {
+      PRINT_ERR("ERROR, send buffer is a NULL ptr !!!")
+      retval = ATSTATUS_ERROR;
+    }
+  }
+
+  return (retval);
+}
+
 /**
   * @brief  Build specific modem command : SOCKETCMD RECEIVE.
   * @param  p_atp_ctxt Pointer to the structure of Parser context.
@@ -502,17 +538,34 @@ at_status_t fCmdBuild_SOCKETDATA_RECEIVE(atparser_context_t *p_atp_ctxt, atcusto
   if (p_atp_ctxt->current_atcmd.type == ATTYPE_WRITE_CMD)
   {
     /* read from the socket
-    * AT%SOCKETDATA="RECEIVE",<param1>,<param2>
+    * AT%SOCKETDATA="RECEIVE",<param1>,<param2>[,<param3>]
     * <param1>: decimal, the socket ID
     * <param2>: decimal, the max length of the data buffer to be read from the socket (1-3000)
+    * <param3>: "BIN" to receive the data in binary format (HEX format if absent)
     */
     uint32_t socketID = atcm_socket_get_modem_cid(p_modem_ctxt,
                                                   p_modem_ctxt->socket_ctxt.socketReceivedata.socket_handle);
     uint32_t requested_data_size;
     requested_data_size = p_modem_ctxt->socket_ctxt.socketReceivedata.max_buffer_size;
-    (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params, "\"RECEIVE\",%ld,%ld",
-                   socketID,
-                   requested_data_size);
+    if (type1sc_shared.socketdata_format == SOCKETDATA_FORMAT_BIN)
+    {
+      (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params, "\"RECEIVE\",%ld,%ld,%s",
+                     socketID,
+                     requested_data_size,
+                     TYPE1SC_SOCKETDATA_BIN_FORMAT);
+
+      /* ready to start receive socket buffer: header then data, counted in ATCustom_TYPE1SC_checkEndOfMsgCallback */
+      p_modem_ctxt->socket_ctxt.socket_receive_state = SocketRcvState_RequestData_Header;
+      p_modem_ctxt->socket_ctxt.socket_RxData_state = SocketRxDataState_waiting_header;
+      p_modem_ctxt->socket_ctxt.socket_rx_expected_buf_size = 0U;
+      p_modem_ctxt->socket_ctxt.socket_rx_count_bytes_received = 0U;
+    }
+    else
+    {
+      (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params, "\"RECEIVE\",%ld,%ld",
+                     socketID,
+                     requested_data_size);
+    }
   }
 
   return (retval);
@@ -806,7 +859,26 @@ at_action_rsp_t fRspAnalyze_SOCKETDATA(at_context_t *p_at_ctxt, atcustom_modem_c
   START_PARAM_LOOP()
 
 
-  if (p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_SOCKETDATA_SEND)
+  if (p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_SOCKETDATA_FORMATS)
+  {
+    /* for a TEST command, the supported values of each parameter are listed:
+    *   %SOCKETDATA:("SEND","RECEIVE"),(1-<max socket_id>),(1-3000),("HEX","BIN")
+    *
+    *   the binary format is supported if "BIN" is listed.
+    */
+    uint16_t format_size = (uint16_t)(sizeof(TYPE1SC_SOCKETDATA_BIN_FORMAT) - 1U);
+    for (uint16_t idx = 0U; (idx + format_size) <= element_infos->str_size; idx++)
+    {
+      if (memcmp((const void *)&p_msg_in->buffer[element_infos->str_start_idx + idx],
+                 (const void *)TYPE1SC_SOCKETDATA_BIN_FORMAT, (size_t) format_size) == 0)
+      {
+        PRINT_INFO("<SOCKETDATA: binary format supported>")
+        type1sc_shared.socketdata_format = SOCKETDATA_FORMAT_BIN;
+      }
+    }
+  }
+  else if ((p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_SOCKETDATA_SEND) ||
+           (p_atp_ctxt->current_atcmd.id == (CMD_ID_t) CMD_AT_SOCKETDATA_WRITE_DATA))
   {
     /* for a SEND command, we have:
     *   %SOCKETDATA:<socket_id>[,<wlength>]]
@@ -839,7 +911,8 @@ at_action_rsp_t fRspAnalyze_SOCKETDATA(at_context_t *p_at_ctxt, atcustom_modem_c
   *     <socket_id> is the socket ID.
   *     <rlength> is length in bytes of data which was actually read.
   *     <modeData> is length in bytes of data left in the RX buffer.
-  *     <rdata> the read data in HEX format (in quotes).
+  *     <rdata> the read data in HEX format (in quotes),
+  *             or "BIN": the <rlength> data follow the line in binary format (<CR><LF><data><CR><LF>).
   *     <src_ip> is source IPv4 or IPv6 address(in quotes) for UDP datagram only
   *     <src_port> is source port number (1-65535) for UDP datagram only
   */
@@ -874,6 +947,22 @@ at_action_rsp_t fRspAnalyze_SOCKETDATA(at_context_t *p_at_ctxt, atcustom_modem_c
       PRINT_DBG("<SOCKETDATA_RECEIVE: moreData> = %ld",
                 ATutil_convertStringToInt(&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size))
     }
+    else if ((element_infos->param_rank == 5U) &&
+             (p_modem_ctxt->socket_ctxt.socket_receive_state == SocketRcvState_RequestData_Header))
+    {
+      /* <rdata> = "BIN": the <rlength> bytes follow the header line, their size has already been used
+       * by ATCustom_TYPE1SC_checkEndOfMsgCallback() to delimit them
+       */
+      if (rlength != 0U)
+      {
+        /* data header analyzed, ready to analyze data payload */
+        p_modem_ctxt->socket_ctxt.socket_receive_state = SocketRcvState_RequestData_Payload;
+      }
+      else
+      {
+        p_modem_ctxt->socket_ctxt.socketReceivedata.buffer_size = 0U;
+      }
+    }
     else if (element_infos->param_rank == 5U)
     {
       /* <rdata> */
@@ -892,29 +981,20 @@ at_action_rsp_t fRspAnalyze_SOCKETDATA(at_context_t *p_at_ctxt, atcustom_modem_c
       /* check that received data size does not exceed client buffer size */
       if (data_size <= p_modem_ctxt->socket_ctxt.socketReceivedata.max_buffer_size)
       {
-        uint16_t idx;
-        for (idx = 0U; ((idx < data_size) && (retval != ATACTION_RSP_ERROR)); idx++)
+        /* convert received buffer from HEX to ASCII format directly in client buffer
+        * example: if we receive 48545450, take digits 2 by 2 and convert them
+        *          to their hexa value
+        *           => 48 = 0x48 = H
+        *           => 54 = 0x54 = T
+        *           => 54 = 0x54 = T
+        *           => 50 = 0x50 = P
+        */
+        if (ATutil_convertHexaStringToBuffer(&p_msg_in->buffer[element_infos->str_start_idx + 1U],
+                                             data_size,
+                                             (uint8_t *)p_modem_ctxt->socket_ctxt.socketReceivedata.p_buffer_addr_rcv)
+            == 0U)
         {
-          /* convert received buffer from HEX to ASCII format
-          * example: if we receive 48545450, take digits 2 by 2 and convert them
-          *          to their hexa value
-          *           => 48 = 0x48 = H
-          *           => 54 = 0x54 = T
-          *           => 54 = 0x54 = T
-          *           => 50 = 0x50 = P
-          */
-          uint8_t conVal;
-          if (convertHEXToChar((uint8_t)p_msg_in->buffer[element_infos->str_start_idx + 1U + (idx * 2U)],
-                               (uint8_t)p_msg_in->buffer[element_infos->str_start_idx + 2U + (idx * 2U)],
-                               &conVal) == ATSTATUS_OK)
-          {
-            /* recopy data to client buffer */
-            p_modem_ctxt->socket_ctxt.socketReceivedata.p_buffer_addr_rcv[idx] = conVal;
-          }
-          else
-          {
-            retval = ATACTION_RSP_ERROR;
-          }
+          retval = ATACTION_RSP_ERROR;
         }
 
         /* finally, update buffer client size */
@@ -974,6 +1054,46 @@ at_action_rsp_t fRspAnalyze_SOCKETDATA(at_context_t *p_at_ctxt, atcustom_modem_c
   return (retval);
 }
 
+/**
+  * @brief  Analyze specific modem response : SOCKETDATA (data part in binary format).
+  * @note   EXPERIMENTAL binary format, see TYPE1SC_SOCKETDATA_BINARY.
+  * @param  p_atp_ctxt Pointer to the structure of Parser context.
+  * @param  p_modem_ctxt Pointer to the structure of Modem context.
+  * @retval at_status_t
+  */
+at_action_rsp_t fRspAnalyze_SOCKETDATA_data(at_context_t *p_at_ctxt, atcustom_modem_context_t *p_modem_ctxt,
+                                            const IPC_RxMessage_t *p_msg_in, at_element_info_t *element_infos)
+{
+  UNUSED(p_at_ctxt);
+  at_action_rsp_t retval = ATACTION_RSP_IGNORED;
+  PRINT_API("enter fRspAnalyze_SOCKETDATA_data()")
+
+  PRINT_DBG("DATA received: size=%ld vs %d", p_modem_ctxt->socket_ctxt.socket_rx_expected_buf_size,
+            element_infos->str_size)
+
+  /* Recopy data to client buffer if:
+  *   - pointer on data buffer exists
+  *   - and size of data <= maximum size
+  */
+  if ((p_modem_ctxt->socket_ctxt.socketReceivedata.p_buffer_addr_rcv != NULL) &&
+      (element_infos->str_size <= p_modem_ctxt->socket_ctxt.socketReceivedata.max_buffer_size))
+  {
+    /* recopy data to client buffer */
+    (void) memcpy((void *)p_modem_ctxt->socket_ctxt.socketReceivedata.p_buffer_addr_rcv,
+                  (const void *)&p_msg_in->buffer[element_infos->str_start_idx],
+                  (size_t) element_infos->str_size);
+    p_modem_ctxt->socket_ctxt.socketReceivedata.buffer_size = element_infos->str_size;
+  }
+  else
+  {
+    PRINT_ERR("ERROR (receive buffer is a NULL ptr or data exceed buffer size)")
+    p_modem_ctxt->socket_ctxt.socketReceivedata.buffer_size = 0U;
+    retval = ATACTION_RSP_ERROR;
+  }
+
+  return (retval);
+}
+
 /**
   * @brief  Analyze specific modem response : SOCKETEV.
   * @param  p_atp_ctxt Pointer to the structure of Parser context.
@@ -1226,115 +1346,6 @@ void clear_ping_resp_struct(atcustom_modem_context_t *p_modem_ctxt)
   /* p_modem_ctxt->persist.ping_resp_urc.index is unchanged */
 }
 
-/**
-  * @}
-  */
-
-/** @defgroup AT_CUSTOM_ALTAIR_T1SC_SOCKET_Private_Functions AT_CUSTOM ALTAIR_T1SC SOCKET Private Functions
-  * @{
-  */
-
-/**
-  * @brief  Convert a number to its ASCII value.
-  * @param  nbr Number to convert.
-  * @retval corresponding ASCII value.
-  */
-static uint8_t convertToASCII(uint8_t nbr)
-{
-  uint8_t ascii;
-
-  if (nbr <= 9U)
-  {
-    ascii = nbr + 48U;
-  }
-  else
-  {
-    ascii = nbr + 87U; /* 87 = 97 -10 (where 97 correspond to 'a') */
-  }
-  return (ascii);
-}
-
-/**
-  * @brief  Convert a character to its HEX value
-  *         for example 'A' is converted to '65' where msd='6' and lsd='5'
-  * @param  val Character to convert.
-  * @param  p_msb ptr to Most significant Digit of HEX value
-  * @param  p_lsb ptr to Less significant Digit of HEX value
-  * @retval none.
-  */
-static void convertCharToHEX(uint8_t val, uint8_t *p_msd, uint8_t *p_lsd)
-{
-  *p_msd = convertToASCII(val / 16U);
-  *p_lsd = convertToASCII(val % 16U);
-}
-
-/**
-  * @brief  Convert an hexa number (from 0 to F) to its ASCII value
-  * @param  digit Value to convert.
-  * @param  p_res ptr to converted value.
-  * @retval at_status_t.
-  */
-static at_status_t convertDigitToValue(uint8_t digit, uint8_t *p_res)
-{
-  at_status_t retval = ATSTATUS_OK;
-
-  if ((digit >= 48U) && (digit <= 57U))
-  {
-    /* 0 to 9 */
-    *p_res = digit - 48U;
-  }
-  else if ((digit >= 97U) && (digit <= 102U))
-  {
-    /* a to f */
-    *p_res = digit - 87U; /* 87 = -97+10 */
-  }
-  else if ((digit >= 65U) && (digit <= 70U))
-  {
-    /* A to F */
-    *p_res = digit - 55U; /* 55 = -65+10*/
-  }
-  else
-  {
-    *p_res = 0;
-    retval = ATSTATUS_ERROR;
-  }
-  return (retval);
-}
-
-/**
-  * @brief  Convert a HEX to its Char value
-  *         for example '65' (where msd='6' and lsd='5') is converted to 'A'
-  * @param  msd Most significant Digit of HEX value .
-  * @param  lsd Less significant Digit of HEX value.
-  * @param  p_conv ptr to converted Character value.
-  * @retval at_status_t.
-  */
-static at_status_t convertHEXToChar(uint8_t msd, uint8_t lsd, uint8_t *p_conv)
-{
-  at_status_t retval = ATSTATUS_OK;
-  uint8_t convMSD;
-  uint8_t convLSD;
-
-  /* convert Most significant digit */
-  if (convertDigitToValue(msd, &convMSD) == ATSTATUS_OK)
-  {
-    /* convert Less significant digit */
-    if (convertDigitToValue(lsd, &convLSD) == ATSTATUS_OK)
-    {
-      /* compute converted char value */
-      *p_conv = (convMSD << 4) + convLSD;
-    }
-    else
-    {
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else
-  {
-    retval = ATSTATUS_ERROR;
-  }
-  return (retval);
-}
 /**
   * @}
   */
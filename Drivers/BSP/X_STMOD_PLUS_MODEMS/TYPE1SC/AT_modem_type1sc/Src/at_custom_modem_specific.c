@@ -110,6 +110,13 @@
   */
 /* TYPE1SC Modem device context */
 static atcustom_modem_context_t TYPE1SC_ctxt;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+/* Socket data header in binary format: %SOCKETDATA:<socket_id>,<rlength>,<moreData>,"BIN" */
+static const uint8_t SOCKETDATA_string[] = "%SOCKETDATA:";
+static uint8_t SOCKETDATA_Counter = 0U;
+static uint8_t SocketHeaderRx_Field = 0U; /* rank of the header field received, <rlength> is the 2nd one */
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
 /**
   * @}
   */
@@ -130,6 +137,8 @@ type1sc_shared_variables_t type1sc_shared =
   .modem_bootev_received = false,
   .notifyev_mode = 0U,
   .modem_sim_same_as_selected = true,
+  .socketdata_format = SOCKETDATA_FORMAT_UNKNOWN,
+  .socketdata_retry_hex = false,
   .host_lp_state  = HOST_LP_STATE_IDLE,
 };
 /**
@@ -257,6 +266,18 @@ void ATCustom_TYPE1SC_init(atparser_context_t *p_atp_ctxt)
       CMD_AT_SOCKETDATA_RECEIVE,     "%SOCKETDATA",  TYPE1SC_DEFAULT_TIMEOUT,
       fCmdBuild_SOCKETDATA_RECEIVE,   fRspAnalyze_SOCKETDATA
     },
+    {
+      CMD_AT_SOCKETDATA_FORMATS,     "%SOCKETDATA",  TYPE1SC_DEFAULT_TIMEOUT,
+      fCmdBuild_NoParams,             fRspAnalyze_SOCKETDATA
+    },
+    {
+      CMD_AT_SOCKETDATA_WRITE_DATA,  "",             TYPE1SC_DEFAULT_TIMEOUT,
+      fCmdBuild_SOCKETDATA_WRITE_DATA, fRspAnalyze_None
+    },
+    {
+      CMD_AT_SOCKET_PROMPT,          "> ",           TYPE1SC_SOCKET_PROMPT_TIMEOUT,
+      fCmdBuild_NoParams,             fRspAnalyze_None
+    },
     {
       CMD_AT_DNSRSLV,                "%DNSRSLV",     TYPE1SC_DEFAULT_TIMEOUT,
       fCmdBuild_DNSRSLV,              fRspAnalyze_DNSRSLV
@@ -280,6 +301,7 @@ void ATCustom_TYPE1SC_init(atparser_context_t *p_atp_ctxt)
   /* ###########################  START CUSTOMIZATION PART  ########################### */
   TYPE1SC_ctxt.modem_LUT_size = SIZE_ATCMD_TYPE1SC_LUT;
   TYPE1SC_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_TYPE1SC_LUT;
+  atcm_build_LUT_index(&TYPE1SC_ctxt);
 
   /* override default termination string for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -333,19 +355,90 @@ uint8_t ATCustom_TYPE1SC_checkEndOfMsgCallback(uint8_t rxChar)
       */
       TYPE1SC_ctxt.state_SyntaxAutomaton = WAITING_FOR_FIRST_CHAR;
       last_char = 1U;
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+      SOCKETDATA_Counter = 0U;
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
     }
   }
   /*---------------------------------------------------------------------------------------*/
   else if (TYPE1SC_ctxt.state_SyntaxAutomaton == WAITING_FOR_FIRST_CHAR)
   {
     /* NOTE about Socket mode:
-    * No need to use/manage socket_RxData_state as it is done for other modems.
-    * Indeed as data are received in HEX format, no risk to detect <CR> or <LF>
-    * in the received data.
+    * In HEX format, no risk to detect <CR> or <LF> in the received data: socket_RxData_state is not used.
+    * In binary format, the data follow the header line and are only counted, as for other modems.
     */
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+    if (TYPE1SC_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_waiting_header)
+    {
+      /* Socket Data RX - waiting for Header: we are waiting for %SOCKETDATA:
+      *
+      * %SOCKETDATA:1,522,0,"BIN"<CR><LF>HTTP/1.1 200 OK<CR><LF><CR><LF>Date: Wed, 21 Feb 2018 14:56:54 GMT...
+      *    ^- waiting this string
+      */
+      if ((SOCKETDATA_Counter < (uint8_t)(sizeof(SOCKETDATA_string) - 1U))
+          && (rxChar == SOCKETDATA_string[SOCKETDATA_Counter]))
+      {
+        SOCKETDATA_Counter++;
+        if (SOCKETDATA_Counter == (uint8_t)(sizeof(SOCKETDATA_string) - 1U))
+        {
+          /* %SOCKETDATA: detected, next step */
+          SocketHeaderRx_Field = 0U;
+          TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size = 0U;
+          TYPE1SC_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_receiving_header;
+        }
+      }
+      else
+      {
+        /* not a socket data header: ignore the rest of the line (counter reset at <LF>) */
+        SOCKETDATA_Counter = (uint8_t)sizeof(SOCKETDATA_string);
+      }
+    }
+    else if (TYPE1SC_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_receiving_header)
+    {
+      /* Socket Data RX - Header received: retrieve <rlength>, wait for <CR>
+      *
+      * %SOCKETDATA:1,522,0,"BIN"<CR><LF>HTTP/1.1 200 OK<CR><LF><CR><LF>Date: Wed, 21 Feb 2018 14:56:54 GMT...
+      *               ^- retrieving this size
+      *                          ^- waiting this <CR>
+      */
+      if (rxChar == (AT_CHAR_t)(','))
+      {
+        SocketHeaderRx_Field++;
+      }
+      else if ((SocketHeaderRx_Field == 1U) && (rxChar >= (AT_CHAR_t)('0')) && (rxChar <= (AT_CHAR_t)('9')))
+      {
+        TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size =
+          (TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size * 10U) + (uint32_t)rxChar - (uint32_t)('0');
+      }
+      else {/* nothing to do */ }
+    }
+    else if (TYPE1SC_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_receiving_data)
+    {
+      /* receiving socket data: do not analyze char, just count expected size */
+      TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received++;
+      TYPE1SC_ctxt.state_SyntaxAutomaton = WAITING_FOR_SOCKET_DATA;
+      /* check if full buffer has been received */
+      if (TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received ==
+          TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size)
+      {
+        TYPE1SC_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_data_received;
+        TYPE1SC_ctxt.state_SyntaxAutomaton = WAITING_FOR_CR;
+      }
+    }
+    else {/* nothing to do */ }
+
+    if ((TYPE1SC_ctxt.state_SyntaxAutomaton == WAITING_FOR_FIRST_CHAR) && ((AT_CHAR_t)('\r') == rxChar)
+        && (TYPE1SC_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_receiving_header))
+    {
+      /* end of the header: the data follow the <LF> if <rlength> is not null */
+      TYPE1SC_ctxt.socket_ctxt.socket_RxData_state =
+        (TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size != 0U) ?
+        SocketRxDataState_receiving_data : SocketRxDataState_finished;
+    }
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
 
     /* waiting for <CR> or x */
-    if ((AT_CHAR_t)('\r') == rxChar)
+    if ((TYPE1SC_ctxt.state_SyntaxAutomaton == WAITING_FOR_FIRST_CHAR) && ((AT_CHAR_t)('\r') == rxChar))
     {
       /*   current        : <CR>
       *   command format : <CR><LF>xxxxxxxx<CR><LF>
@@ -355,6 +448,19 @@ uint8_t ATCustom_TYPE1SC_checkEndOfMsgCallback(uint8_t rxChar)
     }
     else {/* nothing to do */ }
   }
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  /*---------------------------------------------------------------------------------------*/
+  else if (TYPE1SC_ctxt.state_SyntaxAutomaton == WAITING_FOR_SOCKET_DATA)
+  {
+    TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received++;
+    /* check if full buffer has been received */
+    if (TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received == TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size)
+    {
+      TYPE1SC_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_data_received;
+      TYPE1SC_ctxt.state_SyntaxAutomaton = WAITING_FOR_CR;
+    }
+  }
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
   /*---------------------------------------------------------------------------------------*/
   else
   {
@@ -365,14 +471,125 @@ uint8_t ATCustom_TYPE1SC_checkEndOfMsgCallback(uint8_t rxChar)
   /* ###########################  START CUSTOMIZATION PART  ######################### */
   /* if modem does not use standard syntax or has some specificities, replace previous
   *  function by a custom function
-  *  for example, apply special treatment if (last_char = 0U)
   */
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  if ((last_char == 0U) && (TYPE1SC_ctxt.socket_ctxt.socket_send_state != SocketSendState_No_Activity))
+  {
+    /* TYPE1SC special case
+    *
+    *  SOCKET MODE: when sending DATA in binary format using AT%SOCKETDATA="SEND", we are waiting for
+    *               socket prompt "<CR><LF>> " before to send DATA.
+    */
+    if (TYPE1SC_ctxt.socket_ctxt.socket_send_state == SocketSendState_WaitingPrompt1st_greaterthan)
+    {
+      /* detecting socket prompt first char: "greater than" */
+      if ((AT_CHAR_t)('>') == rxChar)
+      {
+        TYPE1SC_ctxt.socket_ctxt.socket_send_state = SocketSendState_WaitingPrompt2nd_space;
+      }
+    }
+    else if (TYPE1SC_ctxt.socket_ctxt.socket_send_state == SocketSendState_WaitingPrompt2nd_space)
+    {
+      /* detecting socket prompt second char: "space" */
+      if ((AT_CHAR_t)(' ') == rxChar)
+      {
+        TYPE1SC_ctxt.socket_ctxt.socket_send_state = SocketSendState_Prompt_Received;
+        last_char = 1U;
+      }
+      else
+      {
+        /* if char immediately after "greater than" is not a "space", reinit state */
+        TYPE1SC_ctxt.socket_ctxt.socket_send_state = SocketSendState_WaitingPrompt1st_greaterthan;
+      }
+    }
+    else {/* nothing to do */ }
+  }
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
 
   /* ###########################  END CUSTOMIZATION PART  ########################### */
 
   return (last_char);
 }
 
+/**
+  * @brief  Search end of message in a span of characters received from modem.
+  * @note   Same automaton as ATCustom_TYPE1SC_checkEndOfMsgCallback: the characters which can not
+  *         change its state (message body, socket data) are skipped by block,
+  *         other characters are analyzed one by one by ATCustom_TYPE1SC_checkEndOfMsgCallback.
+  * @param  p_span Ptr to the characters received from modem.
+  * @param  span_size Number of characters received.
+  * @retval uint16_t Returns the number of characters up to the end of message (included),
+  *         0 if the span does not contain an end of message.
+  */
+uint16_t ATCustom_TYPE1SC_checkEndOfMsgSpanCallback(const uint8_t *p_span, uint16_t span_size)
+{
+  uint16_t idx = 0U;
+  uint16_t msg_size = 0U;
+
+  while ((idx < span_size) && (msg_size == 0U))
+  {
+    atcustom_modem_SyntaxAutomatonState_t state = TYPE1SC_ctxt.state_SyntaxAutomaton;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+    atcustom_socket_RxData_state_t rx_data_state = TYPE1SC_ctxt.socket_ctxt.socket_RxData_state;
+
+    /* characters are analyzed one by one when waiting for socket prompt */
+    if (TYPE1SC_ctxt.socket_ctxt.socket_send_state != SocketSendState_No_Activity)
+    {
+      __NOP();
+    }
+    else if ((state == WAITING_FOR_SOCKET_DATA)
+             && (TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received <
+                 TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size))
+    {
+      /* socket data in binary format: only count them */
+      uint32_t count = TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size
+                       - TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+      if (count > ((uint32_t)span_size - idx))
+      {
+        count = (uint32_t)span_size - idx;
+      }
+      TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received += count;
+      idx += (uint16_t)count;
+      /* check if full buffer has been received */
+      if (TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received ==
+          TYPE1SC_ctxt.socket_ctxt.socket_rx_expected_buf_size)
+      {
+        TYPE1SC_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_data_received;
+        TYPE1SC_ctxt.state_SyntaxAutomaton = WAITING_FOR_CR;
+      }
+    }
+    else if ((state == WAITING_FOR_INIT_CR) || (state == WAITING_FOR_CR)
+             || ((state == WAITING_FOR_FIRST_CHAR)
+                 && (rx_data_state != SocketRxDataState_waiting_header)
+                 && (rx_data_state != SocketRxDataState_receiving_header)
+                 && (rx_data_state != SocketRxDataState_receiving_data)))
+#else
+    if (state != WAITING_FOR_LF)
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+    {
+      /* only <CR> can change the automaton state: jump to it */
+      idx += ATutil_findChar(&p_span[idx], (span_size - idx), (uint8_t)'\r');
+    }
+    else
+    {
+      /* nothing to skip */
+    }
+
+    /* analyze next character */
+    if (idx < span_size)
+    {
+      if (ATCustom_TYPE1SC_checkEndOfMsgCallback(p_span[idx]) == 1U)
+      {
+        msg_size = idx + 1U;
+      }
+      idx++;
+    }
+  }
+
+  return (msg_size);
+}
+
 /**
   * @brief  Returns the next AT command to send in the current context.
   * @param  p_at_ctxt Pointer to the structure of AT context.
@@ -394,6 +611,14 @@ at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
     /* new command: reset command context */
     atcm_reset_CMD_context(&TYPE1SC_ctxt.CMD_ctxt);
 
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+    /* a previous socket data reception in binary format is over (even if aborted on error or timeout):
+     * its header must no more be searched in the received messages
+     */
+    TYPE1SC_ctxt.socket_ctxt.socket_receive_state = SocketRcvState_No_Activity;
+    TYPE1SC_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_not_started;
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+
     /* For each SID, the sequence of AT commands to send id defined (it can be dynamic)
     * Determine and prepare the next command to send for this SID
     */
@@ -428,6 +653,22 @@ at_endmsg_t ATCustom_TYPE1SC_extractElement(atparser_context_t *p_atp_ctxt,
   PRINT_API("enter ATCustom_TYPE1SC_extractElement()")
   PRINT_DBG("input message: size=%d ", p_msg_in->size)
 
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  if ((*p_parseIndex == 0U) &&
+      (TYPE1SC_ctxt.socket_ctxt.socket_receive_state == SocketRcvState_RequestData_Payload) &&
+      (TYPE1SC_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_data_received))
+  {
+    /* socket data in binary format: the whole message (without the final <CR><LF>) is the data */
+    PRINT_DBG("receiving socket data (real size=%ld)", TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received)
+    element_infos->str_start_idx = 0U;
+    element_infos->str_end_idx = (uint16_t) TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+    element_infos->str_size = (uint16_t) TYPE1SC_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+    TYPE1SC_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_finished;
+    *p_parseIndex = p_msg_in->size;
+    return (ATENDMSG_YES);
+  }
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+
   /* if this is beginning of message, check that message header is correct and jump over it */
   if (*p_parseIndex == 0U)
   {
@@ -529,10 +770,32 @@ at_action_rsp_t ATCustom_TYPE1SC_analyzeCmd(at_context_t *p_at_ctxt,
 
   PRINT_API("enter ATCustom_TYPE1SC_analyzeCmd()")
 
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  if ((TYPE1SC_ctxt.socket_ctxt.socket_receive_state == SocketRcvState_RequestData_Payload) &&
+      (TYPE1SC_ctxt.socket_ctxt.socket_RxData_state == SocketRxDataState_finished))
+  {
+    /* socket data in binary format (delimited by ATCustom_TYPE1SC_extractElement):
+     * not searched in the LUT, the data may look like a command
+     */
+    element_infos->cmd_id_received = (CMD_ID_t) CMD_AT_INVALID;
+    retval = ATACTION_RSP_ERROR;
+    if (fRspAnalyze_SOCKETDATA_data(p_at_ctxt, &TYPE1SC_ctxt, p_msg_in, element_infos) != ATACTION_RSP_ERROR)
+    {
+      /* received a valid intermediate answer */
+      retval = ATACTION_RSP_INTERMEDIATE;
+    }
+    TYPE1SC_ctxt.socket_ctxt.socket_receive_state = SocketRcvState_No_Activity;
+  }
+  /* Analyze data received from the modem and
+    * search in LUT the ID corresponding to command received
+    */
+  else if (ATSTATUS_OK != atcm_searchCmdInLUT(&TYPE1SC_ctxt, p_atp_ctxt, p_msg_in, element_infos))
+#else
   /* Analyze data received from the modem and
     * search in LUT the ID corresponding to command received
     */
   if (ATSTATUS_OK != atcm_searchCmdInLUT(&TYPE1SC_ctxt, p_atp_ctxt, p_msg_in, element_infos))
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
   {
     /* No command corresponding to a LUT entry has been found.
       * May be we received a text line without command prefix.
@@ -674,6 +937,20 @@ at_action_rsp_t ATCustom_TYPE1SC_analyzeCmd(at_context_t *p_at_ctxt,
         retval = ATACTION_RSP_INTERMEDIATE;
         break;
 
+      case CMD_AT_SOCKET_PROMPT:
+        PRINT_INFO(" SOCKET PROMPT RECEIVED")
+        /* if we were waiting for this event, we can continue the sequence */
+        if (p_atp_ctxt->current_SID == (at_msg_t) SID_CS_SEND_DATA)
+        {
+          /* UNLOCK the WAIT EVENT */
+          retval = ATACTION_RSP_FRC_END;
+        }
+        else
+        {
+          retval = ATACTION_RSP_URC_IGNORED;
+        }
+        break;
+
       case CMD_AT_DNSRSLV:
         retval = ATACTION_RSP_INTERMEDIATE;
         break;
@@ -1041,6 +1318,9 @@ void ATC_TYPE1SC_reset_variables(void)
   /* Set default values of TYPE1SC specific variables after SWITCH ON or RESET */
   type1sc_shared.modem_waiting_for_bootev = false;
   type1sc_shared.modem_bootev_received = false;
+  /* socket data format probed again at modem init (the firmware may have changed) */
+  type1sc_shared.socketdata_format = SOCKETDATA_FORMAT_UNKNOWN;
+  type1sc_shared.socketdata_retry_hex = false;
 
   /* other values */
   type1sc_shared.host_lp_state = HOST_LP_STATE_IDLE;
@@ -1055,6 +1335,31 @@ void ATC_TYPE1SC_reinitSyntaxAutomaton(void)
   TYPE1SC_ctxt.state_SyntaxAutomaton = WAITING_FOR_INIT_CR;
 }
 
+/**
+  * @brief  Fall back to the HEX socket data format.
+  * @note   Called when the modem rejects a socket data command in binary format: the pending
+  *         prompt / data reception is cancelled and the SID sends the command again in HEX format.
+  * @param  p_modem_ctxt Pointer to the structure of Modem context.
+  * @retval none.
+  */
+void ATC_TYPE1SC_socketdata_fallback_hex(atcustom_modem_context_t *p_modem_ctxt)
+{
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  if (type1sc_shared.socketdata_format != SOCKETDATA_FORMAT_HEX)
+  {
+    PRINT_INFO("socket data: binary format rejected, fall back to HEX format")
+    type1sc_shared.socketdata_format = SOCKETDATA_FORMAT_HEX;
+  }
+  type1sc_shared.socketdata_retry_hex = true;
+  p_modem_ctxt->socket_ctxt.socket_send_state = SocketSendState_No_Activity;
+  p_modem_ctxt->socket_ctxt.socket_receive_state = SocketRcvState_No_Activity;
+  p_modem_ctxt->socket_ctxt.socket_RxData_state = SocketRxDataState_not_started;
+  ATC_TYPE1SC_reinitSyntaxAutomaton();
+#else
+  UNUSED(p_modem_ctxt);
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
+}
+
 /**
   * @brief  Initialization of modem parameters.
   * @param  p_modem_ctxt Pointer to the structure of Modem context.
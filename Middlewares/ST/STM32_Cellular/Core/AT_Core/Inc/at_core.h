@@ -67,11 +67,25 @@ extern "C" {
                                                */
 
 #define ATCMD_MAX_DELAY      ((uint32_t) 0xFFFFFFFFU) /* No timeout in this case */
+#define ATCMD_LUT_IDX_NONE   ((uint16_t) 0xFFFFU)     /* command not found in the modem LUT */
 #define SID_INVALID               (0U)
 #define CELLULAR_SERVICE_START_ID (100U)
 #define WIFI_SERVICE_START_ID     (300U)
 #define AT_HANDLE_INVALID         (-1)  /* AT handle is not allocated */
 #define AT_HANDLE_MODEM           (1)   /* AT handle is allocated to the modem */
+
+/* If AT_CORE_STATISTIC activated, the latencies of the AT transactions are measured with the DWT cycle counter
+   and stored in log2 histograms per AT command, displayed by the 'atstat' console command.
+   Statistics are indexed by the position of the command in the modem LUT: AT_CORE_STATISTIC_LUT_SIZE has to be
+   at least the size of the modem LUT (about 140 bytes of RAM per entry).
+   Lines with several pipelined commands are not measured (only counted): their latency can not be charged to
+   one command */
+#if !defined AT_CORE_STATISTIC
+#define AT_CORE_STATISTIC         (0U) /* 0: not activated, 1: activated */
+#endif /* !defined AT_CORE_STATISTIC */
+#if !defined AT_CORE_STATISTIC_LUT_SIZE
+#define AT_CORE_STATISTIC_LUT_SIZE ((uint16_t) 96U) /* BG96: 89 commands, MONARCH: 68, TYPE1SC: 67 */
+#endif /* !defined AT_CORE_STATISTIC_LUT_SIZE */
 /**
   * @}
   */
@@ -143,6 +157,7 @@ typedef struct
   uint8_t      name[ATCMD_MAX_NAME_SIZE];
   uint8_t      params[ATCMD_MAX_CMD_SIZE];
   uint32_t     raw_cmd_size;                   /* raw_cmd_size is used only for raw commands */
+  uint16_t     lut_idx;                        /* position in the modem LUT, ATCMD_LUT_IDX_NONE if not found */
 } atcmd_desc_t;
 
 typedef uint16_t at_msg_t;
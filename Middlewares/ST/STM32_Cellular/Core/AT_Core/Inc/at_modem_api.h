@@ -57,6 +57,7 @@ typedef enum
 
 typedef void (*ATC_initTypeDef)(atparser_context_t *p_atp_ctxt);
 typedef uint8_t (*ATC_checkEndOfMsgCallbackTypeDef)(uint8_t rxChar);
+typedef uint16_t (*ATC_checkEndOfMsgSpanCallbackTypeDef)(const uint8_t *p_span, uint16_t span_size);
 typedef at_status_t (*ATC_getCmdTypeDef)(at_context_t *p_at_ctxt,
                                          uint32_t *p_ATcmdTimeout);
 typedef at_endmsg_t (*ATC_extractElementTypeDef)(atparser_context_t *p_atp_ctxt,
@@ -73,6 +74,7 @@ typedef at_status_t (*ATC_get_rsp)(atparser_context_t *p_atp_ctxt, at_buf_t *p_r
 typedef at_status_t (*ATC_get_urc)(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 typedef at_status_t (*ATC_get_error)(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 typedef at_status_t (*ATC_hw_event)(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+typedef uint8_t *(*ATC_getRxDataBufferTypeDef)(atparser_context_t *p_atp_ctxt, uint16_t *p_size);
 
 typedef struct
 {
@@ -88,6 +90,8 @@ typedef struct
   ATC_get_urc                        f_get_urc;
   ATC_get_error                      f_get_error;
   ATC_hw_event                       f_hw_event;
+  ATC_getRxDataBufferTypeDef         f_getRxDataBuffer; /* optional (can be NULL) */
+  ATC_checkEndOfMsgSpanCallbackTypeDef f_checkEndOfMsgSpanCallback; /* optional (can be NULL) */
 
 } atcustom_funcPtrs_t;
 /**
@@ -100,6 +104,7 @@ typedef struct
 at_status_t atcc_initParsers(sysctrl_device_type_t device_type);
 void atcc_init(at_context_t *p_at_ctxt);
 ATC_checkEndOfMsgCallbackTypeDef atcc_checkEndOfMsgCallback(const at_context_t *p_at_ctxt);
+ATC_checkEndOfMsgSpanCallbackTypeDef atcc_checkEndOfMsgSpanCallback(const at_context_t *p_at_ctxt);
 at_status_t atcc_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t atcc_extractElement(at_context_t *p_at_ctxt,
                                 const IPC_RxMessage_t *p_msg_in,
@@ -115,6 +120,7 @@ at_status_t atcc_get_rsp(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t atcc_get_urc(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t atcc_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 void atcc_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+uint8_t *atcc_getRxDataBuffer(at_context_t *p_at_ctxt, uint16_t *p_size);
 
 /**
   * @}
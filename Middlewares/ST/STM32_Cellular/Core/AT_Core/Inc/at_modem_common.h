@@ -47,6 +47,15 @@ extern "C" {
 #define MODEM_PDP_MAX_TYPE_SIZE    ((uint32_t) 8U)
 #define MODEM_PDP_MAX_APN_SIZE     ((uint32_t) 64U)
 #define MODEM_MAX_NB_PDP_CTXT      ((uint8_t) CS_PDN_CONFIG_MAX + 1U) /* max. nbr of local PDP context configs */
+
+/* Max number of LUT entries which can be indexed (bigger LUT fall back to the linear search) */
+#define ATCM_LUT_INDEX_MAX_SIZE    ((uint16_t) 128U)
+
+/* If ATCM_LUT_BENCHMARK activated, the received commands lookup (linear search versus indexed search)
+   is benchmarked at init on a replay of recorded modem traffic, result is displayed in the traces */
+#if !defined ATCM_LUT_BENCHMARK
+#define ATCM_LUT_BENCHMARK         (0U) /* 0: not activated, 1: activated */
+#endif /* !defined ATCM_LUT_BENCHMARK */
 /**
   * @}
   */
@@ -305,6 +314,7 @@ typedef struct
   uint32_t                   socket_current_connId;  /* connection ID for current command (only for received cmd) */
   uint32_t                   socket_rx_expected_buf_size; /* expected size of buffer to receive */
   uint32_t                   socket_rx_count_bytes_received; /* count number of char received actually for input buf */
+  at_bool_t                  socket_rx_zero_copy; /* data received directly in client buffer (not in IPC msg) */
   csint_socket_cnx_infos_t   *p_socket_cnx_infos;   /* SID_CS_SOCKET_CNX_STATUS */
 
   /* variables used for socket strings analyze */
@@ -314,10 +324,30 @@ typedef struct
 
 } atcustom_SOCKET_context_t;
 
+typedef struct
+{
+  uint8_t   lut_idx;   /* index of the command in the modem LUT */
+  uint8_t   hash;      /* hash of the command string */
+} atcustom_LUT_index_entry_t;
+
+typedef struct
+{
+  at_bool_t                    is_valid;    /* index built and usable */
+  /* entries sorted by command string length, LUT order is kept inside a bucket:
+   * commands of length L are entry[bucket_start[L]] to entry[bucket_start[L + 1] - 1] */
+  uint8_t                      bucket_start[ATCMD_MAX_NAME_SIZE + 1U];
+  atcustom_LUT_index_entry_t   entry[ATCM_LUT_INDEX_MAX_SIZE];
+} atcustom_LUT_index_t;
+
 typedef struct
 {
   uint32_t                           modem_LUT_size;
   const struct atcustom_LUT_struct   *p_modem_LUT;
+  atcustom_LUT_index_t               LUT_index; /* index used to search received commands in the LUT */
+
+  /* commands which can be concatenated on a single AT line (NULL if the modem does not support it) */
+  uint32_t                           pipeline_LUT_size;
+  const uint32_t                     *p_pipeline_LUT;
 
   /* received command syntax analysis: state of automaton which analyzes cmd syntax */
   atcustom_modem_SyntaxAutomatonState_t   state_SyntaxAutomaton;
@@ -369,6 +399,8 @@ const AT_CHAR_t       *atcm_get_CmdStr(const atcustom_modem_context_t *p_modem_c
 uint32_t               atcm_get_CmdTimeout(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
 CmdBuildFuncTypeDef    atcm_get_CmdBuildFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
 CmdAnalyzeFuncTypeDef  atcm_get_CmdAnalyzeFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
+at_bool_t              atcm_get_CmdPipelined(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
+uint16_t               atcm_get_CmdLutIdx(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
 const AT_CHAR_t       *atcm_get_PDPtypeStr(CS_PDPtype_t pdp_type);
 
 void atcm_program_AT_CMD(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt, at_type_t cmd_type,
@@ -403,6 +435,7 @@ void atcm_reset_SID_context(atcustom_SID_context_t *p_sid_ctxt);
 void atcm_reset_CMD_context(atcustom_CMD_context_t *p_cmd_ctxt);
 void atcm_reset_SOCKET_context(atcustom_modem_context_t *p_modem_ctxt);
 
+void atcm_build_LUT_index(atcustom_modem_context_t *p_modem_ctxt);
 at_status_t atcm_searchCmdInLUT(atcustom_modem_context_t *p_modem_ctxt,
                                 const atparser_context_t  *p_atp_ctxt,
                                 const IPC_RxMessage_t *p_msg_in,
@@ -44,6 +44,11 @@ extern "C" {
   */
 #define AT_CMD_DEFAULT_TIMEOUT    ((uint32_t)3000)
 #define AT_CMD_MAX_END_STR_SIZE   ((uint32_t)3)
+
+/* Max number of commands concatenated on a single AT line (AT+<x>;+<y>;...), 1 to deactivate pipelining */
+#if !defined AT_CMD_PIPELINE_MAX_SIZE
+#define AT_CMD_PIPELINE_MAX_SIZE  ((uint8_t)4U)
+#endif /* !defined AT_CMD_PIPELINE_MAX_SIZE */
 /**
   * @}
   */
@@ -57,16 +62,30 @@ typedef enum
   CMD_OPTIONAL_ANSWER_EXPECTED    = 1,
 } atparser_AnswerExpect_t;
 
+typedef struct
+{
+  uint32_t     id;
+  at_type_t    type;
+  uint8_t      is_final_cmd;
+  uint16_t     lut_idx;
+  uint8_t      name[ATCMD_MAX_NAME_SIZE];
+} atparser_pipelined_cmd_t;
+
 typedef struct
 {
   /* parameters set in AT Parser */
   at_msg_t             current_SID;     /* Current Service ID */
+  atparser_pipelined_cmd_t pipeline_cmd[AT_CMD_PIPELINE_MAX_SIZE]; /* commands sent on current AT line */
+  uint8_t                  pipeline_nb;  /* number of commands sent on current AT line */
+  uint8_t                  pipeline_idx; /* index of the command whose answer is analyzed */
+  at_bool_t                pipeline_answered; /* answer to command pipeline_idx received */
 
   /* parameters set in AT Custom */
   uint8_t                  step;            /* indicates which step in current SID treatment */
   atparser_AnswerExpect_t  answer_expected; /* expected answer type for this command */
   uint8_t                  is_final_cmd;    /* is it last command in current SID treatment ? */
   atcmd_desc_t             current_atcmd;   /* current AT command to send parameters */
+  at_bool_t                pipeline_allowed; /* current cmd can be concatenated with next cmd of the SID */
   uint8_t                  endstr[AT_CMD_MAX_END_STR_SIZE];  /* termination string for AT cmd */
   uint32_t                 cmd_timeout;     /* command timeout value */
 
@@ -115,7 +134,8 @@ typedef struct
   * @{
   */
 at_status_t ATParser_initParsers(sysctrl_device_type_t device_type);
-void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback);
+void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback,
+                   IPC_CheckEndOfMsgSpanCallbackTypeDef *p_checkEndOfMsgSpanCallback);
 void ATParser_process_request(at_context_t *p_at_ctxt,
                               at_msg_t msg_id, at_buf_t *p_cmd_buf);
 at_action_send_t ATParser_get_ATcmd(at_context_t *p_at_ctxt,
@@ -126,6 +146,7 @@ at_status_t ATParser_get_rsp(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATParser_get_urc(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATParser_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 void        ATParser_abort_request(at_context_t *p_at_ctxt);
+uint8_t     *ATParser_get_rx_data_buffer(at_context_t *p_at_ctxt, uint16_t *p_size);
 
 /**
   * @}
@@ -54,6 +54,10 @@ uint32_t ATutil_extract_hex_value_from_quotes(const uint8_t *p_str, uint16_t str
 uint32_t ATutil_extract_bin_value_from_quotes(const uint8_t *p_str, uint16_t str_size, uint8_t param_size);
 uint32_t ATutil_convert_T3412_to_seconds(uint32_t encoded_value);
 uint32_t ATutil_convert_T3324_to_seconds(uint32_t encoded_value);
+uint16_t ATutil_findChar(const uint8_t *p_buf, uint16_t size, uint8_t character);
+uint8_t  ATutil_isPrefix(const uint8_t *p_buf, uint16_t size, const uint8_t *p_prefix, uint16_t prefix_size);
+void     ATutil_convertBufferToHexaString(const uint8_t *p_src, uint16_t src_size, uint8_t *p_dst);
+uint8_t  ATutil_convertHexaStringToBuffer(const uint8_t *p_src, uint16_t dst_size, uint8_t *p_dst);
 /**
   * @}
   */
@@ -27,6 +27,9 @@
 #include "plf_config.h"
 /* following file added to check SID for DATA suspend/resume cases */
 #include "cellular_service_int.h"
+#if ((AT_CORE_STATISTIC == 1U) && (USE_CMD_CONSOLE == 1))
+#include "cmd.h"
+#endif /* (AT_CORE_STATISTIC == 1U) && (USE_CMD_CONSOLE == 1) */
 
 /** @addtogroup AT_CORE AT_CORE
   * @{
@@ -57,6 +60,16 @@
 #endif /* USE_TRACE_ATCORE */
 
 #define LOG_ERROR(ErrId, gravity)   ERROR_Handler(DBG_CHAN_ATCMD, (ErrId), (gravity))
+
+#if ((AT_CORE_STATISTIC == 1U) && (USE_CMD_CONSOLE == 1))
+#if (USE_PRINTF == 0U)
+#include "trace_interface.h"
+#define PRINT_FORCE(format, args...) TRACE_PRINT_FORCE(DBG_CHAN_ATCMD, DBL_LVL_P0, "" format "\n\r", ## args)
+#else
+#include <stdio.h>
+#define PRINT_FORCE(format, args...)   (void)printf("" format "\n\r", ## args);
+#endif /* USE_PRINTF */
+#endif /* (AT_CORE_STATISTIC == 1U) && (USE_CMD_CONSOLE == 1) */
 /**
   * @}
   */
@@ -71,9 +84,40 @@
 #define MSG_IPC_RECEIVED_SIZE (uint32_t) ((uint16_t) 128U)
 #define SIG_IPC_MSG                      (1U) /* signals definition for IPC message queue */
 #define SIG_INTERNAL_EVENT_MODEM         (2U) /* signals definition for internal event from the cellular modem */
+
+#if (AT_CORE_STATISTIC == 1U)
+#define AT_STAT_NAME_SIZE       (16U) /* size of the AT command name kept in the statistics */
+#define AT_STAT_BUCKET_NB       (16U) /* number of buckets of the log2 histograms */
+#define AT_STAT_BUCKET_SHIFT    (6U)  /* bucket 0: < 64us, bucket n: [2^(n+5), 2^(n+6)[ us, last one: more */
+#define AT_STAT_CMD_ARG_MAX_NB  (2U)  /* number max of arguments of 'atstat' command */
+
+/* Phases of an AT transaction measured from the start of the command sending */
+#define AT_STAT_PHASE_TX        (0U) /* command sent on the UART */
+#define AT_STAT_PHASE_FIRST_RSP (1U) /* first message received from the modem */
+#define AT_STAT_PHASE_FINAL     (2U) /* final result of the command processed */
+#define AT_STAT_PHASE_NB        (3U)
+#endif /* AT_CORE_STATISTIC == 1U */
+/**
+  * @}
+  */
+
+#if (AT_CORE_STATISTIC == 1U)
+/** @defgroup AT_CORE_CORE_Private_Types AT_CORE CORE Private Types
+  * @{
+  */
+typedef struct
+{
+  uint32_t cmd_id;                                        /* AT command ID (from the modem LUT)             */
+  uint8_t  name[AT_STAT_NAME_SIZE];                       /* AT command name                                */
+  uint32_t count;                                         /* number of transactions measured                */
+  uint32_t errors;                                        /* number of transactions failed (not measured)   */
+  uint32_t max_us[AT_STAT_PHASE_NB];                      /* maximum latency of each phase                  */
+  uint16_t histo[AT_STAT_PHASE_NB][AT_STAT_BUCKET_NB];    /* latency histogram of each phase (saturated)    */
+} at_stat_cmd_t;
 /**
   * @}
   */
+#endif /* AT_CORE_STATISTIC == 1U */
 
 /** @defgroup AT_CORE_CORE_Private_Variables AT_CORE CORE Private Variables
   * @{
@@ -85,6 +129,7 @@ static urc_callback_t  register_URC_callback;
 static IPC_RxMessage_t msgFromIPC;       /* IPC msg */
 static __IO uint8_t    MsgReceived = 0U; /* received IPC msg counter */
 static IPC_CheckEndOfMsgCallbackTypeDef custom_checkEndOfMsgCallback = NULL;
+static IPC_CheckEndOfMsgSpanCallbackTypeDef custom_checkEndOfMsgSpanCallback = NULL;
 /* this semaphore is used for waiting for an answer from Modem */
 static osSemaphoreId s_WaitAnswer_SemaphoreId = NULL;
 /* this queue is used by IPC to inform that messages are ready to be retrieved */
@@ -94,6 +139,15 @@ static osMessageQId q_msg_IPC_received_Id;
 #if (USE_PARSING_MUTEX == 1)
 static osMutexId ATCore_ParsingMutexHandle;
 #endif /* USE_PARSING_MUTEX == 1 */
+
+#if (AT_CORE_STATISTIC == 1U)
+static at_stat_cmd_t at_stat_cmd[AT_CORE_STATISTIC_LUT_SIZE]; /* statistics of the AT commands (LUT position) */
+static uint32_t at_stat_dropped;                     /* transactions not measured: command out of the LUT */
+static uint32_t at_stat_pipelined;                   /* transactions not measured: several commands per line */
+static uint32_t at_stat_cycles[AT_STAT_PHASE_NB + 1U]; /* DWT timestamps of the transaction: start + phases */
+static __IO uint8_t at_stat_wait_first_rsp;          /* first response timestamp expected */
+static at_stat_cmd_t *at_stat_p_cmd;                 /* statistics of the AT transaction measured */
+#endif /* AT_CORE_STATISTIC == 1U */
 /**
   * @}
   */
@@ -108,10 +162,20 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
 static at_status_t waitOnMsgUntilTimeout(uint32_t Tickstart, uint32_t Timeout);
 static at_status_t sendToIPC(uint8_t *cmdBuf, uint16_t cmdSize);
 static at_status_t waitFromIPC(uint32_t tickstart, uint32_t cmdTimeout, IPC_RxMessage_t *p_msg);
+static IPC_Status_t receiveFromIPC(IPC_RxMessage_t *p_msg);
 static at_action_rsp_t process_answer(at_action_send_t action_send, uint32_t at_cmd_timeout);
 static at_action_rsp_t analyze_action_result(at_action_rsp_t val);
 static void IRQ_DISABLE(void);
 static void IRQ_ENABLE(void);
+#if (AT_CORE_STATISTIC == 1U)
+static void at_stat_start(const atparser_context_t *p_atp_ctxt);
+static void at_stat_stop(at_status_t status);
+static uint8_t at_stat_bucket(uint32_t latency_us);
+#if (USE_CMD_CONSOLE == 1)
+static void at_stat_display(void);
+static void at_stat_console_cmd(uint8_t *p_cmd_line);
+#endif /* USE_CMD_CONSOLE == 1 */
+#endif /* AT_CORE_STATISTIC == 1U */
 /**
   * @}
   */
@@ -220,7 +284,7 @@ at_handle_t  AT_open(sysctrl_info_t *p_device_infos, urc_callback_t urc_callback
         register_URC_callback = urc_callback;
 
         /* init the ATParser */
-        ATParser_init(&at_context, &custom_checkEndOfMsgCallback);
+        ATParser_init(&at_context, &custom_checkEndOfMsgCallback, &custom_checkEndOfMsgSpanCallback);
       }
       else
       {
@@ -262,6 +326,8 @@ at_status_t  AT_open_channel(at_handle_t athandle)
                  NULL,
                  custom_checkEndOfMsgCallback) == IPC_OK)
     {
+      /* Register the span variant of the end of message callback if the modem provides it */
+      (void) IPC_setCheckEndOfMsgSpanCallback(at_context.ipc_handle, custom_checkEndOfMsgSpanCallback);
 
       /* Select the IPC opened channel as current channel */
       if (IPC_select(at_context.ipc_handle) == IPC_OK)
@@ -519,6 +585,14 @@ at_status_t atcore_task_start(osPriority taskPrio, uint16_t stackSize)
       else
       {
         retval = ATSTATUS_OK;
+#if (AT_CORE_STATISTIC == 1U)
+        /* enable cycle counter used to timestamp the AT transactions */
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#if (USE_CMD_CONSOLE == 1)
+        CMD_Declare((uint8_t *)"atstat", at_stat_console_cmd, (uint8_t *)"AT transactions latency statistics");
+#endif /* USE_CMD_CONSOLE == 1 */
+#endif /* AT_CORE_STATISTIC == 1U */
       }
     }
   }
@@ -544,6 +618,13 @@ static void msgReceivedCallback(IPC_Handle_t *ipcHandle)
   /* Warning ! this function is called under IT
    * disable irq not required, we are under IT */
   MsgReceived++;
+#if (AT_CORE_STATISTIC == 1U)
+  if (at_stat_wait_first_rsp == 1U)
+  {
+    at_stat_cycles[AT_STAT_PHASE_FIRST_RSP + 1U] = DWT->CYCCNT;
+    at_stat_wait_first_rsp = 0U;
+  }
+#endif /* AT_CORE_STATISTIC == 1U */
   if (rtosalMessageQueuePut(q_msg_IPC_received_Id,
                             (uint32_t)SIG_IPC_MSG, (uint32_t)0U) != osOK)
   {
@@ -760,6 +841,9 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
         }
         else
         {
+#if (AT_CORE_STATISTIC == 1U)
+          at_stat_start(&at_context.parser);
+#endif /* AT_CORE_STATISTIC == 1U */
           retval = sendToIPC((uint8_t *)&build_atcmd[0], build_atcmd_size);
           if (retval != ATSTATUS_OK)
           {
@@ -767,6 +851,16 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
             LOG_ERROR(9, ERROR_WARNING);
             retval = ATSTATUS_ERROR;
           }
+#if (AT_CORE_STATISTIC == 1U)
+          if (retval == ATSTATUS_OK)
+          {
+            at_stat_cycles[AT_STAT_PHASE_TX + 1U] = DWT->CYCCNT;
+          }
+          else
+          {
+            at_stat_stop(ATSTATUS_ERROR);
+          }
+#endif /* AT_CORE_STATISTIC == 1U */
         }
       }
 
@@ -782,6 +876,12 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
             /* this is not the last command */
             another_cmd_to_send = 1U;
           }
+#if (AT_CORE_STATISTIC == 1U)
+          if (build_atcmd_size > 0U)
+          {
+            at_stat_stop((action_rsp == ATACTION_RSP_ERROR) ? ATSTATUS_ERROR : ATSTATUS_OK);
+          }
+#endif /* AT_CORE_STATISTIC == 1U */
         }
         else
         {
@@ -873,6 +973,33 @@ static at_status_t waitFromIPC(uint32_t tickstart, uint32_t cmdTimeout, IPC_RxMe
   return (retval);
 }
 
+/**
+  * @brief  Read next received message from IPC.
+  * @note   If the modem indicates that next message is a data payload (for example socket data),
+  *         the payload is copied directly from IPC to the client buffer and only the rest of
+  *         the message is copied to p_msg.
+  * @param  p_msg Pointer to message received from IPC.
+  * @retval IPC_Status_t.
+  */
+static IPC_Status_t receiveFromIPC(IPC_RxMessage_t *p_msg)
+{
+  IPC_Status_t retval;
+  uint16_t data_size;
+  uint8_t *p_data = ATParser_get_rx_data_buffer(&at_context, &data_size);
+
+  if (p_data != NULL)
+  {
+    TRACE_DBG("receive %d bytes of data directly in client buffer", data_size)
+    retval = IPC_receiveData(&ipcHandleTab, p_data, &data_size, p_msg);
+  }
+  else
+  {
+    retval = IPC_receive(&ipcHandleTab, p_msg);
+  }
+
+  return (retval);
+}
+
 /**
   * @brief  Analyze action bitmap.
   * @param  val Action bitmap.
@@ -943,6 +1070,207 @@ static void IRQ_ENABLE(void)
   __enable_irq();
 }
 
+#if (AT_CORE_STATISTIC == 1U)
+/**
+  * @brief  Start the measure of an AT transaction.
+  * @note   The statistics are selected by the position of the command in the modem LUT.
+  *         A line with several pipelined commands is only counted: its latency can not be charged to one command.
+  * @param  p_atp_ctxt Pointer to the parser context of the command sent.
+  * @retval none.
+  */
+static void at_stat_start(const atparser_context_t *p_atp_ctxt)
+{
+  const atcmd_desc_t *p_atcmd = &p_atp_ctxt->current_atcmd;
+
+  at_stat_p_cmd = NULL;
+  if (p_atp_ctxt->pipeline_nb > 1U)
+  {
+    at_stat_pipelined++;
+  }
+  else if (p_atcmd->lut_idx >= AT_CORE_STATISTIC_LUT_SIZE)
+  {
+    at_stat_dropped++;
+  }
+  else
+  {
+    at_stat_p_cmd = &at_stat_cmd[p_atcmd->lut_idx];
+    if ((at_stat_p_cmd->count + at_stat_p_cmd->errors) == 0U)
+    {
+      at_stat_p_cmd->cmd_id = p_atcmd->id;
+      (void) memcpy((void *)&at_stat_p_cmd->name[0], (const void *)&p_atcmd->name[0], AT_STAT_NAME_SIZE - 1U);
+      at_stat_p_cmd->name[AT_STAT_NAME_SIZE - 1U] = 0U;
+    }
+  }
+
+  at_stat_cycles[AT_STAT_PHASE_FIRST_RSP + 1U] = 0U;
+  at_stat_cycles[0] = DWT->CYCCNT;
+  /* first message received from now is timestamped by msgReceivedCallback */
+  at_stat_wait_first_rsp = 1U;
+}
+
+/**
+  * @brief  Convert a latency to its histogram bucket.
+  * @param  latency_us Latency in us.
+  * @retval uint8_t Bucket index.
+  */
+static uint8_t at_stat_bucket(uint32_t latency_us)
+{
+  uint32_t value = latency_us >> AT_STAT_BUCKET_SHIFT;
+  uint32_t bucket;
+
+  /* bucket n >= 1 contains the latencies whose highest bit set is bit (n + AT_STAT_BUCKET_SHIFT - 1) */
+  bucket = (value == 0U) ? 0U : (32U - (uint32_t)__CLZ(value));
+  if (bucket >= AT_STAT_BUCKET_NB)
+  {
+    bucket = AT_STAT_BUCKET_NB - 1U;
+  }
+
+  return ((uint8_t)bucket);
+}
+
+/**
+  * @brief  Stop the measure of an AT transaction and update the statistics of the AT command.
+  * @param  status Status of the AT transaction (latencies are recorded only if ATSTATUS_OK).
+  * @retval none.
+  */
+static void at_stat_stop(at_status_t status)
+{
+  uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+  uint32_t latency_us;
+  uint8_t phase;
+  uint8_t bucket;
+  at_stat_cmd_t *p_stat = at_stat_p_cmd;
+
+  at_stat_cycles[AT_STAT_PHASE_FINAL + 1U] = DWT->CYCCNT;
+  at_stat_wait_first_rsp = 0U;
+  at_stat_p_cmd = NULL;
+
+  if (p_stat == NULL)
+  {
+    /* transaction not measured, already counted by at_stat_start */
+    __NOP();
+  }
+  else if (status != ATSTATUS_OK)
+  {
+    p_stat->errors++;
+  }
+  else
+  {
+    p_stat->count++;
+    for (phase = 0U; phase < AT_STAT_PHASE_NB; phase++)
+    {
+      /* no first response timestamp if the modem did not answer (temporisation) */
+      if (at_stat_cycles[phase + 1U] != 0U)
+      {
+        /* unsigned difference manages the cycle counter wrap-around */
+        latency_us = (at_stat_cycles[phase + 1U] - at_stat_cycles[0]) / cycles_per_us;
+        bucket = at_stat_bucket(latency_us);
+        if (p_stat->histo[phase][bucket] < 0xFFFFU)
+        {
+          p_stat->histo[phase][bucket]++;
+        }
+        if (latency_us > p_stat->max_us[phase])
+        {
+          p_stat->max_us[phase] = latency_us;
+        }
+      }
+    }
+  }
+}
+
+#if (USE_CMD_CONSOLE == 1)
+/**
+  * @brief  Display the AT transactions latency statistics.
+  * @retval none.
+  */
+static void at_stat_display(void)
+{
+  uint16_t i;
+  uint8_t bucket;
+  uint32_t lower_us;
+
+  PRINT_FORCE("AT transactions latency from command send start (us): tx / first rsp / final")
+  for (i = 0U; i < AT_CORE_STATISTIC_LUT_SIZE; i++)
+  {
+    const at_stat_cmd_t *p_stat = &at_stat_cmd[i];
+
+    if ((p_stat->count + p_stat->errors) != 0U)
+    {
+      PRINT_FORCE("cmd %ld %s: ok:%ld nok:%ld max:%ld/%ld/%ld", p_stat->cmd_id, p_stat->name,
+                  p_stat->count, p_stat->errors, p_stat->max_us[AT_STAT_PHASE_TX],
+                  p_stat->max_us[AT_STAT_PHASE_FIRST_RSP], p_stat->max_us[AT_STAT_PHASE_FINAL])
+      for (bucket = 0U; bucket < AT_STAT_BUCKET_NB; bucket++)
+      {
+        if ((p_stat->histo[AT_STAT_PHASE_TX][bucket] + p_stat->histo[AT_STAT_PHASE_FIRST_RSP][bucket]
+             + p_stat->histo[AT_STAT_PHASE_FINAL][bucket]) != 0U)
+        {
+          lower_us = (bucket == 0U) ? 0U : ((uint32_t)1U << (AT_STAT_BUCKET_SHIFT + (uint32_t)bucket - 1U));
+          PRINT_FORCE("  >=%8ld: %5d %5d %5d", lower_us, p_stat->histo[AT_STAT_PHASE_TX][bucket],
+                      p_stat->histo[AT_STAT_PHASE_FIRST_RSP][bucket], p_stat->histo[AT_STAT_PHASE_FINAL][bucket])
+        }
+      }
+    }
+  }
+  if (at_stat_pipelined != 0U)
+  {
+    PRINT_FORCE("transactions not measured (pipelined commands): %ld", at_stat_pipelined)
+  }
+  if (at_stat_dropped != 0U)
+  {
+    PRINT_FORCE("transactions not measured (command out of LUT): %ld", at_stat_dropped)
+  }
+}
+
+/**
+  * @brief  'atstat' console command management.
+  * @param  p_cmd_line Pointer on command parameters.
+  * @retval none.
+  */
+static void at_stat_console_cmd(uint8_t *p_cmd_line)
+{
+  uint32_t argc;
+  uint8_t  *p_argv[AT_STAT_CMD_ARG_MAX_NB];
+  const uint8_t *p_cmd;
+
+  PRINT_FORCE("")
+  p_cmd = (uint8_t *)strtok((CRC_CHAR_t *)p_cmd_line, " \t");
+
+  if ((p_cmd != NULL) && (memcmp((const CRC_CHAR_t *)p_cmd, "atstat", crs_strlen(p_cmd)) == 0))
+  {
+    /* parameters parsing */
+    for (argc = 0U; argc < AT_STAT_CMD_ARG_MAX_NB; argc++)
+    {
+      p_argv[argc] = (uint8_t *)strtok(NULL, " \t");
+      if (p_argv[argc] == NULL)
+      {
+        break;
+      }
+    }
+
+    if (argc == 0U)
+    {
+      /* cmd 'atstat': display statistics */
+      at_stat_display();
+    }
+    else if (memcmp((CRC_CHAR_t *)p_argv[0], "reset", crs_strlen(p_argv[0])) == 0)
+    {
+      /* cmd 'atstat reset': reset statistics */
+      (void) memset((void *)at_stat_cmd, 0, sizeof(at_stat_cmd));
+      at_stat_dropped = 0U;
+      at_stat_pipelined = 0U;
+      PRINT_FORCE("atstat: statistics reset")
+    }
+    else
+    {
+      CMD_print_help((uint8_t *)"atstat");
+      PRINT_FORCE("atstat       : display AT transactions latency histograms")
+      PRINT_FORCE("atstat reset : reset AT transactions latency histograms")
+    }
+  }
+}
+#endif /* USE_CMD_CONSOLE == 1 */
+#endif /* AT_CORE_STATISTIC == 1U */
+
 /**
   * @brief  Core of AT task.
   * @param  argument Pointer to task arguments.
@@ -972,7 +1300,7 @@ static void ATCoreTaskBody(void *argument)
       if (msg == (SIG_IPC_MSG))
       {
         /* retrieve message from IPC */
-        if (IPC_receive(&ipcHandleTab, &msgFromIPC) == IPC_ERROR)
+        if (receiveFromIPC(&msgFromIPC) == IPC_ERROR)
         {
           TRACE_DBG("IPC receive error")
           ATParser_abort_request(&at_context);
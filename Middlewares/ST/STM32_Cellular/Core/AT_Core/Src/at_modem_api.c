@@ -118,6 +118,18 @@ ATC_checkEndOfMsgCallbackTypeDef atcc_checkEndOfMsgCallback(const at_context_t *
   return (at_custom_func[p_at_ctxt->device_type].f_checkEndOfMsgCallback);
 }
 
+/**
+  * @brief  Callback modem function to search end of message in a span of received characters.
+  * @note  This function is called by the IPC to split the received spans in messages (optional, can be NULL).
+  * @param  p_at_ctxt Pointer to the modem context.
+  * @retval none
+  */
+ATC_checkEndOfMsgSpanCallbackTypeDef atcc_checkEndOfMsgSpanCallback(const at_context_t *p_at_ctxt)
+{
+  /* called under interruption, do not put trace here */
+  return (at_custom_func[p_at_ctxt->device_type].f_checkEndOfMsgSpanCallback);
+}
+
 /**
   * @brief  Call modem function to retrieve next AT command to send for the requested service.
   * @note   This functions can be called many times for a service if required.
@@ -278,6 +290,28 @@ void atcc_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO
   }
 }
 
+/**
+  * @brief  Call modem function to get the client buffer where the next received message (data payload)
+  *         has to be copied directly.
+  * @note   This function is called before to read the next message from IPC.
+  * @param  p_at_ctxt Pointer to the modem context.
+  * @param  p_size Pointer to the size of the data payload to copy in the client buffer.
+  * @retval uint8_t* Pointer to the client buffer, NULL if next message is not a data payload
+  *         or if the modem does not support it.
+  */
+uint8_t *atcc_getRxDataBuffer(at_context_t *p_at_ctxt, uint16_t *p_size)
+{
+  uint8_t *p_buffer = NULL;
+
+  *p_size = 0U;
+  if (at_custom_func[p_at_ctxt->device_type].f_getRxDataBuffer != NULL)
+  {
+    p_buffer = (*at_custom_func[p_at_ctxt->device_type].f_getRxDataBuffer)(&p_at_ctxt->parser, p_size);
+  }
+
+  return (p_buffer);
+}
+
 /**
   * @}
   */
@@ -64,9 +64,50 @@
   * @}
   */
 
+/** @defgroup AT_CORE_COMMON_Private_Defines AT_CORE COMMON Private Defines
+  * @{
+  */
+#define LUT_ENTRY_NOT_FOUND     ((uint16_t) 0xFFFFU)
+#if (ATCM_LUT_BENCHMARK == 1U)
+#define LUT_BENCHMARK_LOOPS     ((uint16_t) 100U)
+#endif /* ATCM_LUT_BENCHMARK == 1U */
+/**
+  * @}
+  */
+
+#if (ATCM_LUT_BENCHMARK == 1U)
+/** @defgroup AT_CORE_COMMON_Private_Variables AT_CORE COMMON Private Variables
+  * @{
+  */
+/* command names searched by the LUT benchmark: hand-picked answers and URC of the BG96, TYPE1SC and MONARCH
+   modems (not a capture of modem traffic), the names of the other modems measure the search of unknown names */
+static const AT_CHAR_t *const LUT_benchmark_traffic[] =
+{
+  (const AT_CHAR_t *)"OK",          (const AT_CHAR_t *)"+CSQ",        (const AT_CHAR_t *)"+CEREG",
+  (const AT_CHAR_t *)"+CGEV",       (const AT_CHAR_t *)"+QIURC",      (const AT_CHAR_t *)"+QIRD",
+  (const AT_CHAR_t *)"OK",          (const AT_CHAR_t *)"SEND OK",     (const AT_CHAR_t *)"%SOCKETEV",
+  (const AT_CHAR_t *)"%SOCKETDATA", (const AT_CHAR_t *)"%SOCKETCMD",  (const AT_CHAR_t *)"+SQNSRING",
+  (const AT_CHAR_t *)"+SQNSRECV",   (const AT_CHAR_t *)"+CME ERROR",  (const AT_CHAR_t *)"ERROR",
+  (const AT_CHAR_t *)"+CPIN",       (const AT_CHAR_t *)"+CGPADDR",    (const AT_CHAR_t *)"%NOTIFYEV",
+  (const AT_CHAR_t *)"RDY",         (const AT_CHAR_t *)"UNKNOWN_URC",
+};
+#define LUT_BENCHMARK_TRAFFIC_SIZE ((uint16_t) (sizeof(LUT_benchmark_traffic) / sizeof(LUT_benchmark_traffic[0])))
+/**
+  * @}
+  */
+#endif /* ATCM_LUT_BENCHMARK == 1U */
+
 /** @defgroup AT_CORE_COMMON_Private_Functions_Prototypes AT_CORE COMMON Private Functions Prototypes
   * @{
   */
+static uint8_t LUT_hash(const AT_CHAR_t *p_str, uint16_t size);
+static uint16_t LUT_search_linear(const atcustom_modem_context_t *p_modem_ctxt,
+                                  const AT_CHAR_t *p_str, uint16_t size);
+static uint16_t LUT_search_indexed(const atcustom_modem_context_t *p_modem_ctxt,
+                                   const AT_CHAR_t *p_str, uint16_t size);
+#if (ATCM_LUT_BENCHMARK == 1U)
+static void LUT_benchmark(const atcustom_modem_context_t *p_modem_ctxt);
+#endif /* ATCM_LUT_BENCHMARK == 1U */
 static void reserve_user_modem_cid(atcustom_persistent_context_t *p_persistent_ctxt,
                                    CS_PDN_conf_id_t conf_id,
                                    uint8_t reserved_modem_cid);
@@ -434,6 +475,58 @@ CmdAnalyzeFuncTypeDef atcm_get_CmdAnalyzeFunc(const atcustom_modem_context_t *p_
   return (retval);
 }
 
+/**
+  * @brief  Check if a command can be concatenated with other commands on a single AT line
+  *
+  * @param  p_modem_ctxt Pointer to modem context.
+  * @param  cmd_id Id of the command to check
+  * @retval AT_TRUE if the command is in the modem pipeline LUT
+  */
+at_bool_t atcm_get_CmdPipelined(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
+{
+  at_bool_t retval = AT_FALSE;
+
+  if ((cmd_id != CMD_AT_INVALID) && (p_modem_ctxt->p_pipeline_LUT != NULL))
+  {
+    /* search in pipeline LUT the cmd ID */
+    for (uint16_t i = 0U; (retval == AT_FALSE) && (i < p_modem_ctxt->pipeline_LUT_size); i++)
+    {
+      if (p_modem_ctxt->p_pipeline_LUT[i] == cmd_id)
+      {
+        retval = AT_TRUE;
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Search the position of a command Id in the modem LUT
+  *
+  * @param  p_modem_ctxt Pointer to modem context.
+  * @param  cmd_id Id of the command to find
+  * @retval position in the LUT (ATCMD_LUT_IDX_NONE if not found)
+  */
+uint16_t atcm_get_CmdLutIdx(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
+{
+  uint16_t retval = ATCMD_LUT_IDX_NONE;
+
+  if (cmd_id != CMD_AT_INVALID)
+  {
+    /* search in LUT the cmd ID */
+    for (uint16_t i = 0U; (retval == ATCMD_LUT_IDX_NONE) && (i < p_modem_ctxt->modem_LUT_size); i++)
+    {
+      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
+      {
+        retval = i;
+      }
+    }
+  }
+
+  return (retval);
+}
+
 /**
   * @brief  Get type of PDP address
   * @param  pdp_type
@@ -492,9 +585,14 @@ void atcm_program_AT_CMD(atcustom_modem_context_t *p_modem_ctxt,
   p_atp_ctxt->is_final_cmd = (final == FINAL_CMD) ? 1U : 0U;
   /* is an answer is expected ? */
   p_atp_ctxt->answer_expected = CMD_MANDATORY_ANSWER_EXPECTED;
+  /* can it be concatenated with next command ? */
+  p_atp_ctxt->pipeline_allowed = atcm_get_CmdPipelined(p_modem_ctxt, cmd_id);
+  /* position in LUT */
+  p_atp_ctxt->current_atcmd.lut_idx = atcm_get_CmdLutIdx(p_modem_ctxt, cmd_id);
 
   /* set command timeout according to LUT */
-  p_atp_ctxt->cmd_timeout =  atcm_get_CmdTimeout(p_modem_ctxt, p_atp_ctxt->current_atcmd.id);
+  p_atp_ctxt->cmd_timeout = (p_atp_ctxt->current_atcmd.lut_idx == ATCMD_LUT_IDX_NONE) ? MODEM_DEFAULT_TIMEOUT :
+                            p_modem_ctxt->p_modem_LUT[p_atp_ctxt->current_atcmd.lut_idx].cmd_timeout;
 }
 
 /**
@@ -519,9 +617,12 @@ void atcm_program_AT_CMD_ANSWER_OPTIONAL(atcustom_modem_context_t *p_modem_ctxt,
   p_atp_ctxt->is_final_cmd = (final == FINAL_CMD) ? 1U : 0U;
   /* is an answer is expected ? */
   p_atp_ctxt->answer_expected = CMD_OPTIONAL_ANSWER_EXPECTED;
+  /* position in LUT */
+  p_atp_ctxt->current_atcmd.lut_idx = atcm_get_CmdLutIdx(p_modem_ctxt, cmd_id);
 
   /* set command timeout according to LUT */
-  p_atp_ctxt->cmd_timeout =  atcm_get_CmdTimeout(p_modem_ctxt, p_atp_ctxt->current_atcmd.id);
+  p_atp_ctxt->cmd_timeout = (p_atp_ctxt->current_atcmd.lut_idx == ATCMD_LUT_IDX_NONE) ? MODEM_DEFAULT_TIMEOUT :
+                            p_modem_ctxt->p_modem_LUT[p_atp_ctxt->current_atcmd.lut_idx].cmd_timeout;
 }
 
 /**
@@ -559,6 +660,7 @@ void atcm_program_WAIT_EVENT(atparser_context_t *p_atp_ctxt, uint32_t tempo_valu
   p_atp_ctxt->current_atcmd.type = ATTYPE_NO_CMD;
   /* command id */
   p_atp_ctxt->current_atcmd.id = CMD_AT_INVALID;
+  p_atp_ctxt->current_atcmd.lut_idx = ATCMD_LUT_IDX_NONE;
   /* is it final command ? */
   p_atp_ctxt->is_final_cmd = (final == FINAL_CMD) ? 1U : 0U;
   /* is an answer is expected ? */
@@ -580,6 +682,7 @@ void atcm_program_TEMPO(atparser_context_t *p_atp_ctxt, uint32_t tempo_value, at
   p_atp_ctxt->current_atcmd.type = ATTYPE_NO_CMD;
   /* command id */
   p_atp_ctxt->current_atcmd.id = CMD_AT_INVALID;
+  p_atp_ctxt->current_atcmd.lut_idx = ATCMD_LUT_IDX_NONE;
   /* is it final command ? */
   p_atp_ctxt->is_final_cmd = (final == FINAL_CMD) ? 1U : 0U;
   /* is an answer is expected ? */
@@ -601,6 +704,7 @@ void atcm_program_NO_MORE_CMD(atparser_context_t *p_atp_ctxt)
   p_atp_ctxt->current_atcmd.type = ATTYPE_NO_CMD;
   /* command id */
   p_atp_ctxt->current_atcmd.id = CMD_AT_INVALID;
+  p_atp_ctxt->current_atcmd.lut_idx = ATCMD_LUT_IDX_NONE;
   /* is it final command ? */
   p_atp_ctxt->is_final_cmd = 1U;
   /* is an answer is expected ? */
@@ -620,6 +724,7 @@ void atcm_program_SKIP_CMD(atparser_context_t *p_atp_ctxt)
   p_atp_ctxt->current_atcmd.type = ATTYPE_NO_CMD;
   /* command id */
   p_atp_ctxt->current_atcmd.id = CMD_AT_INVALID;
+  p_atp_ctxt->current_atcmd.lut_idx = ATCMD_LUT_IDX_NONE;
   /* is it final command ? */
   p_atp_ctxt->is_final_cmd = 0U;
   /* is an answer is expected ? */
@@ -637,6 +742,10 @@ void atcm_modem_init(atcustom_modem_context_t *p_modem_ctxt)
 {
   PRINT_API("enter atcm_modem_init")
 
+  /* no command pipelining by default (set by the modem if supported) */
+  p_modem_ctxt->pipeline_LUT_size = 0U;
+  p_modem_ctxt->p_pipeline_LUT = NULL;
+
   /* reset all contexts at init */
   atcm_reset_persistent_context(&p_modem_ctxt->persist);
   atcm_reset_SID_context(&p_modem_ctxt->SID_ctxt);
@@ -1811,12 +1920,86 @@ void atcm_reset_SOCKET_context(atcustom_modem_context_t *p_modem_ctxt)
   p_modem_ctxt->socket_ctxt.socket_current_connId = 0U;
   p_modem_ctxt->socket_ctxt.socket_rx_expected_buf_size = 0U;
   p_modem_ctxt->socket_ctxt.socket_rx_count_bytes_received = 0U;
+  p_modem_ctxt->socket_ctxt.socket_rx_zero_copy = AT_FALSE;
 
   p_modem_ctxt->socket_ctxt.socket_send_state = SocketSendState_No_Activity;
   p_modem_ctxt->socket_ctxt.socket_receive_state = SocketRcvState_No_Activity;
   p_modem_ctxt->socket_ctxt.socket_RxData_state = SocketRxDataState_not_started;
 }
 
+/**
+  * @brief  atcm_build_LUT_index
+  * @note   Build the index used to search the received AT commands in the modem LookUp table (LUT).
+  *         Commands are grouped by string length and a hash of each string is precomputed, so that
+  *         a received command is only compared to the LUT commands of same length and same hash.
+  *         Has to be called each time p_modem_LUT or modem_LUT_size are modified.
+  * @param  p_modem_ctxt Pointer to modem context.
+  * @retval none
+  */
+void atcm_build_LUT_index(atcustom_modem_context_t *p_modem_ctxt)
+{
+  atcustom_LUT_index_t *p_index = &p_modem_ctxt->LUT_index;
+  uint8_t next_entry[ATCMD_MAX_NAME_SIZE + 1U];
+  uint16_t i;
+  uint16_t len;
+
+  p_index->is_valid = AT_FALSE;
+  (void) memset((void *) p_index->bucket_start, 0, sizeof(p_index->bucket_start));
+  (void) memset((void *) next_entry, 0, sizeof(next_entry));
+
+#if (AT_CORE_STATISTIC == 1U)
+  if (p_modem_ctxt->modem_LUT_size > AT_CORE_STATISTIC_LUT_SIZE)
+  {
+    PRINT_ERR("LUT size %ld > AT_CORE_STATISTIC_LUT_SIZE: last commands not measured", p_modem_ctxt->modem_LUT_size)
+  }
+#endif /* AT_CORE_STATISTIC == 1U */
+
+  if ((p_modem_ctxt->p_modem_LUT == NULL) || (p_modem_ctxt->modem_LUT_size > ATCM_LUT_INDEX_MAX_SIZE))
+  {
+    PRINT_INFO("LUT not indexed (size=%ld), linear search used", p_modem_ctxt->modem_LUT_size)
+  }
+  else
+  {
+    /* 1- count the commands of each string length (empty strings are not indexed) */
+    for (i = 0U; i < (uint16_t) p_modem_ctxt->modem_LUT_size; i++)
+    {
+      len = (uint16_t) strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str);
+      if ((len > 0U) && (len < ATCMD_MAX_NAME_SIZE))
+      {
+        next_entry[len]++;
+      }
+    }
+
+    /* 2- compute the first entry of each bucket */
+    for (len = 1U; len <= ATCMD_MAX_NAME_SIZE; len++)
+    {
+      p_index->bucket_start[len] = (uint8_t)(p_index->bucket_start[len - 1U] + next_entry[len - 1U]);
+      next_entry[len - 1U] = p_index->bucket_start[len - 1U];
+    }
+
+    /* 3- fill the buckets following LUT order (first matching command of the LUT is kept) */
+    for (i = 0U; i < (uint16_t) p_modem_ctxt->modem_LUT_size; i++)
+    {
+      const AT_CHAR_t *p_cmd_str = (p_modem_ctxt->p_modem_LUT)[i].cmd_str;
+      len = (uint16_t) strlen((const CRC_CHAR_t *)p_cmd_str);
+      if ((len > 0U) && (len < ATCMD_MAX_NAME_SIZE))
+      {
+        atcustom_LUT_index_entry_t *p_entry = &p_index->entry[next_entry[len]];
+        p_entry->lut_idx = (uint8_t) i;
+        p_entry->hash = LUT_hash(p_cmd_str, len);
+        next_entry[len]++;
+      }
+    }
+
+    p_index->is_valid = AT_TRUE;
+    PRINT_DBG("LUT indexed (size=%ld)", p_modem_ctxt->modem_LUT_size)
+
+#if (ATCM_LUT_BENCHMARK == 1U)
+    LUT_benchmark(p_modem_ctxt);
+#endif /* ATCM_LUT_BENCHMARK == 1U */
+  }
+}
+
 /**
   * @brief  atcm_searchCmdInLUT
   * @note   Search if the received AT command exists in the modem LookUp table (LUT)
@@ -1847,32 +2030,26 @@ at_status_t atcm_searchCmdInLUT(atcustom_modem_context_t *p_modem_ctxt,
   else
   {
     /* search in LUT the ID corresponding to command received */
-    bool leave_loop = false;
-    uint16_t i = 0U;
-    do
+    const AT_CHAR_t *p_str = &(p_msg_in->buffer[element_infos->str_start_idx]);
+    uint16_t lut_idx;
+
+    if (p_modem_ctxt->LUT_index.is_valid == AT_TRUE)
     {
-      /* if string length > 0 */
-      if (strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str) > 0U)
-      {
-        /* compare strings size first */
-        if ((strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str) == element_infos->str_size))
-        {
-          /* compare strings content */
-          if (0 == memcmp((const void *) & (p_msg_in->buffer[element_infos->str_start_idx]),
-                          (const AT_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str,
-                          (size_t) element_infos->str_size))
-          {
-            PRINT_DBG("we received LUT#%ld : %s \r\n", (p_modem_ctxt->p_modem_LUT)[i].cmd_id,
-                      (p_modem_ctxt->p_modem_LUT)[i].cmd_str)
+      lut_idx = LUT_search_indexed(p_modem_ctxt, p_str, element_infos->str_size);
+    }
+    else
+    {
+      lut_idx = LUT_search_linear(p_modem_ctxt, p_str, element_infos->str_size);
+    }
 
-            element_infos->cmd_id_received = (p_modem_ctxt->p_modem_LUT)[i].cmd_id;
-            retval = ATSTATUS_OK;
-            leave_loop = true;
-          }
-        }
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    if (lut_idx != LUT_ENTRY_NOT_FOUND)
+    {
+      PRINT_DBG("we received LUT#%ld : %s \r\n", (p_modem_ctxt->p_modem_LUT)[lut_idx].cmd_id,
+                (p_modem_ctxt->p_modem_LUT)[lut_idx].cmd_str)
+
+      element_infos->cmd_id_received = (p_modem_ctxt->p_modem_LUT)[lut_idx].cmd_id;
+      retval = ATSTATUS_OK;
+    }
   }
   return (retval);
 }
@@ -2548,6 +2725,146 @@ void atcm_set_error_report(csint_error_type_t err_type, atcustom_modem_context_t
   * @{
   */
 
+/**
+  * @brief  Compute the hash of a command string used by the LUT index.
+  * @param  p_str Pointer to the command string (not null terminated).
+  * @param  size Size of the command string.
+  * @retval uint8_t hash value
+  */
+static uint8_t LUT_hash(const AT_CHAR_t *p_str, uint16_t size)
+{
+  uint8_t hash = 0U;
+
+  for (uint16_t i = 0U; i < size; i++)
+  {
+    /* rotate left by 3 bits then mix the next character */
+    hash = (uint8_t)((uint8_t)(hash << 3U) | (uint8_t)(hash >> 5U)) ^ p_str[i];
+  }
+
+  return (hash);
+}
+
+/**
+  * @brief  Search a command string in the modem LUT by parsing the whole LUT.
+  * @param  p_modem_ctxt Pointer to modem context.
+  * @param  p_str Pointer to the command string (not null terminated).
+  * @param  size Size of the command string.
+  * @retval uint16_t index of the first matching command in the LUT or LUT_ENTRY_NOT_FOUND
+  */
+static uint16_t LUT_search_linear(const atcustom_modem_context_t *p_modem_ctxt,
+                                  const AT_CHAR_t *p_str, uint16_t size)
+{
+  uint16_t lut_idx = LUT_ENTRY_NOT_FOUND;
+  /* empty strings are not searched (as in the index): empty LUT strings never match */
+  uint16_t i = (size == 0U) ? (uint16_t) p_modem_ctxt->modem_LUT_size : 0U;
+
+  while ((lut_idx == LUT_ENTRY_NOT_FOUND) && (i < (uint16_t) p_modem_ctxt->modem_LUT_size))
+  {
+    const AT_CHAR_t *p_cmd_str = (p_modem_ctxt->p_modem_LUT)[i].cmd_str;
+    /* compare strings size first then strings content */
+    if ((strlen((const CRC_CHAR_t *)p_cmd_str) == size) &&
+        (0 == memcmp((const void *)p_str, (const void *)p_cmd_str, (size_t) size)))
+    {
+      lut_idx = i;
+    }
+    i++;
+  }
+
+  return (lut_idx);
+}
+
+/**
+  * @brief  Search a command string in the modem LUT using the LUT index.
+  * @note   Only the LUT commands of same length and same hash are compared.
+  * @param  p_modem_ctxt Pointer to modem context.
+  * @param  p_str Pointer to the command string (not null terminated).
+  * @param  size Size of the command string.
+  * @retval uint16_t index of the first matching command in the LUT or LUT_ENTRY_NOT_FOUND
+  */
+static uint16_t LUT_search_indexed(const atcustom_modem_context_t *p_modem_ctxt,
+                                   const AT_CHAR_t *p_str, uint16_t size)
+{
+  const atcustom_LUT_index_t *p_index = &p_modem_ctxt->LUT_index;
+  uint16_t lut_idx = LUT_ENTRY_NOT_FOUND;
+
+  /* LUT strings size is lower than ATCMD_MAX_NAME_SIZE: no need to search longer strings */
+  if (size < ATCMD_MAX_NAME_SIZE)
+  {
+    uint8_t hash = LUT_hash(p_str, size);
+    uint16_t i = p_index->bucket_start[size];
+    uint16_t bucket_end = p_index->bucket_start[size + 1U];
+
+    while ((lut_idx == LUT_ENTRY_NOT_FOUND) && (i < bucket_end))
+    {
+      const atcustom_LUT_index_entry_t *p_entry = &p_index->entry[i];
+      if ((p_entry->hash == hash) &&
+          (0 == memcmp((const void *)p_str,
+                       (const void *)(p_modem_ctxt->p_modem_LUT)[p_entry->lut_idx].cmd_str,
+                       (size_t) size)))
+      {
+        lut_idx = (uint16_t) p_entry->lut_idx;
+      }
+      i++;
+    }
+  }
+
+  return (lut_idx);
+}
+
+#if (ATCM_LUT_BENCHMARK == 1U)
+/**
+  * @brief  Benchmark the linear and the indexed LUT search on a replay of recorded modem traffic.
+  * @note   Uses the DWT cycle counter. Also checks that both searches return the same LUT entry.
+  * @param  p_modem_ctxt Pointer to modem context.
+  * @retval none
+  */
+static void LUT_benchmark(const atcustom_modem_context_t *p_modem_ctxt)
+{
+  uint32_t cycles_linear = 0U;
+  uint32_t cycles_indexed = 0U;
+  uint32_t start;
+  uint16_t mismatch = 0U;
+  uint16_t loop;
+  uint16_t i;
+  volatile uint16_t lut_idx; /* volatile: keep the searches in the measured code */
+
+  /* enable cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (i = 0U; i < LUT_BENCHMARK_TRAFFIC_SIZE; i++)
+  {
+    const AT_CHAR_t *p_str = LUT_benchmark_traffic[i];
+    uint16_t size = (uint16_t) strlen((const CRC_CHAR_t *)p_str);
+
+    start = DWT->CYCCNT;
+    for (loop = 0U; loop < LUT_BENCHMARK_LOOPS; loop++)
+    {
+      lut_idx = LUT_search_linear(p_modem_ctxt, p_str, size);
+    }
+    cycles_linear += DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    for (loop = 0U; loop < LUT_BENCHMARK_LOOPS; loop++)
+    {
+      lut_idx = LUT_search_indexed(p_modem_ctxt, p_str, size);
+    }
+    cycles_indexed += DWT->CYCCNT - start;
+
+    if (lut_idx != LUT_search_linear(p_modem_ctxt, p_str, size))
+    {
+      PRINT_ERR("LUT benchmark: search mismatch for %s", p_str)
+      mismatch++;
+    }
+  }
+
+  PRINT_INFO("LUT benchmark: %d lookups on LUT size %ld",
+             LUT_BENCHMARK_TRAFFIC_SIZE * LUT_BENCHMARK_LOOPS, p_modem_ctxt->modem_LUT_size)
+  PRINT_INFO("LUT benchmark: linear=%ld cycles indexed=%ld cycles mismatch=%d",
+             cycles_linear, cycles_indexed, mismatch)
+}
+#endif /* ATCM_LUT_BENCHMARK == 1U */
+
 /**
   * @brief  Reserve a modem modem cid (normally used only for PDN_PREDEF_CONFIG at startup time)
   * @param  p_persistent_ctxt Pointer to persistent context.
@@ -101,6 +101,14 @@ static void reset_current_command(atparser_context_t *p_atp_ctxt);
 static void display_buffer(const at_context_t *p_at_ctxt, const uint8_t *p_buf, uint16_t buf_size, uint8_t is_TX_buf);
 static bool write_data2buffer(uint8_t *p_ATcmdBuf, const AT_CHAR_t *p_str, uint16_t str_size,
                               uint16_t *cmd_total_length, uint16_t *remaining_size);
+static bool is_pipeline_candidate(const atparser_context_t *p_atp_ctxt);
+static void save_pipelined_command(atparser_context_t *p_atp_ctxt);
+static at_status_t pipeline_commands(at_context_t *p_at_ctxt, uint8_t *p_ATcmdBuf, uint16_t ATcmdBuf_maxSize,
+                                     uint16_t *p_ATcmdSize, uint32_t *p_ATcmdTimeout);
+static void select_pipelined_command(atparser_context_t *p_atp_ctxt, const IPC_RxMessage_t *p_message,
+                                     const at_element_info_t *p_element_infos);
+static bool is_pipelined_answer(const atparser_pipelined_cmd_t *p_cmd, const IPC_RxMessage_t *p_message,
+                                const at_element_info_t *p_element_infos);
 /**
   * @}
   */
@@ -113,13 +121,15 @@ at_status_t ATParser_initParsers(sysctrl_device_type_t device_type)
   return (atcc_initParsers(device_type));
 }
 
-void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback)
+void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback,
+                   IPC_CheckEndOfMsgSpanCallbackTypeDef *p_checkEndOfMsgSpanCallback)
 {
   /* reset request context */
   reset_parser_context(&p_at_ctxt->parser);
 
-  /* get callback pointer */
+  /* get callback pointers (span callback is optional) */
   *p_checkEndOfMsgCallback = atcc_checkEndOfMsgCallback(p_at_ctxt);
+  *p_checkEndOfMsgSpanCallback = atcc_checkEndOfMsgSpanCallback(p_at_ctxt);
 
   /* default termination string for AT command: <CR>
    * this value can be changed in ATCustom init if needed
@@ -186,6 +196,9 @@ at_action_send_t  ATParser_get_ATcmd(at_context_t *p_at_ctxt,
   /* init command parameters */
   *p_ATcmdSize = 0U;
   reset_current_command(&p_at_ctxt->parser);
+  p_at_ctxt->parser.pipeline_nb = 0U;
+  p_at_ctxt->parser.pipeline_idx = 0U;
+  p_at_ctxt->parser.pipeline_answered = AT_FALSE;
 
   /* get the next command to send and set timeout value */
   if (atcc_getCmd(p_at_ctxt, p_ATcmdTimeout) != ATSTATUS_OK)
@@ -201,8 +214,18 @@ at_action_send_t  ATParser_get_ATcmd(at_context_t *p_at_ctxt,
     {
       /* build the command buffer */
       *p_ATcmdSize = build_command(p_at_ctxt, p_ATcmdBuf, ATcmdBuf_maxSize);
+
+      /* concatenate next commands of the SID on the same line if modem allows it */
+      if (pipeline_commands(p_at_ctxt, p_ATcmdBuf, ATcmdBuf_maxSize, p_ATcmdSize, p_ATcmdTimeout) != ATSTATUS_OK)
+      {
+        PRINT_DBG("parser pipeline error")
+        action = ATACTION_SEND_ERROR;
+      }
     }
+  }
 
+  if (action != ATACTION_SEND_ERROR)
+  {
     /* Prepare returned code (if no error) */
     if (p_at_ctxt->parser.answer_expected == CMD_MANDATORY_ANSWER_EXPECTED)
     {
@@ -254,6 +277,12 @@ at_action_rsp_t ATParser_parse_rsp(at_context_t *p_at_ctxt, IPC_RxMessage_t *p_m
   /* extract next element to analyze */
   msg_end = atcc_extractElement(p_at_ctxt, p_message, &element_infos);
 
+  /* several commands sent on the same line: select the one whose answer is received */
+  if (p_at_ctxt->parser.pipeline_nb > 1U)
+  {
+    select_pipelined_command(&p_at_ctxt->parser, p_message, &element_infos);
+  }
+
   /* Search for command name */
   cmd_retval = atcc_analyzeCmd(p_at_ctxt, p_message, &element_infos);
 
@@ -345,6 +374,17 @@ void ATParser_abort_request(at_context_t *p_at_ctxt)
 {
   reset_parser_context(&p_at_ctxt->parser);
 }
+
+/**
+  * @brief  Get the client buffer where the next received message (data payload) has to be copied.
+  * @param  p_at_ctxt Pointer to AT context structure.
+  * @param  p_size Pointer to the size of the data payload.
+  * @retval uint8_t* Pointer to the client buffer (NULL if not a data payload).
+  */
+uint8_t *ATParser_get_rx_data_buffer(at_context_t *p_at_ctxt, uint16_t *p_size)
+{
+  return (atcc_getRxDataBuffer(p_at_ctxt, p_size));
+}
 /**
   * @}
   */
@@ -477,6 +517,9 @@ static void reset_parser_context(atparser_context_t *p_atp_ctxt)
   p_atp_ctxt->answer_expected = CMD_MANDATORY_ANSWER_EXPECTED;
   p_atp_ctxt->is_final_cmd = 1U;
   p_atp_ctxt->cmd_timeout = 0U;
+  p_atp_ctxt->pipeline_nb = 0U;
+  p_atp_ctxt->pipeline_idx = 0U;
+  p_atp_ctxt->pipeline_answered = AT_FALSE;
 
   reset_current_command(p_atp_ctxt);
 
@@ -490,6 +533,224 @@ static void reset_current_command(atparser_context_t *p_atp_ctxt)
   (void) memset((void *)&p_atp_ctxt->current_atcmd.name[0], 0, sizeof(uint8_t) * (ATCMD_MAX_NAME_SIZE));
   (void) memset((void *)&p_atp_ctxt->current_atcmd.params[0], 0, sizeof(uint8_t) * (ATCMD_MAX_CMD_SIZE));
   p_atp_ctxt->current_atcmd.raw_cmd_size = 0U;
+  p_atp_ctxt->current_atcmd.lut_idx = ATCMD_LUT_IDX_NONE;
+  p_atp_ctxt->pipeline_allowed = AT_FALSE;
+}
+
+/**
+  * @brief  Check if current command can be sent on the same line than other commands.
+  * @note   Only queries (test, read or execution commands) with a mandatory answer and
+  *         allowed by the modem pipeline LUT are concatenated.
+  * @param  p_atp_ctxt Pointer to parser context.
+  * @retval true if current command can be concatenated.
+  */
+static bool is_pipeline_candidate(const atparser_context_t *p_atp_ctxt)
+{
+  at_type_t cmd_type = p_atp_ctxt->current_atcmd.type;
+
+  return ((p_atp_ctxt->pipeline_allowed == AT_TRUE) &&
+          (p_atp_ctxt->answer_expected == CMD_MANDATORY_ANSWER_EXPECTED) &&
+          ((cmd_type == ATTYPE_TEST_CMD) || (cmd_type == ATTYPE_READ_CMD) || (cmd_type == ATTYPE_EXECUTION_CMD)));
+}
+
+/**
+  * @brief  Save current command in the list of commands sent on current line.
+  * @param  p_atp_ctxt Pointer to parser context.
+  * @retval none
+  */
+static void save_pipelined_command(atparser_context_t *p_atp_ctxt)
+{
+  atparser_pipelined_cmd_t *p_cmd = &p_atp_ctxt->pipeline_cmd[p_atp_ctxt->pipeline_nb];
+
+  p_cmd->id = p_atp_ctxt->current_atcmd.id;
+  p_cmd->type = p_atp_ctxt->current_atcmd.type;
+  p_cmd->is_final_cmd = p_atp_ctxt->is_final_cmd;
+  p_cmd->lut_idx = p_atp_ctxt->current_atcmd.lut_idx;
+  (void) memcpy((void *)&p_cmd->name[0], (const void *)&p_atp_ctxt->current_atcmd.name[0], ATCMD_MAX_NAME_SIZE);
+  p_atp_ctxt->pipeline_nb++;
+}
+
+/**
+  * @brief  Concatenate next commands of the SID to the command buffer: AT+<x>;+<y>;+<z><cmd_endstr>
+  * @note   A command which can not be concatenated is cancelled (SID step and command timeout restored):
+  *         it will be requested again once the answer to the current line is received.
+  * @param  p_at_ctxt Pointer to AT context structure.
+  * @param  p_ATcmdBuf Pointer to the command buffer (already containing first command).
+  * @param  ATcmdBuf_maxSize Size of the command buffer.
+  * @param  p_ATcmdSize Pointer to the size of the command buffer (updated).
+  * @param  p_ATcmdTimeout Pointer to the timeout of the command buffer (updated).
+  * @retval at_status_t
+  */
+static at_status_t pipeline_commands(at_context_t *p_at_ctxt, uint8_t *p_ATcmdBuf, uint16_t ATcmdBuf_maxSize,
+                                     uint16_t *p_ATcmdSize, uint32_t *p_ATcmdTimeout)
+{
+  atparser_context_t *p_atp_ctxt = &p_at_ctxt->parser;
+  at_status_t retval = ATSTATUS_OK;
+  uint32_t cmd_timeout = 0U;
+  uint32_t saved_cmd_timeout;
+  uint16_t endstr_size = (uint16_t) strlen((CRC_CHAR_t *) &p_atp_ctxt->endstr);
+  uint16_t cmd_size;
+  uint16_t max_size;
+  bool leave_loop = false;
+  bool next_cmd_requested = false;
+
+  if ((*p_ATcmdSize > endstr_size) && (is_pipeline_candidate(p_atp_ctxt) == true))
+  {
+    save_pipelined_command(p_atp_ctxt);
+
+    while ((leave_loop == false) &&
+           (p_atp_ctxt->is_final_cmd == 0U) &&
+           (p_atp_ctxt->pipeline_nb < AT_CMD_PIPELINE_MAX_SIZE))
+    {
+      /* get next command of the SID (the modem overwrites the command timeout of the context) */
+      saved_cmd_timeout = p_atp_ctxt->cmd_timeout;
+      reset_current_command(p_atp_ctxt);
+      next_cmd_requested = true;
+      if (atcc_getCmd(p_at_ctxt, &cmd_timeout) != ATSTATUS_OK)
+      {
+        retval = ATSTATUS_ERROR;
+        leave_loop = true;
+      }
+      else
+      {
+        /* worst case size of the command to add (<cmd_prefix> is replaced by ';') */
+        max_size = (uint16_t)(strlen((CRC_CHAR_t *) &p_atp_ctxt->current_atcmd.name) +
+                              strlen((CRC_CHAR_t *) &p_atp_ctxt->current_atcmd.params) +
+                              (2U * MAX_CMD_FORMAT_SIZE) + endstr_size);
+
+        if ((is_pipeline_candidate(p_atp_ctxt) == true) &&
+            ((*p_ATcmdSize - endstr_size + max_size) < ATcmdBuf_maxSize))
+        {
+          /* overwrite <cmd_endstr> of previous command with the new command, then replace "AT" by ";" */
+          cmd_size = build_command(p_at_ctxt, &p_ATcmdBuf[*p_ATcmdSize - endstr_size],
+                                   (uint16_t)(ATcmdBuf_maxSize - (*p_ATcmdSize - endstr_size)));
+          *p_ATcmdSize -= endstr_size;
+          p_ATcmdBuf[*p_ATcmdSize] = (uint8_t)';';
+          (void) memmove((void *)&p_ATcmdBuf[*p_ATcmdSize + 1U],
+                         (const void *)&p_ATcmdBuf[*p_ATcmdSize + 2U],
+                         (size_t)cmd_size - 2U);
+          *p_ATcmdSize += (cmd_size - 1U);
+
+          /* modem processes the commands sequentially */
+          *p_ATcmdTimeout += cmd_timeout;
+          save_pipelined_command(p_atp_ctxt);
+        }
+        else
+        {
+          /* cancel this command, it will be sent alone after current line */
+          p_atp_ctxt->step--;
+          p_atp_ctxt->cmd_timeout = saved_cmd_timeout;
+          leave_loop = true;
+        }
+      }
+    }
+
+    if (next_cmd_requested == true)
+    {
+      /* answers are analyzed starting from first command of the line */
+      p_atp_ctxt->is_final_cmd = p_atp_ctxt->pipeline_cmd[p_atp_ctxt->pipeline_nb - 1U].is_final_cmd;
+      p_atp_ctxt->answer_expected = CMD_MANDATORY_ANSWER_EXPECTED;
+      p_atp_ctxt->pipeline_idx = 0U;
+      p_atp_ctxt->pipeline_answered = AT_FALSE;
+      reset_current_command(p_atp_ctxt);
+      p_atp_ctxt->current_atcmd.id = p_atp_ctxt->pipeline_cmd[0].id;
+      p_atp_ctxt->current_atcmd.type = p_atp_ctxt->pipeline_cmd[0].type;
+      p_atp_ctxt->current_atcmd.lut_idx = p_atp_ctxt->pipeline_cmd[0].lut_idx;
+      (void) memcpy((void *)&p_atp_ctxt->current_atcmd.name[0], (const void *)&p_atp_ctxt->pipeline_cmd[0].name[0],
+                    ATCMD_MAX_NAME_SIZE);
+      PRINT_DBG("%d command(s) sent on the same line", p_atp_ctxt->pipeline_nb)
+    }
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Select the command of current line corresponding to the received answer.
+  * @note   Answers are received in the order of the commands: the next command of the line is selected only
+  *         once the answer to the current one has been received. A line which is not the answer to the current or
+  *         next command (URC, text line, final result code...) is analyzed with current command.
+  * @param  p_atp_ctxt Pointer to parser context.
+  * @param  p_message Pointer to the received message.
+  * @param  p_element_infos Pointer to the first element of the received message.
+  * @retval none
+  */
+static void select_pipelined_command(atparser_context_t *p_atp_ctxt, const IPC_RxMessage_t *p_message,
+                                     const at_element_info_t *p_element_infos)
+{
+  const atparser_pipelined_cmd_t *p_cmd;
+  uint8_t next_idx = p_atp_ctxt->pipeline_idx + 1U;
+
+  if (is_pipelined_answer(&p_atp_ctxt->pipeline_cmd[p_atp_ctxt->pipeline_idx], p_message, p_element_infos) == true)
+  {
+    /* answer to current command */
+    p_atp_ctxt->pipeline_answered = AT_TRUE;
+  }
+  else if ((p_atp_ctxt->pipeline_answered == AT_TRUE) && (next_idx < p_atp_ctxt->pipeline_nb) &&
+           (is_pipelined_answer(&p_atp_ctxt->pipeline_cmd[next_idx], p_message, p_element_infos) == true))
+  {
+    /* answer to next command */
+    PRINT_DBG("answer to pipelined command %d", next_idx)
+    p_cmd = &p_atp_ctxt->pipeline_cmd[next_idx];
+    p_atp_ctxt->pipeline_idx = next_idx;
+    p_atp_ctxt->current_atcmd.id = p_cmd->id;
+    p_atp_ctxt->current_atcmd.type = p_cmd->type;
+    p_atp_ctxt->current_atcmd.lut_idx = p_cmd->lut_idx;
+    (void) memcpy((void *)&p_atp_ctxt->current_atcmd.name[0], (const void *)&p_cmd->name[0],
+                  ATCMD_MAX_NAME_SIZE);
+  }
+  else
+  {
+    __NOP();
+  }
+}
+
+/**
+  * @brief  Check if a received line is the answer to a command of current line.
+  * @note   The answer is prefixed by the command name. The registration status URCs have the same prefix than
+  *         the answer to the read command: +CxREG: <stat>[,<lac>,...] (<lac> quoted) for the URC and
+  *         +CxREG: <n>,<stat>[,...] for the answer. The answer is recognized by its numeric second parameter.
+  * @param  p_cmd Pointer to the pipelined command.
+  * @param  p_message Pointer to the received message.
+  * @param  p_element_infos Pointer to the first element of the received message.
+  * @retval true if the line is the answer to the command.
+  */
+static bool is_pipelined_answer(const atparser_pipelined_cmd_t *p_cmd, const IPC_RxMessage_t *p_message,
+                                const at_element_info_t *p_element_infos)
+{
+  bool retval = false;
+  uint16_t idx;
+
+  if ((strlen((const CRC_CHAR_t *)&p_cmd->name[0]) == (size_t)p_element_infos->str_size) &&
+      (memcmp((const void *)&p_message->buffer[p_element_infos->str_start_idx],
+              (const void *)&p_cmd->name[0],
+              (size_t)p_element_infos->str_size) == 0))
+  {
+    if ((p_cmd->type == ATTYPE_READ_CMD) &&
+        ((p_cmd->id == (uint32_t)CMD_AT_CREG) || (p_cmd->id == (uint32_t)CMD_AT_CGREG) ||
+         (p_cmd->id == (uint32_t)CMD_AT_CEREG)))
+    {
+      /* search the first parameter separator */
+      idx = p_element_infos->str_end_idx + 1U;
+      while ((idx < p_message->size) && (p_message->buffer[idx] != (uint8_t)',') &&
+             (p_message->buffer[idx] != (uint8_t)'\r') && (p_message->buffer[idx] != (uint8_t)'\n'))
+      {
+        idx++;
+      }
+      /* second parameter is <stat> (numeric) in the answer, <lac> (quoted) or absent in the URC */
+      if (((idx + 1U) < p_message->size) && (p_message->buffer[idx] == (uint8_t)',') &&
+          (p_message->buffer[idx + 1U] >= (uint8_t)'0') && (p_message->buffer[idx + 1U] <= (uint8_t)'9'))
+      {
+        retval = true;
+      }
+    }
+    else
+    {
+      retval = true;
+    }
+  }
+
+  return (retval);
 }
 
 static void display_buffer(const at_context_t *p_at_ctxt, const uint8_t *p_buf, uint16_t buf_size, uint8_t is_TX_buf)
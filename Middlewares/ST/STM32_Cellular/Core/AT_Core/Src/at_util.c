@@ -36,6 +36,7 @@
 #define MAX_32BITS_STRING_SIZE (8U)  /* = max string size for a 32bits value (FFFF.FFFF) */
 #define MAX_64BITS_STRING_SIZE (16U) /* = max string size for a 64bits value (FFFF.FFFF.FFFF.FFFF) */
 #define MAX_PARAM_SIZE ((uint16_t)32U) /* max size of string */
+#define HEX_DIGIT_INVALID (0x10U)      /* decoding table value of a character which is not an hexa digit */
 /**
   * @}
   */
@@ -527,6 +528,203 @@ uint32_t ATutil_convert_T3324_to_seconds(uint32_t encoded_value)
 
   return (decode_value);
 }
+
+/**
+  * @brief  Search the first occurrence of a character in a buffer.
+  * @note   The buffer is scanned 4 characters at a time (called under interrupt on received spans).
+  * @param  p_buf ptr to the buffer.
+  * @param  size size of the buffer.
+  * @param  character character to search.
+  * @retval index of the first occurrence of the character, size if not found.
+  */
+uint16_t ATutil_findChar(const uint8_t *p_buf, uint16_t size, uint8_t character)
+{
+  uint16_t idx = 0U;
+  uint32_t pattern = (uint32_t)character * 0x01010101U;
+  uint32_t word;
+  uint32_t match = 0U;
+
+  while (((idx + 4U) <= size) && (match == 0U))
+  {
+    /* unaligned 32-bit load, the searched character becomes a null byte */
+    (void) memcpy((void *)&word, (const void *)&p_buf[idx], sizeof(word));
+    word ^= pattern;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    /* saturated byte subtraction: 1 for the null bytes, 0 for the other bytes */
+    match = __UQSUB8(0x01010101U, word);
+#else
+    /* high bit set for the null bytes (exact for the first null byte) */
+    match = (word - 0x01010101U) & ~word & 0x80808080U;
+#endif /* __ARM_FEATURE_DSP */
+    if (match == 0U)
+    {
+      idx += 4U;
+    }
+  }
+
+  if (match != 0U)
+  {
+    /* little endian: first character is in the least significant byte */
+    while ((match & 0xFFU) == 0U)
+    {
+      match >>= 8;
+      idx++;
+    }
+  }
+  else
+  {
+    /* remaining characters */
+    while ((idx < size) && (p_buf[idx] != character))
+    {
+      idx++;
+    }
+  }
+
+  return (idx);
+}
+
+/**
+  * @brief  Check if a buffer starts with a prefix.
+  * @note   The comparison is done 4 characters at a time.
+  * @param  p_buf ptr to the buffer.
+  * @param  size size of the buffer.
+  * @param  p_prefix ptr to the prefix.
+  * @param  prefix_size size of the prefix.
+  * @retval 1 if the buffer starts with the prefix, 0 else (or if the buffer is smaller than the prefix).
+  */
+uint8_t ATutil_isPrefix(const uint8_t *p_buf, uint16_t size, const uint8_t *p_prefix, uint16_t prefix_size)
+{
+  uint8_t retval = 0U;
+  uint16_t idx = 0U;
+  uint32_t word_buf;
+  uint32_t word_prefix;
+
+  if (size >= prefix_size)
+  {
+    retval = 1U;
+    while (((idx + 4U) <= prefix_size) && (retval == 1U))
+    {
+      (void) memcpy((void *)&word_buf, (const void *)&p_buf[idx], sizeof(word_buf));
+      (void) memcpy((void *)&word_prefix, (const void *)&p_prefix[idx], sizeof(word_prefix));
+      retval = (word_buf == word_prefix) ? 1U : 0U;
+      idx += 4U;
+    }
+    while ((idx < prefix_size) && (retval == 1U))
+    {
+      retval = (p_buf[idx] == p_prefix[idx]) ? 1U : 0U;
+      idx++;
+    }
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Convert a buffer to its hexadecimal string representation (2 lower case digits per byte).
+  *         for example "AB" is converted to "4142"
+  * @note   Digits are taken from a table and stored 4 at a time (2 bytes of the buffer).
+  *         The string is not null terminated.
+  * @param  p_src ptr to the buffer to convert.
+  * @param  src_size size of the buffer to convert.
+  * @param  p_dst ptr to the string, must be able to receive (2 * src_size) characters.
+  * @retval none.
+  */
+void ATutil_convertBufferToHexaString(const uint8_t *p_src, uint16_t src_size, uint8_t *p_dst)
+{
+  static const uint8_t AT_HEX_DIGITS[16] =
+  {
+    (uint8_t)'0', (uint8_t)'1', (uint8_t)'2', (uint8_t)'3', (uint8_t)'4', (uint8_t)'5', (uint8_t)'6', (uint8_t)'7',
+    (uint8_t)'8', (uint8_t)'9', (uint8_t)'a', (uint8_t)'b', (uint8_t)'c', (uint8_t)'d', (uint8_t)'e', (uint8_t)'f'
+  };
+  uint32_t idx = 0U;
+  uint32_t word;
+
+  while ((idx + 2U) <= (uint32_t)src_size)
+  {
+    /* little endian: first digit in the least significant byte */
+    word = (uint32_t)AT_HEX_DIGITS[p_src[idx] >> 4]
+           | ((uint32_t)AT_HEX_DIGITS[p_src[idx] & 0x0FU] << 8)
+           | ((uint32_t)AT_HEX_DIGITS[p_src[idx + 1U] >> 4] << 16)
+           | ((uint32_t)AT_HEX_DIGITS[p_src[idx + 1U] & 0x0FU] << 24);
+    /* unaligned 32-bit store */
+    (void) memcpy((void *)&p_dst[2U * idx], (const void *)&word, sizeof(word));
+    idx += 2U;
+  }
+
+  if (idx < (uint32_t)src_size)
+  {
+    /* last byte of an odd size buffer */
+    p_dst[2U * idx] = AT_HEX_DIGITS[p_src[idx] >> 4];
+    p_dst[(2U * idx) + 1U] = AT_HEX_DIGITS[p_src[idx] & 0x0FU];
+  }
+}
+
+/**
+  * @brief  Convert an hexadecimal string (2 digits per byte, upper or lower case) to a buffer.
+  *         for example "4142" is converted to "AB"
+  * @note   Digits are read 4 at a time and decoded with a table.
+  *         Validity of the digits is checked once for the whole string.
+  * @param  p_src ptr to the string to convert, contains (2 * dst_size) digits.
+  * @param  dst_size size of the converted buffer.
+  * @param  p_dst ptr to the converted buffer (content not significant if conversion fails).
+  * @retval 1 if all characters are hexadecimal digits, 0 else.
+  */
+uint8_t ATutil_convertHexaStringToBuffer(const uint8_t *p_src, uint16_t dst_size, uint8_t *p_dst)
+{
+#define X HEX_DIGIT_INVALID
+  static const uint8_t AT_HEX_VALUES[256] =
+  {
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x00 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x10 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x20 */
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, X,  X,  X,  X,  X,  X,    /* 0x30: '0' to '9' */
+    X, 10U, 11U, 12U, 13U, 14U, 15U, X, X,  X,  X,  X,  X,  X,  X,  X,    /* 0x40: 'A' to 'F' */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x50 */
+    X, 10U, 11U, 12U, 13U, 14U, 15U, X, X,  X,  X,  X,  X,  X,  X,  X,    /* 0x60: 'a' to 'f' */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x70 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x80 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0x90 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0xA0 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0xB0 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0xC0 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0xD0 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,    /* 0xE0 */
+    X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X     /* 0xF0 */
+  };
+#undef X
+  uint32_t idx = 0U;
+  uint32_t word;
+  uint32_t d0;
+  uint32_t d1;
+  uint32_t d2;
+  uint32_t d3;
+  uint32_t invalid = 0U;
+
+  while ((idx + 2U) <= (uint32_t)dst_size)
+  {
+    /* unaligned 32-bit load, little endian: first digit in the least significant byte */
+    (void) memcpy((void *)&word, (const void *)&p_src[2U * idx], sizeof(word));
+    d0 = AT_HEX_VALUES[word & 0xFFU];
+    d1 = AT_HEX_VALUES[(word >> 8) & 0xFFU];
+    d2 = AT_HEX_VALUES[(word >> 16) & 0xFFU];
+    d3 = AT_HEX_VALUES[word >> 24];
+    invalid |= (d0 | d1 | d2 | d3);
+    p_dst[idx] = (uint8_t)((d0 << 4) | d1);
+    p_dst[idx + 1U] = (uint8_t)((d2 << 4) | d3);
+    idx += 2U;
+  }
+
+  if (idx < (uint32_t)dst_size)
+  {
+    /* last byte of an odd size buffer */
+    d0 = AT_HEX_VALUES[p_src[2U * idx]];
+    d1 = AT_HEX_VALUES[p_src[(2U * idx) + 1U]];
+    invalid |= (d0 | d1);
+    p_dst[idx] = (uint8_t)((d0 << 4) | d1);
+  }
+
+  return (((invalid & HEX_DIGIT_INVALID) == 0U) ? 1U : 0U);
+}
 /**
   * @}
   */
@@ -25,6 +25,15 @@
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private defines -----------------------------------------------------------*/
+/* Coalescing windows (in ms) of the high-rate entries: the updates done during a window
+   produce a single notification. 0U: each update is notified immediately.
+   Can be overridden in plf_cellular_config.h */
+#if !defined DC_CELLULAR_SIGNAL_INFO_COALESCING_MS
+#define DC_CELLULAR_SIGNAL_INFO_COALESCING_MS (0U)
+#endif /* !defined DC_CELLULAR_SIGNAL_INFO_COALESCING_MS */
+#if !defined DC_CELLULAR_NFMC_INFO_COALESCING_MS
+#define DC_CELLULAR_NFMC_INFO_COALESCING_MS   (0U)
+#endif /* !defined DC_CELLULAR_NFMC_INFO_COALESCING_MS */
 
 /* Private macros ------------------------------------------------------------*/
 
@@ -125,6 +134,14 @@ void cellular_service_datacache_init(void)
   DC_CELLULAR_POWER_STATUS     = dc_com_register_serv(&dc_com_db, (void *)&dc_cellular_power_status,
                                                       (uint16_t)sizeof(dc_cellular_power_status));
 #endif  /* (USE_LOW_POWER == 1) */
+
+#if (DC_CELLULAR_SIGNAL_INFO_COALESCING_MS != 0U)
+  /* Signal info is updated at each signal quality polling */
+  (void)dc_com_set_coalescing(&dc_com_db, DC_CELLULAR_SIGNAL_INFO, DC_CELLULAR_SIGNAL_INFO_COALESCING_MS);
+#endif /* DC_CELLULAR_SIGNAL_INFO_COALESCING_MS != 0U */
+#if (DC_CELLULAR_NFMC_INFO_COALESCING_MS != 0U)
+  (void)dc_com_set_coalescing(&dc_com_db, DC_CELLULAR_NFMC_INFO, DC_CELLULAR_NFMC_INFO_COALESCING_MS);
+#endif /* DC_CELLULAR_NFMC_INFO_COALESCING_MS != 0U */
 }
 
 
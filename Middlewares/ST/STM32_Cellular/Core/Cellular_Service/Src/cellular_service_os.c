@@ -24,18 +24,127 @@
 
 
 /* Private typedef -----------------------------------------------------------*/
+/* Priority of a request at the AT transaction gate */
+typedef enum
+{
+  CS_GATE_PRIO_DATA = 0U,    /* socket data transfer: latency of the application data    */
+  CS_GATE_PRIO_CONTROL,      /* modem, network and socket control                        */
+  CS_GATE_PRIO_BACKGROUND,   /* status polling (signal quality, registration, ping, ...) */
+  CS_GATE_PRIO_NB
+} cs_gate_prio_t;
+
+/* Queue of the requests of one priority waiting for the AT transaction gate */
+typedef struct
+{
+  osSemaphoreId grant;    /* gate handed over to one waiting request of this priority         */
+  uint8_t       waiting;  /* number of waiting requests                                       */
+  uint8_t       bypassed; /* gate handed over to a higher priority while requests were waiting */
+} cs_gate_queue_t;
 
 /* Private defines -----------------------------------------------------------*/
+/* A waiting request is served at the latest after CS_GATE_BYPASS_MAX requests of higher priority */
+#define CS_GATE_BYPASS_MAX  (4U)
 
 /* Private macros ------------------------------------------------------------*/
 
 /* Private variables ---------------------------------------------------------*/
+/* AT transaction gate: one transaction at a time on the modem AT channel
+   - CellularServiceMutexHandle only protects the gate state: never kept during an AT transaction
+   - on contention, the requests are queued by priority and the gate is handed over by the leaving request
+     to the highest priority waiting one: a new request can not overtake the waiting ones */
 static osMutexId CellularServiceMutexHandle;
+static bool cs_gate_busy = false;
+static cs_gate_queue_t cs_gate_queue[CS_GATE_PRIO_NB];
 static osMutexId CellularServiceGeneralMutexHandle;
+/* Mutex to protect the socket table for the services without AT transaction
+   - never requested before entering the AT transaction gate: lock order is the gate first */
+static osMutexId CellularServiceSocketMutexHandle;
 
 /* Global variables ----------------------------------------------------------*/
 
 /* Private function prototypes -----------------------------------------------*/
+static void cs_gate_enter(cs_gate_prio_t prio);
+static void cs_gate_leave(void);
+
+/* Private function Definition -----------------------------------------------*/
+/**
+  * @brief  Enter the AT transaction gate: wait until the gate is handed over if it is busy.
+  * @param  prio - priority of the request
+  * @retval none
+  */
+static void cs_gate_enter(cs_gate_prio_t prio)
+{
+  bool wait_grant;
+
+  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  if (cs_gate_busy == false)
+  {
+    /* gate free: no request is waiting */
+    cs_gate_busy = true;
+    wait_grant = false;
+  }
+  else
+  {
+    cs_gate_queue[prio].waiting++;
+    wait_grant = true;
+  }
+  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+
+  if (wait_grant == true)
+  {
+    /* gate handed over by cs_gate_leave() */
+    (void)rtosalSemaphoreAcquire(cs_gate_queue[prio].grant, RTOSAL_WAIT_FOREVER);
+  }
+}
+
+/**
+  * @brief  Leave the AT transaction gate: hand it over to the highest priority waiting request,
+  *         or to a lower priority one bypassed CS_GATE_BYPASS_MAX times.
+  * @param  none
+  * @retval none
+  */
+static void cs_gate_leave(void)
+{
+  uint8_t next = (uint8_t)CS_GATE_PRIO_NB;
+
+  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  /* starvation: lowest priority first */
+  for (uint8_t prio = (uint8_t)CS_GATE_PRIO_NB; (prio > 0U) && (next == (uint8_t)CS_GATE_PRIO_NB); prio--)
+  {
+    if ((cs_gate_queue[prio - 1U].waiting != 0U) && (cs_gate_queue[prio - 1U].bypassed >= CS_GATE_BYPASS_MAX))
+    {
+      next = prio - 1U;
+    }
+  }
+  /* otherwise highest priority first */
+  for (uint8_t prio = 0U; (prio < (uint8_t)CS_GATE_PRIO_NB) && (next == (uint8_t)CS_GATE_PRIO_NB); prio++)
+  {
+    if (cs_gate_queue[prio].waiting != 0U)
+    {
+      next = prio;
+    }
+  }
+
+  if (next != (uint8_t)CS_GATE_PRIO_NB)
+  {
+    /* gate stays busy: handed over to a waiting request */
+    for (uint8_t prio = next + 1U; prio < (uint8_t)CS_GATE_PRIO_NB; prio++)
+    {
+      if (cs_gate_queue[prio].waiting != 0U)
+      {
+        cs_gate_queue[prio].bypassed++;
+      }
+    }
+    cs_gate_queue[next].waiting--;
+    cs_gate_queue[next].bypassed = 0U;
+    (void)rtosalSemaphoreRelease(cs_gate_queue[next].grant);
+  }
+  else
+  {
+    cs_gate_busy = false;
+  }
+  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+}
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -48,18 +157,19 @@ CS_Status_t osCS_get_signal_quality(CS_SignalQuality_t *p_sig_qual)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
 
   result = CS_get_signal_quality(p_sig_qual);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
 
 /**
   * @brief  Allocate a socket among of the free sockets (maximum 6 sockets)
-  * @note   Call CDS_socket_create with mutex access protection
+  * @note   Call CDS_socket_create with socket table mutex access protection
+  *         No AT transaction: not blocked by an on-going modem command
   * @param  same parameters as the CDS_socket_create function
   * @retval Socket handle which references allocated socket
   */
@@ -69,12 +179,12 @@ socket_handle_t osCDS_socket_create(CS_IPaddrType_t addr_type,
 {
   socket_handle_t socket_handle;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  (void)rtosalMutexAcquire(CellularServiceSocketMutexHandle, RTOSAL_WAIT_FOREVER);
 
   socket_handle = CDS_socket_create(addr_type,
                                     protocol,
                                     cid);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  (void)rtosalMutexRelease(CellularServiceSocketMutexHandle);
 
   return (socket_handle);
 }
@@ -82,7 +192,8 @@ socket_handle_t osCDS_socket_create(CS_IPaddrType_t addr_type,
 /**
   * @brief  Set the callbacks to use when data are received or sent.
   * @note   This function has to be called before to use a socket.
-  * @note   Call CDS_socket_set_callbacks with mutex access protection
+  * @note   Call CDS_socket_set_callbacks with socket table mutex access protection
+  *         No AT transaction: not blocked by an on-going modem command
   * @param  same parameters as the CDS_socket_set_callbacks function
   * @retval CS_Status_t
   */
@@ -93,14 +204,14 @@ CS_Status_t osCDS_socket_set_callbacks(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  (void)rtosalMutexAcquire(CellularServiceSocketMutexHandle, RTOSAL_WAIT_FOREVER);
 
   result = CDS_socket_set_callbacks(sockHandle,
                                     data_ready_cb,
                                     data_sent_cb,
                                     remote_close_cb);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  (void)rtosalMutexRelease(CellularServiceSocketMutexHandle);
 
   return (result);
 }
@@ -109,7 +220,8 @@ CS_Status_t osCDS_socket_set_callbacks(socket_handle_t sockHandle,
   * @brief  Define configurable options for a created socket.
   * @note   This function is called to configure one parameter at a time.
   *         If a parameter is not configured with this function, a default value will be applied.
-  * @note   Call CDS_socket_set_option with mutex access protection
+  * @note   Call CDS_socket_set_option with socket table mutex access protection
+  *         No AT transaction: not blocked by an on-going modem command
   * @param  same parameters as the CDS_socket_set_option function
   * @retval CS_Status_t
   */
@@ -121,14 +233,14 @@ CS_Status_t osCDS_socket_set_option(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  (void)rtosalMutexAcquire(CellularServiceSocketMutexHandle, RTOSAL_WAIT_FOREVER);
 
   result = CDS_socket_set_option(sockHandle,
                                  opt_level,
                                  opt_name,
                                  p_opt_val);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  (void)rtosalMutexRelease(CellularServiceSocketMutexHandle);
 
   return (result);
 }
@@ -148,11 +260,11 @@ CS_Status_t osCDS_socket_get_option(void)
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
 
     result = CDS_socket_get_option();
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -161,7 +273,8 @@ CS_Status_t osCDS_socket_get_option(void)
 /**
   * @brief  Bind the socket to a local port.
   * @note   If this function is not called, default local port value = 0 will be used.
-  * @note   Call CDS_socket_bind with mutex access protection
+  * @note   Call CDS_socket_bind with socket table mutex access protection
+  *         No AT transaction: not blocked by an on-going modem command
   * @param  same parameters as the CDS_socket_bind function
   * @retval CS_Status_t
   */
@@ -172,12 +285,12 @@ CS_Status_t osCDS_socket_bind(socket_handle_t sockHandle,
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    (void)rtosalMutexAcquire(CellularServiceSocketMutexHandle, RTOSAL_WAIT_FOREVER);
 
     result = CDS_socket_bind(sockHandle,
                              local_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    (void)rtosalMutexRelease(CellularServiceSocketMutexHandle);
   }
 
   return (result);
@@ -200,14 +313,14 @@ CS_Status_t osCDS_socket_connect(socket_handle_t sockHandle,
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_CONTROL);
 
     result = CDS_socket_connect(sockHandle,
                                 addr_type,
                                 p_ip_addr_value,
                                 remote_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -226,11 +339,11 @@ CS_Status_t osCDS_socket_listen(socket_handle_t sockHandle)
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_CONTROL);
 
     result = CDS_socket_listen(sockHandle);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -252,13 +365,13 @@ CS_Status_t osCDS_socket_send(socket_handle_t sockHandle,
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_DATA);
 
     result = CDS_socket_send(sockHandle,
                              p_buf,
                              length);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -280,13 +393,13 @@ int32_t osCDS_socket_receive(socket_handle_t sockHandle,
   result = 0;
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_DATA);
 
     result = CDS_socket_receive(sockHandle,
                                 p_buf,
                                 max_buf_length);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -312,7 +425,7 @@ CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle,
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_DATA);
 
     result = CDS_socket_sendto(sockHandle,
                                p_buf,
@@ -321,7 +434,7 @@ CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle,
                                p_ip_addr_value,
                                remote_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -346,7 +459,7 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle,
   result = 0;
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_DATA);
 
     result = CDS_socket_receivefrom(sockHandle,
                                     p_buf,
@@ -355,7 +468,7 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle,
                                     p_ip_addr_value,
                                     p_remote_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
   }
 
   return (result);
@@ -364,7 +477,7 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle,
 /**
   * @brief  Free a socket handle.
   * @note   If a PDN is activated at socket creation, the socket will not be deactivated at socket closure.
-  * @note   Call CDS_socket_close with mutex access protection
+  * @note   Call CDS_socket_close with mutex and socket table mutex access protection
   * @param  same parameters as the CDS_socket_close function
   * @retval CS_Status_t
   */
@@ -373,12 +486,15 @@ CS_Status_t osCDS_socket_close(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
+  /* Socket handle is released at the end of the transaction */
+  (void)rtosalMutexAcquire(CellularServiceSocketMutexHandle, RTOSAL_WAIT_FOREVER);
 
   result = CDS_socket_close(sockHandle,
                             force);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  (void)rtosalMutexRelease(CellularServiceSocketMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -395,12 +511,12 @@ CS_Status_t osCDS_socket_cnx_status(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
 
   result = CDS_socket_cnx_status(sockHandle,
                                  infos);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -425,6 +541,23 @@ CS_Bool_t osCDS_cellular_service_init(void)
       /* Platform is reset */
       ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 1, ERROR_FATAL);
     }
+    for (uint8_t prio = 0U; prio < (uint8_t)CS_GATE_PRIO_NB; prio++)
+    {
+      cs_gate_queue[prio].grant = rtosalSemaphoreNew((const rtosal_char_t *)"CS_SEM_GATE", 1U);
+      if (cs_gate_queue[prio].grant == NULL)
+      {
+        result = CELLULAR_FALSE;
+        /* Platform is reset */
+        ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 4, ERROR_FATAL);
+      }
+      else
+      {
+        /* init semaphore: no grant available */
+        (void)rtosalSemaphoreAcquire(cs_gate_queue[prio].grant, RTOSAL_WAIT_FOREVER);
+      }
+      cs_gate_queue[prio].waiting = 0U;
+      cs_gate_queue[prio].bypassed = 0U;
+    }
     CellularServiceGeneralMutexHandle = rtosalMutexNew((const rtosal_char_t *)"CS_MUT_DATA_PLANE");
     if (CellularServiceGeneralMutexHandle == NULL)
     {
@@ -432,6 +565,13 @@ CS_Bool_t osCDS_cellular_service_init(void)
       /* Platform is reset */
       ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 2, ERROR_FATAL);
     }
+    CellularServiceSocketMutexHandle = rtosalMutexNew((const rtosal_char_t *)"CS_MUT_SOCKET_TABLE");
+    if (CellularServiceSocketMutexHandle == NULL)
+    {
+      result = CELLULAR_FALSE;
+      /* Platform is reset */
+      ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 3, ERROR_FATAL);
+    }
 
     /* To do next line of code not done under if result == CELLULAR_TRUE
        because if result == CELLULAR_FALSE platform is reset (avoid quality error)
@@ -457,9 +597,9 @@ CS_Status_t osCDS_get_net_status(CS_RegistrationStatus_t *p_reg_status)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
   result = CS_get_net_status(p_reg_status);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -474,9 +614,9 @@ CS_Status_t osCDS_get_device_info(CS_DeviceInfo_t *p_devinfo)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
   result = CS_get_device_info(p_devinfo);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -493,9 +633,9 @@ CS_Status_t osCDS_subscribe_net_event(CS_UrcEvent_t event, cellular_urc_callback
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_subscribe_net_event(event,  urc_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -512,9 +652,9 @@ CS_Status_t osCDS_subscribe_modem_event(CS_ModemEvent_t events_mask, cellular_mo
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_subscribe_modem_event(events_mask, modem_evt_cb);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -531,9 +671,9 @@ CS_Status_t osCDS_power_on(void)
 
   if (cst_context.modem_on == false)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_CONTROL);
     result = CS_power_on();
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
     if (result == CELLULAR_OK)
     {
       cst_context.modem_on = true;
@@ -554,9 +694,9 @@ CS_Status_t osCDS_power_off(void)
 
   if (cst_context.modem_on == true)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_gate_enter(CS_GATE_PRIO_CONTROL);
     result = CS_power_off();
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_gate_leave();
     if (result == CELLULAR_OK)
     {
       cst_context.modem_on = false;
@@ -575,9 +715,9 @@ CS_Status_t osCDS_reset(CS_Reset_t rst_type)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_reset(rst_type);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -595,9 +735,9 @@ CS_Status_t osCDS_init_modem(CS_ModemInit_t init,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_init_modem(init,  reset, pin_code);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -635,9 +775,9 @@ CS_Status_t osCDS_register_net(CS_OperatorSelector_t *p_operator,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_register_net(p_operator, p_reg_status);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -651,9 +791,9 @@ CS_Status_t osCS_detach_PS_domain(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_detach_PS_domain();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -668,9 +808,9 @@ CS_Status_t osCDS_get_attach_status(CS_PSattach_t *p_attach)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
   result = CS_get_attach_status(p_attach);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -686,9 +826,9 @@ CS_Status_t osCDS_attach_PS_domain(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_attach_PS_domain();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -706,9 +846,9 @@ CS_Status_t osCDS_define_pdn(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_define_pdn(cid, apn, pdn_conf);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -727,9 +867,9 @@ CS_Status_t osCDS_register_pdn_event(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_register_pdn_event(cid,  pdn_event_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -745,9 +885,9 @@ CS_Status_t osCDS_set_default_pdn(CS_PDN_conf_id_t cid)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_set_default_pdn(cid);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -764,9 +904,9 @@ CS_Status_t osCDS_activate_pdn(CS_PDN_conf_id_t cid)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_activate_pdn(cid);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -782,9 +922,9 @@ CS_Status_t osCDS_suspend_data(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_suspend_data();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -799,9 +939,9 @@ CS_Status_t osCDS_resume_data(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_resume_data();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -820,9 +960,9 @@ CS_Status_t osCDS_dns_request(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CDS_dns_request(cid, dns_req, dns_resp);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -841,9 +981,9 @@ CS_Status_t osCDS_ping(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
   result = CDS_ping(cid, ping_params, cs_ping_rsp_cb);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -861,9 +1001,9 @@ CS_Status_t osCDS_direct_cmd(CS_direct_cmd_tx_t *direct_cmd_tx,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result =  CS_direct_cmd(direct_cmd_tx, direct_cmd_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -880,9 +1020,9 @@ CS_Status_t osCDS_get_dev_IP_address(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_BACKGROUND);
   result = CS_get_dev_IP_address(cid, ip_addr_type, p_ip_addr_value);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -899,9 +1039,9 @@ CS_Status_t osCS_sim_select(CS_SimSlot_t simSelected)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_sim_select(simSelected);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -918,9 +1058,9 @@ int32_t osCS_sim_generic_access(CS_sim_generic_access_t *sim_generic_access)
 {
   int32_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_sim_generic_access(sim_generic_access);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -941,9 +1081,9 @@ CS_Status_t osCS_InitPowerConfig(CS_init_power_config_t *p_power_config,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_InitPowerConfig(p_power_config, power_status_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -958,9 +1098,9 @@ CS_Status_t osCS_PowerWakeup(CS_wakeup_origin_t wakeup_origin)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_PowerWakeup(wakeup_origin);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -976,9 +1116,9 @@ CS_Status_t osCS_SleepCancel(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_SleepCancel();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -993,9 +1133,9 @@ CS_Status_t osCS_SleepRequest(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_SleepRequest();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -1010,9 +1150,9 @@ CS_Status_t osCS_SleepComplete(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_SleepComplete();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
@@ -1027,9 +1167,9 @@ CS_Status_t osCS_SetPowerConfig(CS_set_power_config_t *p_power_config)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_gate_enter(CS_GATE_PRIO_CONTROL);
   result = CS_SetPowerConfig(p_power_config);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_gate_leave();
 
   return (result);
 }
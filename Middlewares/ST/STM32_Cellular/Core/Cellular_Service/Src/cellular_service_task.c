@@ -2896,6 +2896,8 @@ CS_Status_t CST_cellular_service_start(void)
   dc_nfmc_info_t  nfmc_info;
   uint32_t        cst_polling_period;
   dc_com_status_t dc_ret;
+  dc_com_reg_id_t reg_id;
+  dc_com_event_mask_t event_mask;
   uint32_t        cs_ret;
   CS_Status_t     cst_ret;
   rtosalStatus    os_ret;
@@ -2949,10 +2951,24 @@ CS_Status_t CST_cellular_service_start(void)
 #endif  /* (USE_LOW_POWER == 1) */
 
   /* register component to Data Cache  */
-  if (dc_com_core_register_gen_event_cb(&dc_com_db, CST_notif_callback, (const void *)NULL) == DC_COM_INVALID_ENTRY)
+  reg_id = dc_com_core_register_gen_event_cb(&dc_com_db, CST_notif_callback, (const void *)NULL);
+  if (reg_id == DC_COM_INVALID_ENTRY)
   {
     dc_ret = DC_COM_ERROR;
   }
+  else
+  {
+    /* Only the entries managed by CST_notif_callback are notified */
+    event_mask = DC_COM_EVENT_MASK(DC_CELLULAR_DATA_INFO) | DC_COM_EVENT_MASK(DC_CELLULAR_TARGET_STATE_CMD)
+                 | DC_COM_EVENT_MASK(DC_CELLULAR_CONFIG);
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
+    event_mask |= DC_COM_EVENT_MASK(DC_CELLULAR_INFO);
+#endif /*(USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
+#if (USE_LOW_POWER == 1)
+    event_mask |= DC_COM_EVENT_MASK(DC_CELLULAR_POWER_CONFIG);
+#endif /* (USE_LOW_POWER == 1) */
+    (void)dc_com_set_event_mask(&dc_com_db, reg_id, event_mask);
+  }
 
   cst_cellular_info.mno_name[0]           = 0U;
   cst_cellular_info.rt_state              = DC_SERVICE_UNAVAIL;
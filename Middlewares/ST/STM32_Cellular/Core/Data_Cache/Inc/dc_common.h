@@ -50,6 +50,13 @@ extern "C" {
   when a Data Cache data entry has been updated.
   Subscription is done through dc_com_register_gen_event_cb() service
   Read of data entry value is done by calling dc_com_read() service.
+  Each entry has a sequence counter updated by dc_com_write(): reads do not lock the Data Cache
+  and are retried if the entry has been written meanwhile.
+  The callbacks are called once the written entry is released, so they can read the Data Cache.
+  By default a consumer is notified of all the events. With dc_com_set_event_mask() it selects
+  the entries it is notified for.
+  A coalescing window can be set on a high-rate entry with dc_com_set_coalescing(): the writes done
+  during the window produce a single notification at the end of the window.
 
   The Data Cache structure includes the rt_state field.
   This field contains the state of service and the validity of entry data.
@@ -132,7 +139,11 @@ extern "C" {
     {
       * Data Cache entry structure registration
       * registration allows consumer to be notified when an entry is produced in Data Cache
-      (void)dc_com_register_gen_event_cb(&dc_com_db, dc_consumer_example_notif_callback, (void *) NULL);
+      dc_com_reg_id_t reg_id;
+      reg_id = dc_com_register_gen_event_cb(&dc_com_db, dc_consumer_example_notif_callback, (void *) NULL);
+
+      * Only DC_PRODUCER_EXAMPLE_ENTRY updates are notified to this consumer
+      (void)dc_com_set_event_mask(&dc_com_db, reg_id, DC_COM_EVENT_MASK(DC_PRODUCER_EXAMPLE_ENTRY));
     }
 
     ---------------------------------------------------------------------------------------
@@ -206,7 +217,9 @@ extern "C" {
 #define DC_COM_MAX_NB_APPLI_SUBSCRIBER ((APPLICATION_DATACACHE_NB) + 1U) /* +1U for CellularControl */
 /* Number of internal core subscribers allowed for datacache */
 /* According to dc_com_reg_id_t type, and DC_COM_INVALID_ENTRY error code, should not exceed 254 */
-#define DC_COM_MAX_NB_CORE_SUBSCRIBER  (3U) /* 3U: CellularServiceTask, ComIcc, ComSocketsIpModem */
+/* 3U: CellularServiceTask, ComIcc, and ComSocketsIpModem (modem sockets)
+       or ComSocketsLwipMcu (LwIP sockets, only when COM_SOCKETS_DNS_CACHE is activated) */
+#define DC_COM_MAX_NB_CORE_SUBSCRIBER  (3U)
 /* Grand total of all subscribers allowed for datacache */
 /* According to dc_com_reg_id_t type, and DC_COM_INVALID_ENTRY error code, should not exceed 254 */
 #define DC_COM_MAX_NB_SUBSCRIBER (DC_COM_MAX_NB_CORE_SUBSCRIBER + DC_COM_MAX_NB_APPLI_SUBSCRIBER)
@@ -224,6 +237,17 @@ extern "C" {
 /** @brief Invalid entry: at creation, the Data Cache entries must be initialized with this value  */
 #define DC_COM_INVALID_ENTRY  0xFFU
 
+/** @brief Number of events that can be selected in a consumer event mask.
+  *        Events with a higher identifier are always notified. */
+#define DC_COM_EVENT_MASK_NB  (32U)
+
+#if (DC_COM_ENTRY_MAX_NB > DC_COM_EVENT_MASK_NB)
+#error "DC_COM_ENTRY_MAX_NB must not exceed DC_COM_EVENT_MASK_NB"
+#endif /* DC_COM_ENTRY_MAX_NB > DC_COM_EVENT_MASK_NB */
+
+/** @brief Event mask selecting all the events (default mask of a registered consumer) */
+#define DC_COM_EVENT_MASK_ALL (0xFFFFFFFFU)
+
 /**
   * @}
   */
@@ -239,6 +263,8 @@ typedef uint16_t dc_com_res_id_t;   /*!< type of identifier of the registered Da
 
 typedef uint16_t dc_com_event_id_t; /*!< type of Data Cache event */
 
+typedef uint32_t dc_com_event_mask_t; /*!< type of Data Cache event mask: bit n set to be notified of event n */
+
 typedef bool  dc_com_status_t;   /*!< type of Data Cache return code  */
 #define   DC_COM_OK     (dc_com_status_t)true   /*!< Ok  */
 #define   DC_COM_ERROR  (dc_com_status_t)false  /*!< Error  */
@@ -281,6 +307,7 @@ typedef struct
   dc_com_reg_id_t consumer_reg_id;
   dc_com_gen_event_callback_t notif_cb;    /* Call back not registered by API                                         */
   const void *private_consumer_data;       /* Private data associated with call back                                  */
+  dc_com_event_mask_t event_mask;          /* Events notified to the consumer                                         */
 } dc_com_consumer_info_t;
 
 /** @brief type of Data Cache global structure (Data Cache internal use) */
@@ -292,6 +319,7 @@ typedef struct
   dc_com_consumer_info_t consumer_info[DC_COM_MAX_NB_SUBSCRIBER];
   void *p_dc_db[DC_COM_ENTRY_MAX_NB];
   uint16_t dc_db_len[DC_COM_ENTRY_MAX_NB];
+  volatile uint32_t dc_db_seq[DC_COM_ENTRY_MAX_NB]; /* entry sequence counter: odd while the entry is written */
 } dc_com_db_t;
 
 /**
@@ -315,6 +343,10 @@ extern dc_com_db_t dc_com_db; /*!< Data Cache Database Identifier */
   * @{
   */
 
+/** @brief Event mask of an entry/event id (0U if the event can not be selected by a mask) */
+#define DC_COM_EVENT_MASK(event_id) \
+  ((((uint32_t)(event_id)) < DC_COM_EVENT_MASK_NB) ? ((dc_com_event_mask_t)1U << (uint32_t)(event_id)) : 0U)
+
 /**
   * @}
   */
@@ -341,7 +373,8 @@ dc_com_res_id_t dc_com_register_serv(dc_com_db_t *p_dc_db, void *p_data, uint16_
   * @param  notif_cb        - address of callback.
   * @note                     This callback is called when a Data Cache event
   *                           is sent by a call to dc_com_write_event.
-  *                           The callback is executed in the writing thread context.
+  *                           The callback is executed in the writing thread context,
+  *                           after the Data Cache entry is released.
   * @param  p_private_data  - address of consumer private context (optional).
   * @note                     This address is passed as a parameter of the callback
   * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
@@ -357,7 +390,8 @@ dc_com_reg_id_t dc_com_core_register_gen_event_cb(dc_com_db_t *p_dc_db,
   * @param  notif_cb        - address of callback.
   * @note                     This callback is called when a Data Cache event
   *                           is sent by a call to dc_com_write_event.
-  *                           The callback is executed in the writing thread context.
+  *                           The callback is executed in the writing thread context,
+  *                           after the Data Cache entry is released.
   * @param  p_private_data  - address of consumer private context (optional).
   * @note                     This address is passed as a parameter of the callback
   * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
@@ -386,6 +420,26 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
   */
 dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len);
 
+/**
+  * @brief  Select the events notified to a registered consumer.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  reg_id          - identifier returned by the consumer registration
+  * @param  event_mask      - events to notify, built with DC_COM_EVENT_MASK() (DC_COM_EVENT_MASK_ALL by default)
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_set_event_mask(dc_com_db_t *p_dc_db, dc_com_reg_id_t reg_id, dc_com_event_mask_t event_mask);
+
+/**
+  * @brief  Set the coalescing window of a Data Cache entry.
+  * @note   The first update of the entry starts the window, the notification is sent at its end
+  *         with the last written value. The callbacks are then executed in the timer thread context.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  res_id          - entry/resource id
+  * @param  window_ms       - coalescing window in ms (0U: each update is notified immediately)
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_set_coalescing(dc_com_db_t *p_dc_db, dc_com_res_id_t res_id, uint32_t window_ms);
+
 
 /**
   * @}
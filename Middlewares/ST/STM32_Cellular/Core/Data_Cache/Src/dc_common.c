@@ -26,6 +26,15 @@
 #include "error_handler.h"
 
 /* Private typedef -----------------------------------------------------------*/
+/* Coalescing of the notifications of an entry */
+typedef struct
+{
+  osTimerId       timer;     /* one-shot timer ending the coalescing window                */
+  uint32_t        window_ms; /* coalescing window in ms, 0U: no coalescing                 */
+  bool            pending;   /* a notification is sent at the end of the running window    */
+  dc_com_db_t     *p_dc;     /* data base of the entry                                     */
+  dc_com_res_id_t res_id;    /* entry/resource id                                          */
+} dc_com_coalesce_t;
 /** @brief Mandatory type header for data cache consumers structures */
 typedef struct
 {
@@ -34,6 +43,9 @@ typedef struct
 } dc_base_rt_info_t;
 
 /* Private defines -----------------------------------------------------------*/
+/* Number of lock-free read attempts before reading an entry under the writers mutex */
+#define DC_COM_READ_RETRY_MAX  (2U)
+
 /* Private macros ------------------------------------------------------------*/
 
 #if (USE_TRACE_CELLULAR_SERVICE == 1U)
@@ -80,11 +92,17 @@ void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db,
                                          uint8_t id,
                                          dc_com_gen_event_callback_t notif_cb,
                                          const void *p_private_data);
+static void dc_com_notify(const dc_com_db_t *p_dc, dc_com_event_id_t event_id);
+static void dc_com_coalesce_timer_cb(void *p_argument);
 
 /* Private variables ---------------------------------------------------------*/
 
 /* Mutex to avoid  Data Cache concurrent access */
 static osMutexId dc_common_mutex;
+/* Mutex to serialize the notifications: callbacks of an event are all called before the ones of the next event */
+static osMutexId dc_notif_mutex;
+/* Coalescing state of each entry */
+static dc_com_coalesce_t dc_com_coalesce[DC_COM_ENTRY_MAX_NB];
 
 /* Functions Definition ------------------------------------------------------*/
 
@@ -218,6 +236,56 @@ void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db,
   p_dc_db->consumer_info[id].consumer_reg_id       = id;
   p_dc_db->consumer_info[id].notif_cb              = notif_cb;
   p_dc_db->consumer_info[id].private_consumer_data = p_private_data;
+  p_dc_db->consumer_info[id].event_mask            = DC_COM_EVENT_MASK_ALL;
+}
+
+/**
+  * @brief  Call the callbacks of all registered consumers for an event.
+  * @note   Called without holding the Data Cache mutex: a slow callback does not block the entries access.
+  * @param  p_dc            - data base reference (Must be set to &dc_com_db)
+  * @param  event_id        - event id
+  * @retval -
+  */
+static void dc_com_notify(const dc_com_db_t *p_dc, dc_com_event_id_t event_id)
+{
+  dc_com_reg_id_t reg_id;
+
+  /* Avoid to be interrupted by another event before the end of first event processing */
+  (void)rtosalMutexAcquire(dc_notif_mutex, RTOSAL_WAIT_FOREVER);
+
+  /* In consumer_info array, core consumers are place at the beginning, and application after */
+  /* So for loops from the beginning to the last application registered */
+  for (reg_id = 0U; reg_id < p_dc->consumer_appli_number; reg_id++)
+  {
+    const dc_com_consumer_info_t *consumer_info;
+    consumer_info = &(p_dc->consumer_info[reg_id]);
+
+    /* Events out of the mask range can not be filtered */
+    if ((consumer_info->notif_cb != NULL)
+        && ((event_id >= DC_COM_EVENT_MASK_NB) || ((consumer_info->event_mask & DC_COM_EVENT_MASK(event_id)) != 0U)))
+    {
+      /* let's call now the call back                                                  */
+      consumer_info->notif_cb(event_id, consumer_info->private_consumer_data);
+    }
+  }
+  (void)rtosalMutexRelease(dc_notif_mutex);
+}
+
+/**
+  * @brief  End of the coalescing window of an entry: notify its last update.
+  * @param  p_argument      - coalescing state of the entry
+  * @retval -
+  */
+static void dc_com_coalesce_timer_cb(void *p_argument)
+{
+  dc_com_coalesce_t *p_coalesce = (dc_com_coalesce_t *)p_argument;
+
+  /* Next update starts a new window */
+  (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+  p_coalesce->pending = false;
+  (void)rtosalMutexRelease(dc_common_mutex);
+
+  dc_com_notify(p_coalesce->p_dc, (dc_com_event_id_t)p_coalesce->res_id);
 }
 
 
@@ -231,41 +299,55 @@ void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db,
   */
 dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const void *p_data, uint32_t len)
 {
-  dc_com_reg_id_t reg_id;
   dc_base_rt_info_t *dc_base_rt_info;
   dc_com_status_t res;
   dc_com_db_t *com_db = (dc_com_db_t *)p_dc;
+  bool changed;
+  bool notify = false;
 
   if ((p_dc != NULL) && (res_id != DC_COM_INVALID_ENTRY) && (res_id < com_db->serv_number) &&
       (com_db->dc_db_len[res_id] >= len) && (p_data != NULL))
   {
+    /* Writers are serialized: only one writer updates the entry and its sequence counter */
+    (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+
     /* check that something has changed in data to write */
     /* if nothing changed, just do nothing */
-    if (memcmp(com_db->p_dc_db[res_id], p_data, len) != 0)
+    changed = (memcmp(com_db->p_dc_db[res_id], p_data, len) != 0);
+    if (changed)
     {
       /* Something changed, in the input data (p_data). Write the new data to the Data Cache structure */
-      /* Avoid to be interrupted by another event before the end of first event processing */
-      (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
-
+      /* Odd sequence counter: lock-free readers retry until the write is complete */
+      com_db->dc_db_seq[res_id]++;
+      __DMB();
       (void)memcpy((void *)(com_db->p_dc_db[res_id]), p_data, (uint32_t)len);
       dc_base_rt_info = (dc_base_rt_info_t *)(com_db->p_dc_db[res_id]);
       dc_base_rt_info->header.res_id = res_id;
       dc_base_rt_info->header.size   = len;
+      __DMB();
+      com_db->dc_db_seq[res_id]++;
 
-      /* In consumer_info array, core consumers are place at the beginning, and application after */
-      /* So for loops from the beginning to the last application registered */
-      for (reg_id = 0U; reg_id < p_dc->consumer_appli_number; reg_id++)
+      if (dc_com_coalesce[res_id].window_ms == 0U)
       {
-        dc_com_consumer_info_t *consumer_info;
-        consumer_info = &(com_db->consumer_info[reg_id]);
-
-        if (consumer_info->notif_cb != NULL)
-        {
-          /* let's call now the call back                                                  */
-          consumer_info->notif_cb((dc_com_event_id_t)res_id, consumer_info->private_consumer_data);
-        }
+        notify = true;
+      }
+      else if (dc_com_coalesce[res_id].pending == false)
+      {
+        /* First update of the window: the notification is sent at the end of the window */
+        dc_com_coalesce[res_id].pending = true;
+        (void)rtosalTimerStart(dc_com_coalesce[res_id].timer, dc_com_coalesce[res_id].window_ms);
+      }
+      else
+      {
+        __NOP(); /* Notification already scheduled: it will report this update */
       }
-      (void)rtosalMutexRelease(dc_common_mutex);
+    }
+    (void)rtosalMutexRelease(dc_common_mutex);
+
+    if (notify == true)
+    {
+      /* consumers are notified once the entry is released */
+      dc_com_notify(com_db, (dc_com_event_id_t)res_id);
     }
     res = DC_COM_OK;
   }
@@ -279,6 +361,8 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
 
 /**
   * @brief  Allow a consumer to read the currents data associated to a Data Cache entry.
+  * @note   The entry is read without lock and read again if a write occurred meanwhile.
+  *         If the entry is being written by a preempted writer, it is read under the writers mutex.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
   * @param  res_id          - entry/resource id
   * @param  p_data          - data to read
@@ -288,11 +372,35 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
 dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len)
 {
   dc_com_status_t res;
+  uint32_t seq_begin;
+  uint32_t retry = 0U;
+  bool done = false;
 
   if ((p_dc != NULL) && (res_id != DC_COM_INVALID_ENTRY) && (res_id < p_dc->serv_number) &&
       (p_dc->dc_db_len[res_id] >= len))
   {
-    (void)memcpy(p_data, (void *)p_dc->p_dc_db[res_id], (uint32_t)len);
+    while ((done == false) && (retry < DC_COM_READ_RETRY_MAX))
+    {
+      seq_begin = p_dc->dc_db_seq[res_id];
+      if ((seq_begin & 1U) == 0U)
+      {
+        __DMB();
+        (void)memcpy(p_data, (void *)p_dc->p_dc_db[res_id], (uint32_t)len);
+        __DMB();
+        /* copy is consistent if no write started meanwhile */
+        done = (p_dc->dc_db_seq[res_id] == seq_begin);
+      }
+      retry++;
+    }
+
+    if (done == false)
+    {
+      /* Write in progress: the writer may be preempted by this reader, spinning would block it.
+       * The mutex lets the writer complete (priority inheritance) before the copy. */
+      (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+      (void)memcpy(p_data, (void *)p_dc->p_dc_db[res_id], (uint32_t)len);
+      (void)rtosalMutexRelease(dc_common_mutex);
+    }
     res = DC_COM_OK;
   }
   else
@@ -304,6 +412,74 @@ dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_d
   return res;
 }
 
+/**
+  * @brief  Select the events notified to a registered consumer.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  reg_id          - identifier returned by the consumer registration
+  * @param  event_mask      - events to notify, built with DC_COM_EVENT_MASK() (DC_COM_EVENT_MASK_ALL by default)
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_set_event_mask(dc_com_db_t *p_dc_db, dc_com_reg_id_t reg_id, dc_com_event_mask_t event_mask)
+{
+  dc_com_status_t res;
+
+  if ((p_dc_db != NULL) && (reg_id < DC_COM_MAX_NB_SUBSCRIBER) && (p_dc_db->consumer_info[reg_id].notif_cb != NULL))
+  {
+    (void)rtosalMutexAcquire(dc_notif_mutex, RTOSAL_WAIT_FOREVER);
+    p_dc_db->consumer_info[reg_id].event_mask = event_mask;
+    (void)rtosalMutexRelease(dc_notif_mutex);
+    res = DC_COM_OK;
+  }
+  else
+  {
+    res = DC_COM_ERROR;
+    PRINT_ERR("dc_com_set_event_mask : Invalid consumer")
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Set the coalescing window of a Data Cache entry.
+  * @note   The first update of the entry starts the window, the notification is sent at its end
+  *         with the last written value. The callbacks are then executed in the timer thread context.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  res_id          - entry/resource id
+  * @param  window_ms       - coalescing window in ms (0U: each update is notified immediately)
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_set_coalescing(dc_com_db_t *p_dc_db, dc_com_res_id_t res_id, uint32_t window_ms)
+{
+  dc_com_status_t res = DC_COM_ERROR;
+
+  if ((p_dc_db != NULL) && (res_id != DC_COM_INVALID_ENTRY) && (res_id < p_dc_db->serv_number))
+  {
+    (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+    if ((window_ms != 0U) && (dc_com_coalesce[res_id].timer == NULL))
+    {
+      dc_com_coalesce[res_id].p_dc   = p_dc_db;
+      dc_com_coalesce[res_id].res_id = res_id;
+      dc_com_coalesce[res_id].timer  = rtosalTimerNew((const rtosal_char_t *)"DC_TIM_COALESCE",
+                                                      (os_ptimer)dc_com_coalesce_timer_cb, osTimerOnce,
+                                                      (void *)&dc_com_coalesce[res_id]);
+    }
+    /* A pending notification is still sent at the end of the running window */
+    if ((window_ms == 0U) || (dc_com_coalesce[res_id].timer != NULL))
+    {
+      dc_com_coalesce[res_id].window_ms = window_ms;
+      res = DC_COM_OK;
+    }
+    (void)rtosalMutexRelease(dc_common_mutex);
+  }
+
+  if (res == DC_COM_ERROR)
+  {
+    PRINT_ERR("dc_com_set_coalescing : Impossible to set coalescing")
+  }
+
+  return res;
+}
+
 /**
   * @brief  Send an event to DC.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
@@ -312,29 +488,12 @@ dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_d
   */
 dc_com_status_t dc_com_write_event(dc_com_db_t *p_dc, dc_com_event_id_t event_id)
 {
-  dc_com_reg_id_t reg_id;
-  const dc_com_db_t *com_db = (dc_com_db_t *)p_dc;
   dc_com_status_t res;
 
   if (p_dc != NULL)
   {
-    /* Avoid to be interrupted by another event before the end of first event processing */
-    (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
-
     /* Calls all registered callback notification */
-    /* In consumer_info array, core consumers are place at the beginning, and application after */
-    /* So for loops from the beginning to the last application registered */
-
-    for (reg_id = 0U; reg_id <  p_dc->consumer_appli_number; reg_id++)
-    {
-      const dc_com_consumer_info_t *consumer_info;
-      consumer_info = &(com_db->consumer_info[reg_id]);
-      if (consumer_info->notif_cb != NULL)
-      {
-        consumer_info->notif_cb(event_id, consumer_info->private_consumer_data);
-      }
-    }
-    (void)rtosalMutexRelease(dc_common_mutex);
+    dc_com_notify(p_dc, event_id);
     res = DC_COM_OK;
   }
   else
@@ -352,6 +511,7 @@ dc_com_status_t dc_com_write_event(dc_com_db_t *p_dc, dc_com_event_id_t event_id
 void dc_com_init(dc_com_db_t *p_dc)
 {
   (void)memset(p_dc, 0, sizeof(dc_com_db_t));
+  (void)memset(dc_com_coalesce, 0, sizeof(dc_com_coalesce));
   /* Start to register the appli consumers after all the core consumers. */
   p_dc->consumer_appli_number = DC_COM_MAX_NB_CORE_SUBSCRIBER;
 
@@ -360,6 +520,12 @@ void dc_com_init(dc_com_db_t *p_dc)
   {
     ERROR_Handler(DBG_CHAN_UTILITIES, 1, ERROR_FATAL);
   }
+
+  dc_notif_mutex = rtosalMutexNew((const rtosal_char_t *)"DC_MUT_NOTIF");
+  if (dc_notif_mutex == NULL)
+  {
+    ERROR_Handler(DBG_CHAN_UTILITIES, 2, ERROR_FATAL);
+  }
 }
 
 /**
@@ -38,6 +38,8 @@ extern "C" {
 * - IPC_USE_UART: set to 1 is IPC uses UART (ONLY UART IS SUPPORTED ACTUALLY)
 * - IPC_USE_SPI: 0
 * - IPC_USE_I2C: 0
+* - IPC_RX_MODE_DEVICE_x: (optional) RX mode of IPC device x, IPC_RX_MODE_IT (default) or IPC_RX_MODE_DMA
+* - IPC_RXDMA_BUFFER_SIZE: size of the circular DMA buffer (needed only if one device uses IPC_RX_MODE_DMA)
 * - DBG_IPC_RX_FIFO: set to 1 for additional debug information
 */
 
@@ -66,6 +68,30 @@ extern "C" {
 #define  IPC_RXMSG_HEADER_SIZE_MASK       ((uint8_t) 0x7FU)
 #define  IPC_DEVICE_NOT_FOUND             ((uint8_t) 0xFFU)
 
+/* IPC RX modes */
+#define IPC_RX_MODE_IT   (0U) /* one UART interrupt per received character */
+#define IPC_RX_MODE_DMA  (1U) /* circular DMA: received spans are handed to the RX FIFO on HT/TC/idle-line events */
+
+#if !defined(IPC_RX_MODE_DEVICE_0)
+#define IPC_RX_MODE_DEVICE_0  IPC_RX_MODE_IT
+#endif /* !defined(IPC_RX_MODE_DEVICE_0) */
+#if !defined(IPC_RX_MODE_DEVICE_1)
+#define IPC_RX_MODE_DEVICE_1  IPC_RX_MODE_IT
+#endif /* !defined(IPC_RX_MODE_DEVICE_1) */
+#if !defined(IPC_RX_MODE_DEVICE_2)
+#define IPC_RX_MODE_DEVICE_2  IPC_RX_MODE_IT
+#endif /* !defined(IPC_RX_MODE_DEVICE_2) */
+
+#if ((IPC_RX_MODE_DEVICE_0 == IPC_RX_MODE_DMA) || (IPC_RX_MODE_DEVICE_1 == IPC_RX_MODE_DMA) \
+     || (IPC_RX_MODE_DEVICE_2 == IPC_RX_MODE_DMA))
+#define IPC_USE_RX_DMA  (1U)
+#if !defined(IPC_RXDMA_BUFFER_SIZE)
+#define IPC_RXDMA_BUFFER_SIZE  ((uint16_t) 256U)
+#endif /* !defined(IPC_RXDMA_BUFFER_SIZE) */
+#else
+#define IPC_USE_RX_DMA  (0U)
+#endif /* IPC_RX_MODE_DEVICE_x == IPC_RX_MODE_DMA */
+
 /* Exported types ------------------------------------------------------------*/
 typedef uint8_t IPC_CHAR_t;
 
@@ -159,16 +185,21 @@ typedef struct
   uint16_t     current_msg_index;
   uint16_t     current_msg_size;
   uint8_t      nb_unread_msg;
+  uint16_t     dropped_count;   /* characters lost because the queue was full */
 } IPC_RxQueue_t;
 
 #if (IPC_USE_STREAM_MODE == 1U)
+/* Single producer / single consumer ring: index_write is only updated by the UART callback (under IT)
+ * and index_read only by the reader, so no interrupt masking is needed to access it.
+ * One byte is kept free to distinguish a full ring from an empty one.
+ */
 typedef struct
 {
-  uint8_t      data[IPC_RXBUF_STREAM_MAXSIZE];
-  uint16_t     index_read;
-  uint16_t     index_write;
-  uint16_t     available_char;
-  uint16_t     total_rcv_count;
+  uint8_t        data[IPC_RXBUF_STREAM_MAXSIZE];
+  __IO uint16_t  index_read;
+  __IO uint16_t  index_write;
+  uint16_t       total_rcv_count;
+  uint16_t       dropped_count;   /* characters lost because the ring was full */
 } IPC_RxBuffer_t;
 #endif  /* IPC_USE_STREAM_MODE */
 
@@ -179,7 +210,14 @@ typedef void (*IPC_RxCallbackTypeDef)(struct IPC_Handle_struct_t *hipc);
 typedef void (*IPC_TxCallbackTypeDef)(struct IPC_Handle_struct_t *hipc);
 typedef void (*IPC_ErrCallbackTypeDef)(struct IPC_Handle_struct_t *hipc);
 typedef void (*IPC_RXFIFO_writeTypeDef)(struct IPC_Handle_struct_t *hipc, uint8_t rxChar);
+typedef void (*IPC_RXFIFO_writeSpanTypeDef)(struct IPC_Handle_struct_t *hipc, const uint8_t *p_span,
+                                            uint16_t span_size);
 typedef uint8_t (*IPC_CheckEndOfMsgCallbackTypeDef)(uint8_t rxChar);
+/* Span variant of IPC_CheckEndOfMsgCallbackTypeDef (optional, used for spans received in IPC_RX_MODE_DMA):
+ * analyzes the span until the first end of message and returns the number of characters up to and including it,
+ * returns 0 if the span does not contain an end of message (all characters have been analyzed).
+ */
+typedef uint16_t (*IPC_CheckEndOfMsgSpanCallbackTypeDef)(const uint8_t *p_span, uint16_t span_size);
 
 typedef struct IPC_Handle_struct_t
 {
@@ -195,7 +233,9 @@ typedef struct IPC_Handle_struct_t
   IPC_TxCallbackTypeDef             TxClientCallback;
   IPC_ErrCallbackTypeDef            ErrorCallback;
   IPC_CheckEndOfMsgCallbackTypeDef  CheckEndOfMsgCallback;
+  IPC_CheckEndOfMsgSpanCallbackTypeDef  CheckEndOfMsgSpanCallback;
   IPC_RXFIFO_writeTypeDef           RxFifoWrite;
+  IPC_RXFIFO_writeSpanTypeDef       RxFifoWriteSpan;
 
 #if (DBG_IPC_RX_FIFO == 1U)
   dbg_rx_queue_info_t         dbgRxQueue;
@@ -207,6 +247,11 @@ typedef struct
   IPC_State_t              state;
   IPC_PhysicalInterface_t  phy_int;
   IPC_CHAR_t               RxChar[1];    /* RX DMA buffer (1 char) - common buffer for one physical interface  */
+  uint8_t                  rx_mode;      /* IPC_RX_MODE_IT or IPC_RX_MODE_DMA */
+#if (IPC_USE_RX_DMA == 1U)
+  IPC_CHAR_t               RxDmaBuf[IPC_RXDMA_BUFFER_SIZE]; /* circular RX DMA buffer (used in IPC_RX_MODE_DMA) */
+  uint16_t                 RxDmaReadPos; /* position of the first byte not yet handed to the RX FIFO */
+#endif /* IPC_USE_RX_DMA == 1U */
   IPC_Handle_t             *h_current_channel;   /* current active IPC channel */
   IPC_Handle_t             *h_inactive_channel;  /* other IPC channel (exists if not NULL), currently not active */
 } IPC_ClientDescription_t;
@@ -226,6 +271,8 @@ IPC_Status_t IPC_open(IPC_Handle_t      *const hipc,
                       IPC_TxCallbackTypeDef pTxClientCallback,
                       IPC_ErrCallbackTypeDef pErrorClientCallback,
                       IPC_CheckEndOfMsgCallbackTypeDef pCheckEndOfMsg);
+IPC_Status_t IPC_setCheckEndOfMsgSpanCallback(IPC_Handle_t *const hipc,
+                                              IPC_CheckEndOfMsgSpanCallbackTypeDef pCheckEndOfMsgSpan);
 IPC_Status_t IPC_close(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_select(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_reset(IPC_Handle_t *const hipc);
@@ -233,7 +280,12 @@ IPC_Status_t IPC_abort(IPC_Handle_t *const hipc);
 IPC_Handle_t *IPC_get_other_channel(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize);
 IPC_Status_t IPC_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg);
+IPC_Status_t IPC_receiveData(IPC_Handle_t *const hipc, uint8_t *const p_data, uint16_t *const p_data_size,
+                             IPC_RxMessage_t *const p_msg);
 IPC_Status_t IPC_streamReceive(IPC_Handle_t *const hipc, uint8_t *const p_buffer, int16_t *const p_len);
+uint16_t IPC_streamAvailable(IPC_Handle_t *const hipc);
+IPC_Status_t IPC_streamGetSpan(IPC_Handle_t *const hipc, uint8_t **const pp_span, uint16_t *const p_span_size);
+IPC_Status_t IPC_streamReleaseSpan(IPC_Handle_t *const hipc, uint16_t span_size);
 void IPC_DumpRXQueue(IPC_Handle_t *const hipc, uint8_t readable);
 
 #ifdef __cplusplus
@@ -38,10 +38,15 @@ extern "C" {
 /* Exported functions ------------------------------------------------------- */
 void IPC_RXFIFO_init(IPC_Handle_t *const hipc);
 void IPC_RXFIFO_writeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar);
+void IPC_RXFIFO_writeCharacterSpan(IPC_Handle_t *const hipc, const uint8_t *p_span, uint16_t span_size);
 int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg);
+int16_t IPC_RXFIFO_readData(IPC_Handle_t *const hipc, uint8_t *p_data, uint16_t *p_data_size,
+                            IPC_RxMessage_t *pMsg);
 #if (IPC_USE_STREAM_MODE == 1U)
 void IPC_RXFIFO_stream_init(IPC_Handle_t *const hipc);
 void IPC_RXFIFO_writeStream(IPC_Handle_t *const hipc, uint8_t rxChar);
+void IPC_RXFIFO_writeStreamSpan(IPC_Handle_t *const hipc, const uint8_t *p_span, uint16_t span_size);
+uint16_t IPC_RXFIFO_streamAvailable(const IPC_Handle_t *const hipc);
 #endif /* IPC_USE_STREAM_MODE == 1U */
 uint16_t IPC_RXFIFO_getFreeBytes(IPC_Handle_t *const hipc);
 void IPC_RXFIFO_readMsgHeader_at_pos(const IPC_Handle_t *const hipc, IPC_RxHeader_t *pHeader, uint16_t pos);
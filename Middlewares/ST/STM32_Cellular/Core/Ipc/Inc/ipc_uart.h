@@ -49,7 +49,11 @@ IPC_Status_t IPC_UART_abort(IPC_Handle_t *const hipc);
 IPC_Handle_t *IPC_UART_get_other_channel(const IPC_Handle_t *const hipc);
 IPC_Status_t IPC_UART_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize);
 IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg);
+IPC_Status_t IPC_UART_receiveData(IPC_Handle_t *const hipc, uint8_t *const p_data, uint16_t *const p_data_size,
+                                  IPC_RxMessage_t *const p_msg);
 IPC_Status_t IPC_UART_streamReceive(IPC_Handle_t *const hipc,  uint8_t *const p_buffer, int16_t *const p_len);
+IPC_Status_t IPC_UART_streamGetSpan(IPC_Handle_t *const hipc, uint8_t **const pp_span, uint16_t *const p_span_size);
+IPC_Status_t IPC_UART_streamReleaseSpan(IPC_Handle_t *const hipc, uint16_t span_size);
 void IPC_UART_rearm_RX_IT(IPC_Handle_t *const hipc);
 
 #if (DBG_IPC_RX_FIFO == 1U)
@@ -59,6 +63,9 @@ void IPC_UART_DumpRXQueue(const IPC_Handle_t *const hipc, uint8_t readable);
 void IPC_UART_RxCpltCallback(UART_HandleTypeDef *UartHandle);
 void IPC_UART_TxCpltCallback(UART_HandleTypeDef *UartHandle);
 void IPC_UART_ErrorCallback(UART_HandleTypeDef *UartHandle);
+#if (IPC_USE_RX_DMA == 1U)
+void IPC_UART_RxEventCallback(UART_HandleTypeDef *UartHandle, uint16_t Pos);
+#endif /* IPC_USE_RX_DMA == 1U */
 
 #ifdef __cplusplus
 }
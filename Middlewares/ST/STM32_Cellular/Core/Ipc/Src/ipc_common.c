@@ -21,6 +21,7 @@
 #include "ipc_common.h"
 #if (IPC_USE_UART == 1U)
 #include "ipc_uart.h"
+#include "ipc_rxfifo.h"
 #endif /* IPC_USE_UART == 1U */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -162,6 +163,33 @@ IPC_Status_t IPC_open(IPC_Handle_t *const hipc,
   return (status);
 }
 
+/**
+  * @brief  Register the span variant of the end of message callback of an opened channel.
+  * @note   Optional: when registered, it is used instead of the character callback to analyze
+  *         the spans received in IPC_RX_MODE_DMA. Both callbacks must share the same automaton.
+  * @param  hipc IPC handle.
+  * @param  pCheckEndOfMsgSpan Callback ptr to the function used to search the end of message in a span
+  *         (NULL to use only the character callback).
+  * @retval status
+  */
+IPC_Status_t IPC_setCheckEndOfMsgSpanCallback(IPC_Handle_t *const hipc,
+                                              IPC_CheckEndOfMsgSpanCallbackTypeDef pCheckEndOfMsgSpan)
+{
+  IPC_Status_t status;
+
+  if ((hipc != NULL) && (hipc->State != IPC_STATE_NOT_INITIALIZED))
+  {
+    hipc->CheckEndOfMsgSpanCallback = pCheckEndOfMsgSpan;
+    status = IPC_OK;
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+}
+
 /**
   * @brief  Close a specific channel.
   * @param  hipc IPC handle to close.
@@ -301,6 +329,34 @@ IPC_Status_t IPC_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
   return (status);
 }
 
+/**
+  * @brief  Receive a message from a channel, the beginning of the message being copied directly
+  *         to a user data buffer.
+  * @note   Used to receive a data payload without intermediate copy.
+  * @param  hipc IPC handle.
+  * @param  p_data Pointer to the user data buffer.
+  * @param  p_data_size Pointer to the size of the user data buffer.
+  *         Updated with the number of bytes copied to the user data buffer.
+  * @param  p_msg Pointer to the IPC message structure to fill with the rest of the received message.
+  * @retval status
+  */
+IPC_Status_t IPC_receiveData(IPC_Handle_t *const hipc, uint8_t *const p_data, uint16_t *const p_data_size,
+                             IPC_RxMessage_t *const p_msg)
+{
+  IPC_Status_t status;
+
+  if ((hipc != NULL) && (p_data_size != NULL))
+  {
+    status = IPC_UART_receiveData(hipc, p_data, p_data_size, p_msg);
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+}
+
 /**
   * @brief  Receive a data buffer from a channel.
   * @param  hipc IPC handle.
@@ -333,6 +389,92 @@ IPC_Status_t IPC_streamReceive(IPC_Handle_t *const hipc, uint8_t *const p_buffer
 #endif  /* IPC_USE_STREAM_MODE == 1U */
 }
 
+/**
+  * @brief  Get number of characters available in the stream mode buffer of a channel.
+  * @note   Can be called without masking the interrupts.
+  * @param  hipc IPC handle.
+  * @retval Number of characters available.
+  */
+uint16_t IPC_streamAvailable(IPC_Handle_t *const hipc)
+{
+#if (IPC_USE_STREAM_MODE == 1U)
+  uint16_t available;
+
+  if (hipc != NULL)
+  {
+    available = IPC_RXFIFO_streamAvailable(hipc);
+  }
+  else
+  {
+    available = 0U;
+  }
+
+  return (available);
+#else
+  UNUSED(hipc);
+  return (0U);
+#endif  /* IPC_USE_STREAM_MODE == 1U */
+}
+
+/**
+  * @brief  Get the characters available in the stream mode buffer of a channel without copying them.
+  * @param  hipc IPC handle.
+  * @param  pp_span Pointer updated with the address of the first available character.
+  * @param  p_span_size Pointer updated with the number of contiguous characters available at this address.
+  * @note   The span stays valid until IPC_streamReleaseSpan() is called.
+  * @retval status
+  */
+IPC_Status_t IPC_streamGetSpan(IPC_Handle_t *const hipc, uint8_t **const pp_span, uint16_t *const p_span_size)
+{
+#if (IPC_USE_STREAM_MODE == 1U)
+  IPC_Status_t status;
+
+  if ((hipc != NULL) && (pp_span != NULL) && (p_span_size != NULL))
+  {
+    status = IPC_UART_streamGetSpan(hipc, pp_span, p_span_size);
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+#else
+  UNUSED(hipc);
+  UNUSED(pp_span);
+  UNUSED(p_span_size);
+  return (IPC_ERROR);
+#endif  /* IPC_USE_STREAM_MODE == 1U */
+}
+
+/**
+  * @brief  Release the characters of a span obtained with IPC_streamGetSpan().
+  * @param  hipc IPC handle.
+  * @param  span_size Number of characters consumed.
+  * @retval status
+  */
+IPC_Status_t IPC_streamReleaseSpan(IPC_Handle_t *const hipc, uint16_t span_size)
+{
+#if (IPC_USE_STREAM_MODE == 1U)
+  IPC_Status_t status;
+
+  if (hipc != NULL)
+  {
+    status = IPC_UART_streamReleaseSpan(hipc, span_size);
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+#else
+  UNUSED(hipc);
+  UNUSED(span_size);
+  return (IPC_ERROR);
+#endif  /* IPC_USE_STREAM_MODE == 1U */
+}
+
 /**
   * @brief  Dump content of IPC Rx queue (for debug purpose).
   * @param  hipc IPC handle.
@@ -18,6 +18,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <string.h>
+#include <stdbool.h>
 #include "ipc_rxfifo.h"
 #include "ipc_common.h"
 #include "plf_config.h"
@@ -27,6 +28,13 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private defines -----------------------------------------------------------*/
+#if (IPC_USE_RX_DMA == 1U)
+/* a complete DMA span can be received after the pause decision: keep enough room for it */
+#define RXFIFO_SPAN_THRESHOLD  ((uint16_t)(IPC_RXBUF_THRESHOLD + IPC_RXDMA_BUFFER_SIZE))
+#else
+#define RXFIFO_SPAN_THRESHOLD  ((uint16_t)(IPC_RXBUF_THRESHOLD))
+#endif /* IPC_USE_RX_DMA == 1U */
+
 /* Private macros ------------------------------------------------------------*/
 #if (USE_TRACE_IPC == 1U)
 #if (USE_PRINTF == 0U)
@@ -66,7 +74,10 @@
 
 /* Private function prototypes -----------------------------------------------*/
 static void RXFIFO_incrementTail(IPC_Handle_t *const hipc, uint16_t inc_size);
-static void RXFIFO_incrementHead(IPC_Handle_t *const hipc);
+static void RXFIFO_incrementHead(IPC_Handle_t *const hipc, uint16_t inc_size);
+static void RXFIFO_writeData(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size);
+static void RXFIFO_readData(IPC_Handle_t *const hipc, uint8_t *p_data, uint16_t size);
+static void RXFIFO_completeMsg(IPC_Handle_t *const hipc);
 static void RXFIFO_updateMsgHeader(IPC_Handle_t *const hipc);
 static void RXFIFO_prepareNextMsgHeader(IPC_Handle_t *const hipc);
 static void RXFIFO_rearm_RX_IT(IPC_Handle_t *const hipc);
@@ -85,6 +96,7 @@ void IPC_RXFIFO_init(IPC_Handle_t *const hipc)
   hipc->RxQueue.current_msg_index = 0U;
   hipc->RxQueue.current_msg_size = 0U;
   hipc->RxQueue.nb_unread_msg = 0U;
+  hipc->RxQueue.dropped_count = 0U;
 
 #if (DBG_IPC_RX_FIFO == 1U)
   /* init debug infos */
@@ -118,7 +130,7 @@ void IPC_RXFIFO_writeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar)
     hipc->dbgRxQueue.msg_info_queue[hipc->dbgRxQueue.queue_pos].size = hipc->RxQueue.current_msg_size;
 #endif /* DBG_IPC_RX_FIFO == 1U */
 
-    RXFIFO_incrementHead(hipc);
+    RXFIFO_incrementHead(hipc, 1U);
 
     if (hipc->State != IPC_STATE_PAUSED)
     {
@@ -129,22 +141,69 @@ void IPC_RXFIFO_writeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar)
     /* check if the char received is an end of message */
     if ((*hipc->CheckEndOfMsgCallback)(rxChar) == 1U)
     {
-      hipc->RxQueue.nb_unread_msg++;
+      RXFIFO_completeMsg(hipc);
+    }
+  }
+}
 
-      /* update header for message received */
-      RXFIFO_updateMsgHeader(hipc);
+/**
+  * @brief  Write a span of received characters in the IPC RX FIFO.
+  * @note   This function is called by UART callback when a reception event occurs (IPC_RX_MODE_DMA).
+  * @note   It is used in IPC normal mode (signalling/socket).
+  *         The span is split on message boundaries and each part is copied in one block.
+  * @param  hipc IPC handle.
+  * @param  p_span Ptr to the received characters.
+  * @param  span_size Number of received characters.
+  * @retval none.
+  */
+void IPC_RXFIFO_writeCharacterSpan(IPC_Handle_t *const hipc, const uint8_t *p_span, uint16_t span_size)
+{
+  if ((hipc != NULL) && (p_span != NULL))
+  {
+    uint16_t msg_start = 0U;
 
-      /* save start position of next message */
-      hipc->RxQueue.current_msg_index = hipc->RxQueue.index_write;
+    if (hipc->CheckEndOfMsgSpanCallback != NULL)
+    {
+      /* search the ends of message on the whole span */
+      uint16_t msg_size = 1U;
+      while ((msg_start < span_size) && (msg_size != 0U))
+      {
+        msg_size = (*hipc->CheckEndOfMsgSpanCallback)(&p_span[msg_start], (span_size - msg_start));
+        if (msg_size != 0U)
+        {
+          RXFIFO_writeData(hipc, &p_span[msg_start], msg_size);
+          msg_start += msg_size;
+          RXFIFO_completeMsg(hipc);
+        }
+      }
+    }
+    else
+    {
+      for (uint16_t idx = 0U; idx < span_size; idx++)
+      {
+        /* check if the char received is an end of message */
+        if ((*hipc->CheckEndOfMsgCallback)(p_span[idx]) == 1U)
+        {
+          RXFIFO_writeData(hipc, &p_span[msg_start], (idx + 1U - msg_start));
+          msg_start = idx + 1U;
+          RXFIFO_completeMsg(hipc);
+        }
+      }
+    }
 
-      /* reset current msg size */
-      hipc->RxQueue.current_msg_size = 0U;
+    /* end of the span belongs to a message not yet complete */
+    if (msg_start < span_size)
+    {
+      RXFIFO_writeData(hipc, &p_span[msg_start], (span_size - msg_start));
+    }
 
-      /* reserve place for next msg header */
-      RXFIFO_prepareNextMsgHeader(hipc);
+    if ((hipc->State != IPC_STATE_PAUSED) && (IPC_RXFIFO_getFreeBytes(hipc) <= RXFIFO_SPAN_THRESHOLD))
+    {
+      hipc->State = IPC_STATE_PAUSED;
 
-      /* msg received: call client callback */
-      (* hipc->RxClientCallback)((IPC_Handle_t *)hipc);
+#if (DBG_IPC_RX_FIFO == 1U)
+      hipc->dbgRxQueue.cpt_RXPause++;
+#endif /* DBG_IPC_RX_FIFO == 1U */
     }
   }
 }
@@ -156,9 +215,26 @@ void IPC_RXFIFO_writeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar)
   * @retval message size (-1 if an error occurred).
   */
 int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
+{
+  uint16_t data_size = 0U;
+
+  return (IPC_RXFIFO_readData(hipc, NULL, &data_size, pMsg));
+}
+
+/**
+  * @brief  Read first unread message in the IPC RX FIFO, the beginning of the message being
+  *         copied directly to a user data buffer.
+  * @param  hipc IPC handle.
+  * @param  p_data ptr to the user data buffer (can be NULL if p_data_size is 0).
+  * @param  p_data_size ptr to the size of the user data buffer.
+  *         Updated with the number of bytes copied to the user data buffer.
+  * @param  pMsg ptr to the message read from IPC RX FIFO (receives the rest of the message).
+  * @retval number of unread messages (-1 if an error occurred).
+  */
+int16_t IPC_RXFIFO_readData(IPC_Handle_t *const hipc, uint8_t *p_data, uint16_t *p_data_size,
+                            IPC_RxMessage_t *pMsg)
 {
   int16_t retval;
-  uint16_t oversize;
   IPC_RxHeader_t header;
 
   if (hipc != NULL)
@@ -173,6 +249,7 @@ int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
     if (header.complete != 1U)
     {
       /* error: trying to read an incomplete message */
+      *p_data_size = 0U;
       retval = -1;
     }
     else
@@ -186,36 +263,19 @@ int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
       PRINT_DBG(" *** free bytes before read=%d ", hipc->dbgRxQueue.free_bytes)
 #endif /* DBG_IPC_RX_FIFO == 1U */
 
-      /* update size in output structure */
-      pMsg->size = header.size;
-
-      /* copy msg content to output structure */
-      if ((hipc->RxQueue.index_read + header.size) > IPC_RXBUF_MAXSIZE)
+      /* copy beginning of msg content to user data buffer */
+      if (*p_data_size > header.size)
       {
-        /* message is split in 2 parts in the circular buffer */
-        oversize = (hipc->RxQueue.index_read + header.size - IPC_RXBUF_MAXSIZE);
-        uint16_t remaining_size = header.size - oversize;
-        (void) memcpy((void *) & (pMsg->buffer[0]),
-                      (void *) & (hipc->RxQueue.data[hipc->RxQueue.index_read]),
-                      (size_t) remaining_size);
-        (void) memcpy((void *) & (pMsg->buffer[header.size - oversize]),
-                      (void *) & (hipc->RxQueue.data[0]),
-                      (size_t) oversize);
-
-#if (DBG_IPC_RX_FIFO == 1U)
-        PRINT_DBG("override end of buffer")
-#endif /* DBG_IPC_RX_FIFO == 1U */
+        *p_data_size = header.size;
       }
-      else
+      if (*p_data_size != 0U)
       {
-        /* message is contiguous in the circular buffer */
-        (void) memcpy((void *)pMsg->buffer,
-                      (void *) & (hipc->RxQueue.data[hipc->RxQueue.index_read]),
-                      (size_t) header.size);
+        RXFIFO_readData(hipc, p_data, *p_data_size);
       }
 
-      /* increment tail index to the next message */
-      RXFIFO_incrementTail(hipc, header.size);
+      /* update size in output structure and copy rest of msg content to it */
+      pMsg->size = header.size - *p_data_size;
+      RXFIFO_readData(hipc, pMsg->buffer, pMsg->size);
 
 #if (DBG_IPC_RX_FIFO == 1U)
       /* update free_bytes infos */
@@ -252,15 +312,40 @@ void IPC_RXFIFO_stream_init(IPC_Handle_t *const hipc)
     (void) memset((void *)hipc->RxBuffer.data, 0,  sizeof(uint8_t) * IPC_RXBUF_STREAM_MAXSIZE);
     hipc->RxBuffer.index_read = 0U;
     hipc->RxBuffer.index_write = 0U;
-    hipc->RxBuffer.available_char = 0U;
     hipc->RxBuffer.total_rcv_count = 0U;
+    hipc->RxBuffer.dropped_count = 0U;
   }
 }
 
+/**
+  * @brief  Get number of characters available in the IPC RX FIFO in stream mode.
+  * @note   Indexes are read once each: result is consistent when called by the reader or under IT.
+  * @param  hipc IPC handle.
+  * @retval Number of characters available.
+  */
+uint16_t IPC_RXFIFO_streamAvailable(const IPC_Handle_t *const hipc)
+{
+  uint16_t index_read = hipc->RxBuffer.index_read;
+  uint16_t index_write = hipc->RxBuffer.index_write;
+  uint16_t available;
+
+  if (index_write >= index_read)
+  {
+    available = index_write - index_read;
+  }
+  else
+  {
+    available = IPC_RXBUF_STREAM_MAXSIZE - index_read + index_write;
+  }
+
+  return (available);
+}
+
 /**
   * @brief  Write a char in the IPC RX FIFO in stream mode.
   * @note   This function is called by UART callback when a character is received on UART.
   * @note   It is used in IPC stream IPC mode (LwIP).
+  *         Client callback is only called when the FIFO was empty: the reader reads until the FIFO is empty.
   * @param  hipc IPC handle.
   * @param  rxChar character to write.
   * @retval none.
@@ -269,21 +354,92 @@ void IPC_RXFIFO_writeStream(IPC_Handle_t *const hipc, uint8_t rxChar)
 {
   if (hipc != NULL)
   {
-    hipc->RxBuffer.data[hipc->RxBuffer.index_write] = rxChar;
+    uint16_t index_write = hipc->RxBuffer.index_write;
+    uint16_t next_index_write = ((index_write + 1U) >= IPC_RXBUF_STREAM_MAXSIZE) ? 0U : (index_write + 1U);
+    uint16_t index_read = hipc->RxBuffer.index_read;
+    bool is_full = (next_index_write == index_read);
+
+    if (!is_full)
+    {
+      hipc->RxBuffer.data[index_write] = rxChar;
+    }
 
     /* rearm RX Interrupt */
     RXFIFO_rearm_RX_IT(hipc);
 
-    hipc->RxBuffer.index_write++;
-    hipc->RxBuffer.total_rcv_count++;
+    if (!is_full)
+    {
+      /* character must be in the buffer before it is published to the reader */
+      __DMB();
+      hipc->RxBuffer.index_write = next_index_write;
+      hipc->RxBuffer.total_rcv_count++;
 
-    if (hipc->RxBuffer.index_write >= IPC_RXBUF_STREAM_MAXSIZE)
+      if (index_write == index_read)
+      {
+        (* hipc->RxClientCallback)((void *)hipc);
+      }
+    }
+    else
     {
-      hipc->RxBuffer.index_write = 0;
+      /* FIFO full: character lost */
+      hipc->RxBuffer.dropped_count++;
     }
-    hipc->RxBuffer.available_char++;
+  }
+}
 
-    (* hipc->RxClientCallback)((void *)hipc);
+/**
+  * @brief  Write a span of received characters in the IPC RX FIFO in stream mode.
+  * @note   This function is called by UART callback when a reception event occurs (IPC_RX_MODE_DMA).
+  * @note   It is used in IPC stream IPC mode (LwIP).
+  *         Client callback is called once for the whole span, only when the FIFO was empty.
+  * @param  hipc IPC handle.
+  * @param  p_span Ptr to the received characters.
+  * @param  span_size Number of received characters.
+  * @retval none.
+  */
+void IPC_RXFIFO_writeStreamSpan(IPC_Handle_t *const hipc, const uint8_t *p_span, uint16_t span_size)
+{
+  if ((hipc != NULL) && (p_span != NULL) && (span_size != 0U))
+  {
+    uint16_t available = IPC_RXFIFO_streamAvailable(hipc);
+    uint16_t free_size = IPC_RXBUF_STREAM_MAXSIZE - 1U - available;
+    uint16_t write_size = (span_size > free_size) ? free_size : span_size;
+    uint16_t index_write = hipc->RxBuffer.index_write;
+    uint16_t first_part = IPC_RXBUF_STREAM_MAXSIZE - index_write;
+
+    if (write_size > first_part)
+    {
+      /* span is split in 2 parts in the circular buffer */
+      (void) memcpy((void *) &hipc->RxBuffer.data[index_write], (const void *)p_span, (size_t) first_part);
+      (void) memcpy((void *) &hipc->RxBuffer.data[0], (const void *) &p_span[first_part],
+                    (size_t)(write_size - first_part));
+      index_write = write_size - first_part;
+    }
+    else
+    {
+      (void) memcpy((void *) &hipc->RxBuffer.data[index_write], (const void *)p_span, (size_t) write_size);
+      index_write += write_size;
+      if (index_write >= IPC_RXBUF_STREAM_MAXSIZE)
+      {
+        index_write = 0U;
+      }
+    }
+
+    /* FIFO full: end of the span lost */
+    hipc->RxBuffer.dropped_count += (span_size - write_size);
+
+    if (write_size != 0U)
+    {
+      /* characters must be in the buffer before they are published to the reader */
+      __DMB();
+      hipc->RxBuffer.index_write = index_write;
+      hipc->RxBuffer.total_rcv_count += write_size;
+
+      if (available == 0U)
+      {
+        (* hipc->RxClientCallback)((void *)hipc);
+      }
+    }
   }
 }
 #endif /* IPC_USE_STREAM_MODE == 1U */
@@ -447,15 +603,16 @@ static void RXFIFO_incrementTail(IPC_Handle_t *const hipc, uint16_t inc_size)
 }
 
 /**
-  * @brief  Increment IPC RX FIFO Head for next message Header.
+  * @brief  Increment IPC RX FIFO Head.
   * @param  hipc IPC handle.
+  * @param  inc_size Size to increment.
   * @retval none.
   */
-static void RXFIFO_incrementHead(IPC_Handle_t *const hipc)
+static void RXFIFO_incrementHead(IPC_Handle_t *const hipc, uint16_t inc_size)
 {
   uint16_t free_bytes;
 
-  hipc->RxQueue.index_write = (hipc->RxQueue.index_write + 1U) % IPC_RXBUF_MAXSIZE;
+  hipc->RxQueue.index_write = (hipc->RxQueue.index_write + inc_size) % IPC_RXBUF_MAXSIZE;
   free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
 
 #if (DBG_IPC_RX_FIFO == 1U)
@@ -472,6 +629,114 @@ static void RXFIFO_incrementHead(IPC_Handle_t *const hipc)
   }
 }
 
+/**
+  * @brief  Copy data of current message in the IPC RX FIFO.
+  * @note   Characters which do not fit in the FIFO are dropped and counted (RxQueue.dropped_count).
+  * @param  hipc IPC handle.
+  * @param  p_data Ptr to the data to copy.
+  * @param  size Size of the data to copy.
+  * @retval none.
+  */
+static void RXFIFO_writeData(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size)
+{
+  uint16_t first_part = IPC_RXBUF_MAXSIZE - hipc->RxQueue.index_write;
+  uint16_t free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
+  uint16_t write_size = size;
+
+  /* keep room for the header of the next message, the write index must not reach the read index */
+  free_bytes = (free_bytes > IPC_RXMSG_HEADER_SIZE) ? (free_bytes - IPC_RXMSG_HEADER_SIZE - 1U) : 0U;
+  if (write_size > free_bytes)
+  {
+    /* FIFO full: end of the data lost */
+    hipc->RxQueue.dropped_count += (size - free_bytes);
+    write_size = free_bytes;
+  }
+
+  if (write_size > first_part)
+  {
+    /* data are split in 2 parts in the circular buffer */
+    (void) memcpy((void *) &hipc->RxQueue.data[hipc->RxQueue.index_write], (const void *)p_data,
+                  (size_t) first_part);
+    (void) memcpy((void *) &hipc->RxQueue.data[0], (const void *) &p_data[first_part],
+                  (size_t)(write_size - first_part));
+  }
+  else
+  {
+    (void) memcpy((void *) &hipc->RxQueue.data[hipc->RxQueue.index_write], (const void *)p_data,
+                  (size_t) write_size);
+  }
+
+  hipc->RxQueue.current_msg_size += write_size;
+
+#if (DBG_IPC_RX_FIFO == 1U)
+  hipc->dbgRxQueue.msg_info_queue[hipc->dbgRxQueue.queue_pos].size = hipc->RxQueue.current_msg_size;
+#endif /* DBG_IPC_RX_FIFO == 1U */
+
+  RXFIFO_incrementHead(hipc, write_size);
+}
+
+/**
+  * @brief  Read data from IPC RX FIFO Tail (handle the wrap of the circular buffer).
+  * @param  hipc IPC handle.
+  * @param  p_data ptr to the destination buffer.
+  * @param  size Size of data to read.
+  * @retval none.
+  */
+static void RXFIFO_readData(IPC_Handle_t *const hipc, uint8_t *p_data, uint16_t size)
+{
+  if ((hipc->RxQueue.index_read + size) > IPC_RXBUF_MAXSIZE)
+  {
+    /* data are split in 2 parts in the circular buffer */
+    uint16_t oversize = (hipc->RxQueue.index_read + size - IPC_RXBUF_MAXSIZE);
+    uint16_t remaining_size = size - oversize;
+    (void) memcpy((void *) &p_data[0],
+                  (void *) & (hipc->RxQueue.data[hipc->RxQueue.index_read]),
+                  (size_t) remaining_size);
+    (void) memcpy((void *) &p_data[remaining_size],
+                  (void *) & (hipc->RxQueue.data[0]),
+                  (size_t) oversize);
+
+#if (DBG_IPC_RX_FIFO == 1U)
+    PRINT_DBG("override end of buffer")
+#endif /* DBG_IPC_RX_FIFO == 1U */
+  }
+  else
+  {
+    /* data are contiguous in the circular buffer */
+    (void) memcpy((void *)p_data,
+                  (void *) & (hipc->RxQueue.data[hipc->RxQueue.index_read]),
+                  (size_t) size);
+  }
+
+  /* increment tail index */
+  RXFIFO_incrementTail(hipc, size);
+}
+
+/**
+  * @brief  Close current message and notify the client.
+  * @param  hipc IPC handle.
+  * @retval none.
+  */
+static void RXFIFO_completeMsg(IPC_Handle_t *const hipc)
+{
+  hipc->RxQueue.nb_unread_msg++;
+
+  /* update header for message received */
+  RXFIFO_updateMsgHeader(hipc);
+
+  /* save start position of next message */
+  hipc->RxQueue.current_msg_index = hipc->RxQueue.index_write;
+
+  /* reset current msg size */
+  hipc->RxQueue.current_msg_size = 0U;
+
+  /* reserve place for next msg header */
+  RXFIFO_prepareNextMsgHeader(hipc);
+
+  /* msg received: call client callback */
+  (* hipc->RxClientCallback)((IPC_Handle_t *)hipc);
+}
+
 /**
   * @brief  Update current message Header.
   * @param  hipc IPC handle.
@@ -515,7 +780,7 @@ static void RXFIFO_prepareNextMsgHeader(IPC_Handle_t *const hipc)
   {
     /* clean data and increment head */
     hipc->RxQueue.data[hipc->RxQueue.index_write] = 0U;
-    RXFIFO_incrementHead(hipc);
+    RXFIFO_incrementHead(hipc, 1U);
   }
 }
 
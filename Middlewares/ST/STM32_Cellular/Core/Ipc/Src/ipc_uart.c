@@ -65,6 +65,9 @@ static uint8_t find_Device_Id(const UART_HandleTypeDef *huart);
 static IPC_Status_t change_ipc_channel(IPC_Handle_t *const hipc);
 static void set_rearm_error(void);
 static void check_UART_rearm_RX_IT(IPC_Handle_t *const hipc);
+static uint8_t get_RX_mode(IPC_Device_t device);
+static HAL_StatusTypeDef start_UART_RX(uint8_t device_id);
+static HAL_StatusTypeDef resume_UART_RX(uint8_t device_id);
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -100,6 +103,7 @@ IPC_Status_t IPC_UART_init(IPC_Device_t device, UART_HandleTypeDef *const huart)
     IPC_DevicesList[device].phy_int.h_uart = huart;
     IPC_DevicesList[device].h_current_channel = NULL;
     IPC_DevicesList[device].h_inactive_channel = NULL;
+    IPC_DevicesList[device].rx_mode = get_RX_mode(device);
     retval = IPC_OK;
   }
 
@@ -120,6 +124,7 @@ IPC_Status_t IPC_UART_deinit(IPC_Device_t device)
   IPC_DevicesList[device].phy_int.h_uart = NULL;
   IPC_DevicesList[device].h_current_channel = NULL;
   IPC_DevicesList[device].h_inactive_channel = NULL;
+  IPC_DevicesList[device].rx_mode = IPC_RX_MODE_IT;
 
   return (IPC_OK);
 }
@@ -191,11 +196,13 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
     if (mode == IPC_MODE_UART_CHARACTER)
     {
       hipc->RxFifoWrite = IPC_RXFIFO_writeCharacter;
+      hipc->RxFifoWriteSpan = IPC_RXFIFO_writeCharacterSpan;
     }
 #if (IPC_USE_STREAM_MODE == 1U)
     else
     {
       hipc->RxFifoWrite = IPC_RXFIFO_writeStream;
+      hipc->RxFifoWriteSpan = IPC_RXFIFO_writeStreamSpan;
     }
 #endif /* IPC_USE_STREAM_MODE == 1U */
 
@@ -210,6 +217,7 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
     hipc->TxClientCallback = pTxClientCallback;
     hipc->ErrorCallback = pErrorClientCallback;
     hipc->CheckEndOfMsgCallback = pCheckEndOfMsg;
+    hipc->CheckEndOfMsgSpanCallback = NULL;
     hipc->Mode = mode;
 
     /* init RXFIFO */
@@ -218,11 +226,11 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
     IPC_RXFIFO_stream_init(hipc);
 #endif /* IPC_USE_STREAM_MODE == 1U */
 
-    /* start RX IT */
-    uart_status = HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[device].RxChar, 1U);
+    /* start RX (IT or DMA) */
+    uart_status = start_UART_RX(device);
     if (uart_status != HAL_OK)
     {
-      PRINT_DBG("HAL_UART_Receive_IT error")
+      PRINT_DBG("start UART RX error")
       retval = IPC_ERROR;
     }
     else
@@ -252,6 +260,7 @@ IPC_Status_t IPC_UART_close(IPC_Handle_t *const hipc)
     hipc->State = IPC_STATE_NOT_INITIALIZED;
     hipc->RxClientCallback = NULL;
     hipc->CheckEndOfMsgCallback = NULL;
+    hipc->CheckEndOfMsgSpanCallback = NULL;
 
     /* init RXFIFO */
     IPC_RXFIFO_init(hipc);
@@ -288,6 +297,13 @@ IPC_Status_t IPC_UART_close(IPC_Handle_t *const hipc)
         if (hipc->Interface.h_uart != NULL)
         {
           (void)HAL_UART_AbortTransmit_IT(hipc->Interface.h_uart);
+#if (IPC_USE_RX_DMA == 1U)
+          if (IPC_DevicesList[device_id].rx_mode == IPC_RX_MODE_DMA)
+          {
+            /* circular DMA would keep on writing in the RX DMA buffer */
+            (void)HAL_UART_AbortReceive(hipc->Interface.h_uart);
+          }
+#endif /* IPC_USE_RX_DMA == 1U */
         }
       }
 
@@ -334,9 +350,17 @@ IPC_Status_t IPC_UART_reset(IPC_Handle_t *const hipc)
     IPC_RXFIFO_stream_init(hipc);
 #endif /* IPC_USE_STREAM_MODE == 1U */
 
-    /* rearm IT */
+#if (IPC_USE_RX_DMA == 1U)
+    if (IPC_DevicesList[device_id].rx_mode == IPC_RX_MODE_DMA)
+    {
+      /* restart DMA reception from the beginning of the RX DMA buffer */
+      (void)HAL_UART_AbortReceive(hipc->Interface.h_uart);
+    }
+#endif /* IPC_USE_RX_DMA == 1U */
+
+    /* rearm IT (or restart DMA) */
     HAL_StatusTypeDef uart_status;
-    uart_status = HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[device_id].RxChar, 1U);
+    uart_status = start_UART_RX(device_id);
     if (uart_status != HAL_OK)
     {
       set_rearm_error();
@@ -445,6 +469,24 @@ IPC_Status_t IPC_UART_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16
   * @retval status
   */
 IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
+{
+  uint16_t data_size = 0U;
+
+  return (IPC_UART_receiveData(hipc, NULL, &data_size, p_msg));
+}
+
+/**
+  * @brief  Receive a message from an UART channel, the beginning of the message being
+  *         copied directly to a user data buffer (no intermediate copy in p_msg).
+  * @param  hipc IPC handle.
+  * @param  p_data Pointer to the user data buffer (can be NULL if p_data_size is 0).
+  * @param  p_data_size Pointer to the size of the user data buffer.
+  *         Updated with the number of bytes copied to the user data buffer.
+  * @param  p_msg Pointer to the IPC message structure to fill with the rest of the received message.
+  * @retval status
+  */
+IPC_Status_t IPC_UART_receiveData(IPC_Handle_t *const hipc, uint8_t *const p_data, uint16_t *const p_data_size,
+                                  IPC_RxMessage_t *const p_msg)
 {
   IPC_Status_t retval;
   int16_t unread_msg_size;
@@ -455,9 +497,9 @@ IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p
   /* check the handle */
   if (hipc->Mode == IPC_MODE_UART_CHARACTER)
   {
-    if (p_msg == NULL)
+    if ((p_msg == NULL) || ((p_data == NULL) && (*p_data_size != 0U)))
     {
-      PRINT_ERR("IPC_receive err - p_msg NULL")
+      PRINT_ERR("IPC_receive err - p_msg or p_data NULL")
       retval = IPC_ERROR;
     }
     else
@@ -468,7 +510,7 @@ IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p
 #endif /* DBG_IPC_RX_FIFO == 1U */
 
       /* read the first unread message */
-      unread_msg_size = IPC_RXFIFO_read(hipc, p_msg);
+      unread_msg_size = IPC_RXFIFO_readData(hipc, p_data, p_data_size, p_msg);
       if (unread_msg_size == -1)
       {
         PRINT_DBG("IPC_receive err - no unread msg")
@@ -490,8 +532,7 @@ IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p
 
           hipc->State = IPC_STATE_ACTIVE;
           HAL_StatusTypeDef uart_status;
-          uart_status = HAL_UART_Receive_IT(hipc->Interface.h_uart,
-                                            (uint8_t *)IPC_DevicesList[hipc->Device_ID].RxChar, 1U);
+          uart_status = resume_UART_RX(hipc->Device_ID);
           if (uart_status != HAL_OK)
           {
             set_rearm_error();
@@ -539,20 +580,38 @@ IPC_Status_t IPC_UART_streamReceive(IPC_Handle_t *const hipc,  uint8_t *const p_
 
     if (hipc->Mode == IPC_MODE_UART_STREAM)
     {
-      /* receive */
-      while ((hipc->RxBuffer.available_char != 0U) &&
-             (rx_size < maximum_buffer_size))
+      /* receive: index_write may move under IT meanwhile, only index_read is updated here */
+      uint16_t index_read = hipc->RxBuffer.index_read;
+      uint16_t first_part = IPC_RXBUF_STREAM_MAXSIZE - index_read;
+
+      rx_size = IPC_RXFIFO_streamAvailable(hipc);
+      if (rx_size > maximum_buffer_size)
+      {
+        rx_size = maximum_buffer_size;
+      }
+
+      if (rx_size > first_part)
+      {
+        /* data split in 2 parts in the circular buffer */
+        (void) memcpy((void *)p_buffer, (const void *)&hipc->RxBuffer.data[index_read], (size_t)first_part);
+        (void) memcpy((void *)&p_buffer[first_part], (const void *)&hipc->RxBuffer.data[0],
+                      (size_t)(rx_size - first_part));
+        index_read = rx_size - first_part;
+      }
+      else
       {
-        p_buffer[rx_size] = hipc->RxBuffer.data[hipc->RxBuffer.index_read];
-        hipc->RxBuffer.index_read++;
-        if (hipc->RxBuffer.index_read >= IPC_RXBUF_STREAM_MAXSIZE)
+        (void) memcpy((void *)p_buffer, (const void *)&hipc->RxBuffer.data[index_read], (size_t)rx_size);
+        index_read += rx_size;
+        if (index_read >= IPC_RXBUF_STREAM_MAXSIZE)
         {
-          hipc->RxBuffer.index_read = 0;
+          index_read = 0U;
         }
-        rx_size++;
-        hipc->RxBuffer.available_char--;
       }
 
+      /* characters must be copied before their room is given back to the writer */
+      __DMB();
+      hipc->RxBuffer.index_read = index_read;
+
       /* update buffer size */
       *p_len = (int16_t) rx_size;
       retval = IPC_OK;
@@ -571,6 +630,73 @@ IPC_Status_t IPC_UART_streamReceive(IPC_Handle_t *const hipc,  uint8_t *const p_
 
   return (retval);
 }
+
+/**
+  * @brief  Get the characters available in the stream mode buffer of an UART channel without copying them.
+  * @param  hipc IPC handle.
+  * @param  pp_span Pointer updated with the address of the first available character in the stream buffer.
+  * @param  p_span_size Pointer updated with the number of contiguous characters available at this address.
+  * @note   The characters stay in the stream buffer until IPC_UART_streamReleaseSpan() is called:
+  *         the span is not overwritten by new received characters meanwhile.
+  *         When the available characters wrap at the end of the buffer, only the first part is returned.
+  * @retval status
+  */
+IPC_Status_t IPC_UART_streamGetSpan(IPC_Handle_t *const hipc, uint8_t **const pp_span, uint16_t *const p_span_size)
+{
+  IPC_Status_t retval;
+
+  if (hipc->Mode == IPC_MODE_UART_STREAM)
+  {
+    /* index_write may move under IT meanwhile: the span may only be shorter than available characters */
+    uint16_t index_read = hipc->RxBuffer.index_read;
+    uint16_t rx_size = IPC_RXFIFO_streamAvailable(hipc);
+    uint16_t first_part = IPC_RXBUF_STREAM_MAXSIZE - index_read;
+
+    *pp_span = &hipc->RxBuffer.data[index_read];
+    *p_span_size = (rx_size > first_part) ? first_part : rx_size;
+    retval = IPC_OK;
+  }
+  else
+  {
+    PRINT_ERR("IPC_receive err - IPC mode not matching")
+    *p_span_size = 0U;
+    retval = IPC_ERROR;
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Give back to an UART channel the room of characters obtained with IPC_UART_streamGetSpan().
+  * @param  hipc IPC handle.
+  * @param  span_size Number of characters consumed, must not exceed the span size.
+  * @retval status
+  */
+IPC_Status_t IPC_UART_streamReleaseSpan(IPC_Handle_t *const hipc, uint16_t span_size)
+{
+  IPC_Status_t retval;
+
+  if ((hipc->Mode == IPC_MODE_UART_STREAM) && (span_size <= IPC_RXFIFO_streamAvailable(hipc)))
+  {
+    uint16_t index_read = hipc->RxBuffer.index_read + span_size;
+    if (index_read >= IPC_RXBUF_STREAM_MAXSIZE)
+    {
+      index_read -= IPC_RXBUF_STREAM_MAXSIZE;
+    }
+
+    /* characters must be consumed before their room is given back to the writer */
+    __DMB();
+    hipc->RxBuffer.index_read = index_read;
+    retval = IPC_OK;
+  }
+  else
+  {
+    PRINT_ERR("IPC_receive err - invalid span release")
+    retval = IPC_ERROR;
+  }
+
+  return (retval);
+}
 #endif  /* IPC_USE_STREAM_MODE */
 
 /**
@@ -583,8 +709,9 @@ void IPC_UART_rearm_RX_IT(IPC_Handle_t *const hipc)
   if (hipc != NULL)
   {
     /* Comment: specific to UART, should be in ipc_uart.c */
-    /* rearm uart TX interrupt */
-    if (hipc->Interface.interface_type == IPC_INTERFACE_UART)
+    /* rearm uart TX interrupt (not needed in DMA mode: reception is continuous) */
+    if ((hipc->Interface.interface_type == IPC_INTERFACE_UART)
+        && (IPC_DevicesList[hipc->Device_ID].rx_mode == IPC_RX_MODE_IT))
     {
       HAL_StatusTypeDef uart_status;
       uart_status = HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[hipc->Device_ID].RxChar, 1U);
@@ -681,6 +808,66 @@ void IPC_UART_RxCpltCallback(UART_HandleTypeDef *UartHandle)
   }
 }
 
+#if (IPC_USE_RX_DMA == 1U)
+/**
+  * @brief  IPC uart RX event callback (called under IT !).
+  * @note   Called on DMA half transfer, DMA transfer complete and UART idle-line events (IPC_RX_MODE_DMA).
+  * @param  UartHandle Ptr to the HAL UART handle.
+  * @param  Pos Position in the RX DMA buffer of the last received character + 1.
+  * @retval none
+  */
+void IPC_UART_RxEventCallback(UART_HandleTypeDef *UartHandle, uint16_t Pos)
+{
+  /* Warning ! this function is called under IT */
+  uint8_t device_id = find_Device_Id(UartHandle);
+  if (device_id < IPC_MAX_DEVICES)
+  {
+    IPC_ClientDescription_t *p_device = &IPC_DevicesList[device_id];
+    IPC_Handle_t *hipc = p_device->h_current_channel;
+    uint16_t read_pos = p_device->RxDmaReadPos;
+
+    if ((hipc != NULL) && (Pos <= IPC_RXDMA_BUFFER_SIZE))
+    {
+      if (Pos > read_pos)
+      {
+        /* hand the new span to the RX FIFO */
+        hipc->RxFifoWriteSpan(hipc, (const uint8_t *)&p_device->RxDmaBuf[read_pos], (Pos - read_pos));
+      }
+      else if (Pos < read_pos)
+      {
+        /* DMA pointer wrapped: end of the DMA buffer then its beginning */
+        hipc->RxFifoWriteSpan(hipc, (const uint8_t *)&p_device->RxDmaBuf[read_pos],
+                              (IPC_RXDMA_BUFFER_SIZE - read_pos));
+        hipc->RxFifoWriteSpan(hipc, (const uint8_t *)&p_device->RxDmaBuf[0], Pos);
+      }
+      else
+      {
+        /* no new data */
+      }
+      p_device->RxDmaReadPos = (Pos == IPC_RXDMA_BUFFER_SIZE) ? 0U : Pos;
+
+      if (hipc->State == IPC_STATE_PAUSED)
+      {
+        /* stop DMA requests: UART flow control holds the modem until the RX FIFO has been read */
+        (void)HAL_UART_DMAPause(UartHandle);
+      }
+      else if (UartHandle->RxState == HAL_UART_STATE_READY)
+      {
+        /* DMA not configured in circular mode: reception ends on each event, restart it */
+        if (start_UART_RX(device_id) != HAL_OK)
+        {
+          set_rearm_error();
+        }
+      }
+      else
+      {
+        /* circular reception still on-going */
+      }
+    }
+  }
+}
+#endif /* IPC_USE_RX_DMA == 1U */
+
 /**
   * @brief  IPC uart TX callback (called under IT !).
   * @param  UartHandle Ptr to the HAL UART handle.
@@ -729,6 +916,17 @@ void IPC_UART_ErrorCallback(UART_HandleTypeDef *UartHandle)
           IPC_DevicesList[device_id].h_current_channel
         );
       }
+
+#if (IPC_USE_RX_DMA == 1U)
+      if ((IPC_DevicesList[device_id].rx_mode == IPC_RX_MODE_DMA) && (UartHandle->RxState == HAL_UART_STATE_READY))
+      {
+        /* blocking error (overrun,...): HAL has aborted DMA reception, restart it */
+        if (start_UART_RX(device_id) != HAL_OK)
+        {
+          set_rearm_error();
+        }
+      }
+#endif /* IPC_USE_RX_DMA == 1U */
     }
   }
 }
@@ -804,19 +1002,113 @@ static void check_UART_rearm_RX_IT(IPC_Handle_t *const hipc)
       if (error_during_rearm_RX_IT == 1U)
       {
         HAL_StatusTypeDef uart_status;
-        uart_status = HAL_UART_Receive_IT(hipc->Interface.h_uart,
-                                          (uint8_t *)IPC_DevicesList[hipc->Device_ID].RxChar, 1U);
+        uart_status = start_UART_RX(hipc->Device_ID);
         if (uart_status == HAL_OK)
         {
           /* clear the error if the IT was successfully rearmed */
           error_during_rearm_RX_IT = 0U;
         }
+      }
 
 #if (USE_REARM_MUTEX == 1)
-        (void)rtosalMutexRelease(IPC_RearmMutexHandle);
+      (void)rtosalMutexRelease(IPC_RearmMutexHandle);
 #endif /* USE_REARM_MUTEX == 1 */
-      }
     }
   }
 }
 
+/**
+  * brief  Get the RX mode configured for an IPC device.
+  * param  device IPC device identifier.
+  * retval IPC_RX_MODE_IT or IPC_RX_MODE_DMA.
+  */
+static uint8_t get_RX_mode(IPC_Device_t device)
+{
+  uint8_t rx_mode;
+
+  if (device == IPC_DEVICE_0)
+  {
+    rx_mode = (uint8_t)IPC_RX_MODE_DEVICE_0;
+  }
+  else if (device == IPC_DEVICE_1)
+  {
+    rx_mode = (uint8_t)IPC_RX_MODE_DEVICE_1;
+  }
+  else
+  {
+    rx_mode = (uint8_t)IPC_RX_MODE_DEVICE_2;
+  }
+
+  return (rx_mode);
+}
+
+/**
+  * brief  Start UART reception of an IPC device.
+  * note   IPC_RX_MODE_IT: one character reception under IT.
+  *        IPC_RX_MODE_DMA: DMA reception until idle-line, into the RX DMA buffer
+  *        (DMA channel has to be configured in circular mode by the board setup, HAL_ERROR when no
+  *        DMA channel is linked to the UART).
+  * param  device_id IPC device identifier.
+  * retval HAL status
+  */
+static HAL_StatusTypeDef start_UART_RX(uint8_t device_id)
+{
+  HAL_StatusTypeDef uart_status;
+
+#if (IPC_USE_RX_DMA == 1U)
+  if (IPC_DevicesList[device_id].rx_mode == IPC_RX_MODE_DMA)
+  {
+    if (IPC_DevicesList[device_id].phy_int.h_uart->hdmarx == NULL)
+    {
+      /* board setup has not linked a RX DMA channel to the UART (__HAL_LINKDMA in the UART MSP) */
+      PRINT_ERR("IPC_open err - RX DMA channel not linked to the UART")
+      uart_status = HAL_ERROR;
+    }
+    else
+    {
+      IPC_DevicesList[device_id].RxDmaReadPos = 0U;
+      uart_status = HAL_UARTEx_ReceiveToIdle_DMA(IPC_DevicesList[device_id].phy_int.h_uart,
+                                                 (uint8_t *)IPC_DevicesList[device_id].RxDmaBuf,
+                                                 IPC_RXDMA_BUFFER_SIZE);
+    }
+  }
+  else
+#endif /* IPC_USE_RX_DMA == 1U */
+  {
+    uart_status = HAL_UART_Receive_IT(IPC_DevicesList[device_id].phy_int.h_uart,
+                                      (uint8_t *)IPC_DevicesList[device_id].RxChar, 1U);
+  }
+
+  return (uart_status);
+}
+
+/**
+  * brief  Resume UART reception of an IPC device after a pause (RX FIFO was full).
+  * param  device_id IPC device identifier.
+  * retval HAL status
+  */
+static HAL_StatusTypeDef resume_UART_RX(uint8_t device_id)
+{
+  HAL_StatusTypeDef uart_status;
+
+#if (IPC_USE_RX_DMA == 1U)
+  if (IPC_DevicesList[device_id].rx_mode == IPC_RX_MODE_DMA)
+  {
+    if (IPC_DevicesList[device_id].phy_int.h_uart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      /* DMA reception has only been paused, data received before the pause are still in the RX DMA buffer */
+      uart_status = HAL_UART_DMAResume(IPC_DevicesList[device_id].phy_int.h_uart);
+    }
+    else
+    {
+      uart_status = start_UART_RX(device_id);
+    }
+  }
+  else
+#endif /* IPC_USE_RX_DMA == 1U */
+  {
+    uart_status = start_UART_RX(device_id);
+  }
+
+  return (uart_status);
+}
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    ppposif_fcs.h
+  * @author  MCD Application Team
+  * @brief   Header for ppposif_fcs.c module: PPP 16-bit FCS (RFC 1662)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018-2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PPPOSIF_FCS_H
+#define PPPOSIF_FCS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "plf_config.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* FCS backend of ppposif_fcs_block():
+ * - 0U: software, table lookup
+ * - 1U: CRC peripheral configured for CRC-16/X.25 (HAL CRC module has to be enabled and its clock enabled
+ *       in HAL_CRC_MspInit), software for the blocks shorter than PPPOSIF_FCS_HW_MIN_SIZE
+ *       or when the peripheral initialization fails
+ */
+#if !defined(PPPOSIF_FCS_HW_CRC)
+#define PPPOSIF_FCS_HW_CRC       (0U)
+#endif /* !defined(PPPOSIF_FCS_HW_CRC) */
+
+/* Below this size, locking and loading the CRC peripheral costs more than the table lookup */
+#if !defined(PPPOSIF_FCS_HW_MIN_SIZE)
+#define PPPOSIF_FCS_HW_MIN_SIZE  (32U)
+#endif /* !defined(PPPOSIF_FCS_HW_MIN_SIZE) */
+
+#define PPPOSIF_FCS_INIT         ((uint16_t)0xFFFFU) /* Initial FCS value */
+#define PPPOSIF_FCS_GOOD         ((uint16_t)0xF0B8U) /* FCS over a frame and its complemented FCS */
+
+/* External variables --------------------------------------------------------*/
+extern const uint16_t ppposif_fcs_table[256];
+
+/* Exported macros -----------------------------------------------------------*/
+/* FCS update with one byte, for the loops which escape / unescape the frame at the same time
+ * (each byte of the frame read once): software only, the running value of the CRC peripheral
+ * can not be shared between the receive and the transmit paths
+ */
+#define PPPOSIF_FCS_BYTE(fcs, c) \
+  ((uint16_t)(((uint16_t)(fcs) >> 8) ^ ppposif_fcs_table[((uint16_t)(fcs) ^ (uint8_t)(c)) & 0xFFU]))
+
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Initialize the FCS backend (CRC peripheral when PPPOSIF_FCS_HW_CRC is 1U).
+  * @param  none
+  * @retval none
+  */
+void ppposif_fcs_init(void);
+
+/**
+  * @brief  Update a FCS with a block of data.
+  * @param  fcs      (in) current FCS value (PPPOSIF_FCS_INIT at the start of a frame)
+  * @param  p_data   (in) data
+  * @param  size     (in) data size
+  * @retval updated FCS value
+  */
+uint16_t ppposif_fcs_block(uint16_t fcs, const uint8_t *p_data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PPPOSIF_FCS_H */
@@ -69,6 +69,22 @@ extern int16_t ppposif_ipc_write(IPC_Device_t pDevice, u8_t *data, int16_t len);
   */
 extern int16_t   ppposif_ipc_read(IPC_Device_t pDevice, u8_t *buff, int16_t size);
 
+/**
+  * @brief  Rcv data without copy
+  * @param  pDevice: serial device.
+  * @param  pp_data: updated with the address of the received data in the IPC stream buffer.
+  * @retval data rcv byte number - data stay in the IPC stream buffer until ppposif_ipc_read_release() is called
+  */
+extern int16_t   ppposif_ipc_read_span(IPC_Device_t pDevice, u8_t **pp_data);
+
+/**
+  * @brief  Release data received with ppposif_ipc_read_span
+  * @param  pDevice: serial device.
+  * @param  size: data size to release.
+  * @retval none
+  */
+extern void      ppposif_ipc_read_release(IPC_Device_t pDevice, int16_t size);
+
 /**
   * @brief  component de init
   * @param  pDevice: device to de init.
@@ -35,10 +35,13 @@
 #include "netif/ppp/pppos.h"
 #include "lwip/sys.h"
 #include "lwip/dns.h"
+#include "lwip/tcpip.h"
 /*cstat +MISRAC2012-* */
 
 /* Private defines -----------------------------------------------------------*/
+#if (LWIP_TCPIP_CORE_LOCKING == 0)
 #define RCV_SIZE_MAX 100
+#endif /* LWIP_TCPIP_CORE_LOCKING == 0 */
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
@@ -223,6 +226,8 @@ void ppposif_status_cb(ppp_pcb *pcb, int32_t err_code, void *ctx)
 
 /**
   * @brief  read data from serial and send it to PPP
+  * @note   With LWIP_TCPIP_CORE_LOCKING, data are decoded by PPPoS directly in the IPC stream buffer
+  *         in the calling thread under the lwIP core lock: no intermediate copy and no TCPIP thread message
   * @param  ppp_netif      (in) netif reference
   * @param  p_ppp_pcb      (in) pcb reference
   * @param  pDevice        (in) serial device id
@@ -233,6 +238,20 @@ void ppposif_input(const struct netif *ppp_netif, ppp_pcb  *p_ppp_pcb, IPC_Devic
 {
   UNUSED(ppp_netif);
   int32_t rcv_size;
+#if (LWIP_TCPIP_CORE_LOCKING == 1)
+  u8_t *p_rcv_data = NULL;
+
+  rcv_size = ppposif_ipc_read_span(pDevice, &p_rcv_data);
+  if (rcv_size != 0)
+  {
+    /* traceIF_hexPrint(DBG_CHAN_PPPOSIF, DBL_LVL_P0, p_rcv_data, rcv_size) */
+    /* Pass received data to PPPoS to be decoded: data are released only once decoded */
+    LOCK_TCPIP_CORE();
+    pppos_input(p_ppp_pcb, p_rcv_data, rcv_size);
+    UNLOCK_TCPIP_CORE();
+  }
+  ppposif_ipc_read_release(pDevice, (int16_t)rcv_size);
+#else
   uint8_t rcvChar[RCV_SIZE_MAX];
 
   rcv_size = ppposif_ipc_read(pDevice, rcvChar, RCV_SIZE_MAX);
@@ -242,6 +261,7 @@ void ppposif_input(const struct netif *ppp_netif, ppp_pcb  *p_ppp_pcb, IPC_Devic
     /* Pass received data to PPPoS to be decoded through lwIP TCPIP thread */
     (void)pppos_input_tcpip(p_ppp_pcb, rcvChar, rcv_size);
   }
+#endif /* LWIP_TCPIP_CORE_LOCKING == 1 */
 }
 
 /**
@@ -99,12 +99,14 @@ void ppposif_ipc_init(IPC_Device_t pDevice)
   ppposif_ipc_ctx[pDevice].sndSemaphoreFlag  = 0U;
   ppposif_ipc_ctx[pDevice].TransmitOnGoing   = 0U;
 
+  /* binary semaphore: signaled by IPC when data arrives in an empty stream buffer */
   ppposif_ipc_ctx[pDevice].rcvSemaphore = rtosalSemaphoreNew((const rtosal_char_t *) "SEM_UART_RCV",
-                                                             (uint16_t) 10000U);
+                                                             (uint16_t) 1U);
   if (ppposif_ipc_ctx[pDevice].rcvSemaphore == NULL)
   {
     ERROR_Handler(DBG_CHAN_PPPOSIF, 11, ERROR_FATAL);
   }
+  (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
 
   ppposif_ipc_ctx[pDevice].sndSemaphore = rtosalSemaphoreNew((const rtosal_char_t *) "SEM_UART_SND",
                                                              (uint16_t) 1U);
@@ -150,13 +152,59 @@ int16_t ppposif_ipc_read(IPC_Device_t pDevice, u8_t *buff, int16_t size)
   ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 2U;
   (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
   ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 0U;
-  __disable_irq();
   (void)IPC_streamReceive(ppposif_ipc_ctx[pDevice].ipcHandle, buff, &size);
-  __enable_irq();
+
+  /* IPC only signals the stream buffer going from empty to not empty: keep the semaphore signaled while data
+     remains. Checked after the read index update, so data received meanwhile is signaled here or by IPC */
+  if (IPC_streamAvailable(ppposif_ipc_ctx[pDevice].ipcHandle) != 0U)
+  {
+    (void)rtosalSemaphoreRelease(ppposif_ipc_ctx[pDevice].rcvSemaphore);
+  }
 
   return size;
 }
 
+/**
+  * @brief  Rcv data without copy
+  * @param  pDevice: serial device.
+  * @param  pp_data: updated with the address of the received data in the IPC stream buffer.
+  * @retval data rcv byte number - data stay in the IPC stream buffer until ppposif_ipc_read_release() is called
+  */
+
+int16_t ppposif_ipc_read_span(IPC_Device_t pDevice, u8_t **pp_data)
+{
+  uint16_t size = 0U;
+
+  ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 2U;
+  (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
+  ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 0U;
+  (void)IPC_streamGetSpan(ppposif_ipc_ctx[pDevice].ipcHandle, pp_data, &size);
+
+  return ((int16_t)size);
+}
+
+/**
+  * @brief  Release data received with ppposif_ipc_read_span
+  * @param  pDevice: serial device.
+  * @param  size: data size to release.
+  * @retval none
+  */
+
+void ppposif_ipc_read_release(IPC_Device_t pDevice, int16_t size)
+{
+  if (size > 0)
+  {
+    (void)IPC_streamReleaseSpan(ppposif_ipc_ctx[pDevice].ipcHandle, (uint16_t)size);
+  }
+
+  /* IPC only signals the stream buffer going from empty to not empty: keep the semaphore signaled while data
+     remains (e.g. second part of data wrapping at the end of the stream buffer) */
+  if (IPC_streamAvailable(ppposif_ipc_ctx[pDevice].ipcHandle) != 0U)
+  {
+    (void)rtosalSemaphoreRelease(ppposif_ipc_ctx[pDevice].rcvSemaphore);
+  }
+}
+
 /**
   * @brief  Tx Send data
   * @param  pDevice: device .
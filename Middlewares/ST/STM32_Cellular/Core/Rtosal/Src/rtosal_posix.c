@@ -0,0 +1,977 @@
+/**
+  ******************************************************************************
+  * @file           rtosal_posix.c
+  * @author         MCD Application Team
+  * @brief          This file provides the rtosal services on top of POSIX
+  *                 threads, to run the Cellular middleware on a host.
+  * @note           It implements only the services used by Cellular, with the
+  *                 CMSIS RTOS V1 return codes (see Projects/Misc/RTOS/Posix).
+  *                 It replaces rtosal.c in host builds: never link both.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_setname_np */
+#endif /* !defined(_GNU_SOURCE) */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "rtosal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Common part of every blocking object: a lock and a monotonic condition */
+typedef struct
+{
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+} rtosal_sync_t;
+
+struct os_thread_cb
+{
+  pthread_t    thread;
+  os_pthread   func;
+  void        *p_arg;
+};
+
+struct os_semaphore_cb
+{
+  rtosal_sync_t sync;
+  uint32_t      count;
+  uint32_t      max_count;
+};
+
+struct os_mutex_cb
+{
+  rtosal_sync_t sync;
+  bool          locked;
+};
+
+struct os_messageQ_cb
+{
+  rtosal_sync_t sync;
+  uint32_t     *p_msg;
+  uint32_t      size;
+  uint32_t      count;
+  uint32_t      index_read;
+};
+
+struct os_timer_cb
+{
+  struct os_timer_cb *p_next;      /* next timer in the armed list */
+  os_ptimer           func;
+  os_timer_type       type;
+  void               *p_arg;
+  uint32_t            period;      /* in ms */
+  uint64_t            expiry;      /* absolute time in ms */
+  bool                armed;
+};
+
+/* Private defines -----------------------------------------------------------*/
+/* Host thread stacks are not sized from the target configuration:
+   glibc printf and friends need far more than a Cortex-M thread */
+#define RTOSAL_POSIX_MIN_STACK_SIZE   (256U * 1024U)
+
+/* Environment variable accelerating the whole time base (tick, timeouts, delays, timers):
+   e.g. RTOSAL_POSIX_TIME_SCALE=10 runs a 5s modem boot delay in 0.5s against a simulator */
+#define RTOSAL_POSIX_TIME_SCALE_ENV   "RTOSAL_POSIX_TIME_SCALE"
+#define RTOSAL_POSIX_TIME_SCALE_MAX   (1000U)
+
+/* Private macros ------------------------------------------------------------*/
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_once_t rtosal_posix_once = PTHREAD_ONCE_INIT;
+static struct timespec rtosal_posix_origin;
+static uint32_t rtosal_posix_time_scale;
+
+/* Timer service: one thread runs every callback, as the RTOS timer task does */
+static rtosal_sync_t rtosal_timer_sync;
+static struct os_timer_cb *p_rtosal_timer_list;
+static bool rtosal_timer_thread_started;
+static pthread_t rtosal_timer_thread;
+
+static __thread struct os_thread_cb *p_rtosal_thread_self;
+
+/* Global variables ----------------------------------------------------------*/
+
+/* Private function prototypes -----------------------------------------------*/
+static void rtosal_posix_init(void);
+static uint64_t rtosal_now_ms(void);
+static void rtosal_sync_init(rtosal_sync_t *p_sync);
+static void rtosal_sync_deinit(rtosal_sync_t *p_sync);
+static int rtosal_sync_wait(rtosal_sync_t *p_sync, uint64_t deadline);
+static uint64_t rtosal_deadline(uint32_t millisec);
+static struct timespec rtosal_real_time_from(uint64_t millisec);
+static void *rtosal_thread_entry(void *p_arg);
+static void *rtosal_timer_task(void *p_arg);
+static void rtosal_timer_unlink(struct os_timer_cb *p_timer);
+static void rtosal_timer_link(struct os_timer_cb *p_timer);
+
+/* Private functions definition -----------------------------------------------*/
+/**
+  * @brief  One time initialization: time origin and timer service lock.
+  * @retval -
+  */
+static void rtosal_posix_init(void)
+{
+  const char *p_scale = getenv(RTOSAL_POSIX_TIME_SCALE_ENV);
+
+  rtosal_posix_time_scale = 1U;
+  if (p_scale != NULL)
+  {
+    unsigned long scale = strtoul(p_scale, NULL, 10);
+    if ((scale > 1UL) && (scale <= (unsigned long)RTOSAL_POSIX_TIME_SCALE_MAX))
+    {
+      rtosal_posix_time_scale = (uint32_t)scale;
+    }
+  }
+  (void)clock_gettime(CLOCK_MONOTONIC, &rtosal_posix_origin);
+  rtosal_sync_init(&rtosal_timer_sync);
+  p_rtosal_timer_list = NULL;
+  rtosal_timer_thread_started = false;
+}
+
+/**
+  * @brief  Monotonic time since the first rtosal call.
+  * @retval uint64_t - time in ms, accelerated by the time scale.
+  */
+static uint64_t rtosal_now_ms(void)
+{
+  struct timespec now;
+
+  (void)pthread_once(&rtosal_posix_once, rtosal_posix_init);
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)((((int64_t)now.tv_sec - (int64_t)rtosal_posix_origin.tv_sec) * 1000000000LL
+                     + ((int64_t)now.tv_nsec - (int64_t)rtosal_posix_origin.tv_nsec))
+                    * (int64_t)rtosal_posix_time_scale / 1000000LL);
+}
+
+/**
+  * @brief  Convert a duration of the (accelerated) time base into a real duration.
+  * @param  millisec - duration in ms.
+  * @retval struct timespec - real duration.
+  */
+static struct timespec rtosal_real_time_from(uint64_t millisec)
+{
+  struct timespec duration;
+  uint64_t nsec = (millisec * 1000000U) / (uint64_t)rtosal_posix_time_scale;
+
+  duration.tv_sec = (time_t)(nsec / 1000000000U);
+  duration.tv_nsec = (long)(nsec % 1000000000U);
+
+  return (duration);
+}
+
+/**
+  * @brief  Initialize a lock and its condition on the monotonic clock.
+  * @param  p_sync - object to initialize.
+  * @retval -
+  */
+static void rtosal_sync_init(rtosal_sync_t *p_sync)
+{
+  pthread_condattr_t attr;
+
+  (void)pthread_mutex_init(&p_sync->lock, NULL);
+  (void)pthread_condattr_init(&attr);
+  (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  (void)pthread_cond_init(&p_sync->cond, &attr);
+  (void)pthread_condattr_destroy(&attr);
+}
+
+/**
+  * @brief  Release the resources of a lock and its condition.
+  * @param  p_sync - object to deinitialize.
+  * @retval -
+  */
+static void rtosal_sync_deinit(rtosal_sync_t *p_sync)
+{
+  (void)pthread_cond_destroy(&p_sync->cond);
+  (void)pthread_mutex_destroy(&p_sync->lock);
+}
+
+/**
+  * @brief  Compute the deadline of a wait.
+  * @note   In an interrupt handler the wait never blocks, as with the "FromISR" services.
+  * @param  millisec - timeout value (in ms), RTOSAL_WAIT_FOREVER or 0.
+  * @retval uint64_t - absolute time in ms, UINT64_MAX for no deadline.
+  */
+static uint64_t rtosal_deadline(uint32_t millisec)
+{
+  uint64_t deadline;
+
+  if (osPosixInHandlerMode() != 0)
+  {
+    deadline = rtosal_now_ms();
+  }
+  else if (millisec == RTOSAL_WAIT_FOREVER)
+  {
+    deadline = UINT64_MAX;
+  }
+  else
+  {
+    deadline = rtosal_now_ms() + (uint64_t)millisec;
+  }
+
+  return (deadline);
+}
+
+/**
+  * @brief  Wait on the condition of an object, its lock being held.
+  * @param  p_sync   - object to wait on.
+  * @param  deadline - absolute time in ms or UINT64_MAX.
+  * @retval int      - 0 when woken up, ETIMEDOUT when the deadline is reached.
+  */
+static int rtosal_sync_wait(rtosal_sync_t *p_sync, uint64_t deadline)
+{
+  int ret;
+
+  if (deadline == UINT64_MAX)
+  {
+    ret = pthread_cond_wait(&p_sync->cond, &p_sync->lock);
+  }
+  else if (rtosal_now_ms() >= deadline)
+  {
+    ret = ETIMEDOUT;
+  }
+  else
+  {
+    struct timespec abstime;
+    struct timespec remaining = rtosal_real_time_from(deadline - rtosal_now_ms());
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &abstime);
+    abstime.tv_sec  += remaining.tv_sec;
+    abstime.tv_nsec += remaining.tv_nsec;
+    if (abstime.tv_nsec >= 1000000000L)
+    {
+      abstime.tv_sec++;
+      abstime.tv_nsec -= 1000000000L;
+    }
+    ret = pthread_cond_timedwait(&p_sync->cond, &p_sync->lock, &abstime);
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  Entry point of every rtosal thread.
+  * @param  p_arg - thread control block.
+  * @retval void * - unused.
+  */
+static void *rtosal_thread_entry(void *p_arg)
+{
+  struct os_thread_cb *p_thread = (struct os_thread_cb *)p_arg;
+
+  p_rtosal_thread_self = p_thread;
+  p_thread->func(p_thread->p_arg);
+
+  return (NULL);
+}
+
+/**
+  * @brief  Remove a timer from the armed list, timer service lock held.
+  * @param  p_timer - timer to remove.
+  * @retval -
+  */
+static void rtosal_timer_unlink(struct os_timer_cb *p_timer)
+{
+  struct os_timer_cb **pp_cur = &p_rtosal_timer_list;
+
+  while (*pp_cur != NULL)
+  {
+    if (*pp_cur == p_timer)
+    {
+      *pp_cur = p_timer->p_next;
+      break;
+    }
+    pp_cur = &(*pp_cur)->p_next;
+  }
+  p_timer->p_next = NULL;
+  p_timer->armed = false;
+}
+
+/**
+  * @brief  Insert a timer in the armed list sorted by expiry, timer service lock held.
+  * @param  p_timer - timer to insert.
+  * @retval -
+  */
+static void rtosal_timer_link(struct os_timer_cb *p_timer)
+{
+  struct os_timer_cb **pp_cur = &p_rtosal_timer_list;
+
+  while ((*pp_cur != NULL) && ((*pp_cur)->expiry <= p_timer->expiry))
+  {
+    pp_cur = &(*pp_cur)->p_next;
+  }
+  p_timer->p_next = *pp_cur;
+  *pp_cur = p_timer;
+  p_timer->armed = true;
+}
+
+/**
+  * @brief  Timer service thread: call the callbacks of the expired timers.
+  * @param  p_arg - unused.
+  * @retval void * - unused.
+  */
+static void *rtosal_timer_task(void *p_arg)
+{
+  (void)p_arg;
+
+  (void)pthread_mutex_lock(&rtosal_timer_sync.lock);
+  for (;;)
+  {
+    struct os_timer_cb *p_timer = p_rtosal_timer_list;
+
+    if (p_timer == NULL)
+    {
+      (void)rtosal_sync_wait(&rtosal_timer_sync, UINT64_MAX);
+    }
+    else if (p_timer->expiry > rtosal_now_ms())
+    {
+      (void)rtosal_sync_wait(&rtosal_timer_sync, p_timer->expiry);
+    }
+    else
+    {
+      os_ptimer func = p_timer->func;
+      void *p_timer_arg = p_timer->p_arg;
+
+      rtosal_timer_unlink(p_timer);
+      if (p_timer->type == osTimerPeriodic)
+      {
+        p_timer->expiry += (uint64_t)p_timer->period;
+        rtosal_timer_link(p_timer);
+      }
+      /* Callback may start/stop timers: call it unlocked */
+      (void)pthread_mutex_unlock(&rtosal_timer_sync.lock);
+      func(p_timer_arg);
+      (void)pthread_mutex_lock(&rtosal_timer_sync.lock);
+    }
+  }
+
+  return (NULL);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Default: no interrupt handler emulation on the host.
+  * @retval int32_t - 0.
+  */
+__attribute__((weak)) int32_t osPosixInHandlerMode(void)
+{
+  return (0);
+}
+
+/*********************************** KERNEL ***********************************/
+/**
+  * @brief  Initialize the RTOS kernel.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalKernelInitialize(void)
+{
+  (void)pthread_once(&rtosal_posix_once, rtosal_posix_init);
+  return (osOK);
+}
+
+/**
+  * @brief  Start the RTOS kernel scheduler.
+  * @note   Threads run as soon as created on the host: nothing to start.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalKernelStart(void)
+{
+  return (osOK);
+}
+
+/**
+  * @brief  Get the RTOS kernel system timer count.
+  * @note   Host tick is 1ms, as configTICK_RATE_HZ on the boards.
+  * @retval uint32_t - RTOS kernel current system timer count as 32-bit value.
+  */
+uint32_t rtosalGetSysTimerCount(void)
+{
+  return ((uint32_t)rtosal_now_ms());
+}
+
+/*********************************** THREAD ***********************************/
+/**
+  * @brief  Create a Thread and Add it to Active Threads.
+  * @note   The thread is detached; priority is ignored (host scheduling policy).
+  * @param  p_name     - thread name.
+  * @param  func       - thread function.
+  * @param  priority   - initial thread priority.
+  * @param  stacksize  - stack size requirements in dwords.
+  * @param  p_arg      - argument passed to the thread function when it is started.
+  * @retval osThreadId - thread ID for reference by other functions or NULL in case of error.
+  */
+osThreadId rtosalThreadNew(const rtosal_char_t *p_name, os_pthread func, osPriority priority, uint32_t stacksize,
+                           void *p_arg)
+{
+  struct os_thread_cb *p_thread;
+  pthread_attr_t attr;
+  size_t stack_size = (size_t)stacksize * (size_t)RTOSAL_STACK_TYPE_SIZE;
+
+  (void)priority;
+  (void)pthread_once(&rtosal_posix_once, rtosal_posix_init);
+
+  p_thread = (struct os_thread_cb *)malloc(sizeof(struct os_thread_cb));
+  if (p_thread != NULL)
+  {
+    p_thread->func = func;
+    p_thread->p_arg = p_arg;
+
+    if (stack_size < RTOSAL_POSIX_MIN_STACK_SIZE)
+    {
+      stack_size = RTOSAL_POSIX_MIN_STACK_SIZE;
+    }
+    (void)pthread_attr_init(&attr);
+    (void)pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    (void)pthread_attr_setstacksize(&attr, stack_size);
+    if (pthread_create(&p_thread->thread, &attr, rtosal_thread_entry, p_thread) != 0)
+    {
+      free(p_thread);
+      p_thread = NULL;
+    }
+#if defined(__GLIBC__)
+    else if (p_name != NULL)
+    {
+      /* Linux limits thread names to 15 characters */
+      char name[16];
+      (void)strncpy(name, (const char *)p_name, sizeof(name) - 1U);
+      name[sizeof(name) - 1U] = '\0';
+      (void)pthread_setname_np(p_thread->thread, name);
+    }
+#endif /* defined(__GLIBC__) */
+    (void)pthread_attr_destroy(&attr);
+  }
+#if !defined(__GLIBC__)
+  (void)p_name;
+#endif /* !defined(__GLIBC__) */
+
+  return (p_thread);
+}
+
+/**
+  * @brief  Return the thread ID of the current running thread.
+  * @note   A thread not created by rtosal (e.g main) gets its ID on first call.
+  * @retval osThreadId - thread ID reference by other functions or NULL in case of error.
+  */
+osThreadId rtosalThreadGetId(void)
+{
+  if (p_rtosal_thread_self == NULL)
+  {
+    p_rtosal_thread_self = (struct os_thread_cb *)calloc(1U, sizeof(struct os_thread_cb));
+    if (p_rtosal_thread_self != NULL)
+    {
+      p_rtosal_thread_self->thread = pthread_self();
+    }
+  }
+
+  return (p_rtosal_thread_self);
+}
+
+/**
+  * @brief  Terminate execution of a thread and remove it from Active Threads.
+  * @param  thread_id    - thread ID obtained by rtosalThreadNew, NULL for the running thread.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalThreadTerminate(osThreadId thread_id)
+{
+  rtosalStatus status = osOK;
+
+  if ((thread_id == NULL) || (thread_id == p_rtosal_thread_self))
+  {
+    pthread_exit(NULL);
+  }
+  else if (pthread_cancel(thread_id->thread) != 0)
+  {
+    status = osErrorParameter;
+  }
+  /* Control block is kept: thread may still run until its next cancellation point */
+
+  return (status);
+}
+
+/********************************* SEMAPHORE **********************************/
+/**
+  * @brief  Create and Initialize a Semaphore object.
+  * @param  p_name        - semaphore name (unused).
+  * @param  count         - number of available resources.
+  * @note   At creation semaphore max count is set to count.
+  * @retval osSemaphoreId - semaphore ID for reference by other functions or NULL in case of error.
+  */
+osSemaphoreId rtosalSemaphoreNew(const rtosal_char_t *p_name, uint32_t count)
+{
+  struct os_semaphore_cb *p_sem;
+
+  (void)p_name;
+  p_sem = (struct os_semaphore_cb *)malloc(sizeof(struct os_semaphore_cb));
+  if (p_sem != NULL)
+  {
+    rtosal_sync_init(&p_sem->sync);
+    p_sem->count = count;
+    p_sem->max_count = count;
+  }
+
+  return (p_sem);
+}
+
+/**
+  * @brief  Acquire a Semaphore token.
+  * @param  semaphore_id - semaphore ID obtained by rtosalSemaphoreNew.
+  * @param  millisec     - timeout value (in ms) or 0 in case of no time-out.
+  * @retval rtosalStatus - osOK, osErrorOS when no token is available (as CMSIS RTOS V1).
+  */
+rtosalStatus rtosalSemaphoreAcquire(osSemaphoreId semaphore_id, uint32_t millisec)
+{
+  rtosalStatus status = osOK;
+
+  if (semaphore_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    uint64_t deadline = rtosal_deadline(millisec);
+
+    (void)pthread_mutex_lock(&semaphore_id->sync.lock);
+    while ((semaphore_id->count == 0U) && (status == osOK))
+    {
+      if (rtosal_sync_wait(&semaphore_id->sync, deadline) == ETIMEDOUT)
+      {
+        status = osErrorOS;
+      }
+    }
+    if (status == osOK)
+    {
+      semaphore_id->count--;
+    }
+    (void)pthread_mutex_unlock(&semaphore_id->sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Release a Semaphore token.
+  * @param  semaphore_id - semaphore ID obtained by rtosalSemaphoreNew.
+  * @retval rtosalStatus - osOK, osErrorOS if the maximum count is already reached.
+  */
+rtosalStatus rtosalSemaphoreRelease(osSemaphoreId semaphore_id)
+{
+  rtosalStatus status = osOK;
+
+  if (semaphore_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    (void)pthread_mutex_lock(&semaphore_id->sync.lock);
+    if (semaphore_id->count < semaphore_id->max_count)
+    {
+      semaphore_id->count++;
+      (void)pthread_cond_signal(&semaphore_id->sync.cond);
+    }
+    else
+    {
+      status = osErrorOS;
+    }
+    (void)pthread_mutex_unlock(&semaphore_id->sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Delete a Semaphore object.
+  * @param  semaphore_id - semaphore ID obtained by rtosalSemaphoreNew.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalSemaphoreDelete(osSemaphoreId semaphore_id)
+{
+  rtosalStatus status = osOK;
+
+  if (semaphore_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    rtosal_sync_deinit(&semaphore_id->sync);
+    free(semaphore_id);
+  }
+
+  return (status);
+}
+
+/*********************************** MUTEX ************************************/
+/**
+  * @brief  Create and Initialize a Mutex object.
+  * @note   Non-recursive mutex, as on the boards.
+  * @param  p_name    - mutex name (unused).
+  * @retval osMutexId - mutex ID for reference by other functions or NULL in case of error.
+  */
+osMutexId rtosalMutexNew(const rtosal_char_t *p_name)
+{
+  struct os_mutex_cb *p_mutex;
+
+  (void)p_name;
+  p_mutex = (struct os_mutex_cb *)malloc(sizeof(struct os_mutex_cb));
+  if (p_mutex != NULL)
+  {
+    rtosal_sync_init(&p_mutex->sync);
+    p_mutex->locked = false;
+  }
+
+  return (p_mutex);
+}
+
+/**
+  * @brief  Acquire a Mutex.
+  * @param  mutex_id     - mutex ID obtained by rtosalMutexNew.
+  * @param  millisec     - timeout value (in ms) or 0 in case of no time-out.
+  * @retval rtosalStatus - osOK, osErrorOS when the mutex is not available (as CMSIS RTOS V1).
+  */
+rtosalStatus rtosalMutexAcquire(osMutexId mutex_id, uint32_t millisec)
+{
+  rtosalStatus status = osOK;
+
+  if (mutex_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    uint64_t deadline = rtosal_deadline(millisec);
+
+    (void)pthread_mutex_lock(&mutex_id->sync.lock);
+    while ((mutex_id->locked == true) && (status == osOK))
+    {
+      if (rtosal_sync_wait(&mutex_id->sync, deadline) == ETIMEDOUT)
+      {
+        status = osErrorOS;
+      }
+    }
+    if (status == osOK)
+    {
+      mutex_id->locked = true;
+    }
+    (void)pthread_mutex_unlock(&mutex_id->sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Release a Mutex that was acquired by rtosalMutexAcquire.
+  * @param  mutex_id     - mutex ID obtained by rtosalMutexNew.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalMutexRelease(osMutexId mutex_id)
+{
+  rtosalStatus status = osOK;
+
+  if (mutex_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    (void)pthread_mutex_lock(&mutex_id->sync.lock);
+    if (mutex_id->locked == true)
+    {
+      mutex_id->locked = false;
+      (void)pthread_cond_signal(&mutex_id->sync.cond);
+    }
+    else
+    {
+      status = osErrorOS;
+    }
+    (void)pthread_mutex_unlock(&mutex_id->sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Delete a Mutex object.
+  * @param  mutex_id - mutex ID obtained by rtosalMutexNew.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalMutexDelete(osMutexId mutex_id)
+{
+  rtosalStatus status = osOK;
+
+  if (mutex_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    rtosal_sync_deinit(&mutex_id->sync);
+    free(mutex_id);
+  }
+
+  return (status);
+}
+
+/******************************* MESSAGE QUEUE ********************************/
+/**
+  * @brief  Create and Initialize a Message Queue object.
+  * @note   This implementation supports 32-bit sized messages only.
+  * @param  p_name       - message queue name (unused).
+  * @param  queue_size   - maximum number of messages in queue.
+  * @retval osMessageQId - message queue ID for reference by other functions or NULL in case of error.
+  */
+osMessageQId rtosalMessageQueueNew(const rtosal_char_t *p_name, uint32_t queue_size)
+{
+  struct os_messageQ_cb *p_queue = NULL;
+
+  (void)p_name;
+  if (queue_size != 0U)
+  {
+    p_queue = (struct os_messageQ_cb *)malloc(sizeof(struct os_messageQ_cb));
+  }
+  if (p_queue != NULL)
+  {
+    p_queue->p_msg = (uint32_t *)malloc(queue_size * sizeof(uint32_t));
+    if (p_queue->p_msg == NULL)
+    {
+      free(p_queue);
+      p_queue = NULL;
+    }
+    else
+    {
+      rtosal_sync_init(&p_queue->sync);
+      p_queue->size = queue_size;
+      p_queue->count = 0U;
+      p_queue->index_read = 0U;
+    }
+  }
+
+  return (p_queue);
+}
+
+/**
+  * @brief Put a Message into a Queue.
+  * @param mq_id         - message queue ID obtained by rtosalMessageNew.
+  * @param msg           - message to put into a queue.
+  * @param millisec      - timeout value (in ms) or 0 in case of no time-out.
+  * @retval rtosalStatus - osOK, osErrorOS if the queue is full (as CMSIS RTOS V1).
+  */
+rtosalStatus rtosalMessageQueuePut(osMessageQId mq_id, uint32_t msg, uint32_t millisec)
+{
+  rtosalStatus status = osOK;
+
+  if (mq_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    uint64_t deadline = rtosal_deadline(millisec);
+
+    (void)pthread_mutex_lock(&mq_id->sync.lock);
+    while ((mq_id->count == mq_id->size) && (status == osOK))
+    {
+      if (rtosal_sync_wait(&mq_id->sync, deadline) == ETIMEDOUT)
+      {
+        status = osErrorOS;
+      }
+    }
+    if (status == osOK)
+    {
+      mq_id->p_msg[(mq_id->index_read + mq_id->count) % mq_id->size] = msg;
+      mq_id->count++;
+      /* Readers and writers share the condition */
+      (void)pthread_cond_broadcast(&mq_id->sync.cond);
+    }
+    (void)pthread_mutex_unlock(&mq_id->sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief Get a Message from a Queue.
+  * @param mq_id         - message queue id obtained by rtosalMessageNew.
+  * @param p_msg         - pointer to buffer for message to get from a queue.
+  * @param millisec      - timeout value (in ms) or 0 in case of no time-out.
+  * @retval rtosalStatus - osEventMessage if a msg is available,
+  *                        osEventTimeout (osOK if millisec is 0) otherwise (as CMSIS RTOS V1).
+  */
+rtosalStatus rtosalMessageQueueGet(osMessageQId mq_id, uint32_t *p_msg, uint32_t millisec)
+{
+  rtosalStatus status = osEventMessage;
+
+  if ((mq_id == NULL) || (p_msg == NULL))
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    uint64_t deadline = rtosal_deadline(millisec);
+
+    (void)pthread_mutex_lock(&mq_id->sync.lock);
+    while ((mq_id->count == 0U) && (status == osEventMessage))
+    {
+      if (rtosal_sync_wait(&mq_id->sync, deadline) == ETIMEDOUT)
+      {
+        status = (millisec == 0U) ? osOK : osEventTimeout;
+      }
+    }
+    if (status == osEventMessage)
+    {
+      *p_msg = mq_id->p_msg[mq_id->index_read];
+      mq_id->index_read = (mq_id->index_read + 1U) % mq_id->size;
+      mq_id->count--;
+      (void)pthread_cond_broadcast(&mq_id->sync.cond);
+    }
+    (void)pthread_mutex_unlock(&mq_id->sync.lock);
+  }
+
+  return (status);
+}
+
+/*********************************** TIMER ************************************/
+/**
+  * @brief Create and Initialize a Timer object.
+  * @param   p_name   - timer name (unused).
+  * @param   func     - function pointer to timer callback function.
+  * @param   type     - osTimerOnce for one-shot or osTimerPeriodic for periodic behavior
+  * @param   p_arg    - argument passed to the timer callback function when it is called.
+  * @retval osTimerId - timer ID for reference by other functions or NULL in case of error.
+  */
+osTimerId rtosalTimerNew(const rtosal_char_t *p_name, os_ptimer func, os_timer_type type, void *p_arg)
+{
+  struct os_timer_cb *p_timer = NULL;
+
+  (void)p_name;
+  (void)pthread_once(&rtosal_posix_once, rtosal_posix_init);
+
+  (void)pthread_mutex_lock(&rtosal_timer_sync.lock);
+  if (rtosal_timer_thread_started == false)
+  {
+    if (pthread_create(&rtosal_timer_thread, NULL, rtosal_timer_task, NULL) == 0)
+    {
+      (void)pthread_detach(rtosal_timer_thread);
+      rtosal_timer_thread_started = true;
+    }
+  }
+  if ((rtosal_timer_thread_started == true) && (func != NULL))
+  {
+    p_timer = (struct os_timer_cb *)calloc(1U, sizeof(struct os_timer_cb));
+    if (p_timer != NULL)
+    {
+      p_timer->func = func;
+      p_timer->type = type;
+      p_timer->p_arg = p_arg;
+    }
+  }
+  (void)pthread_mutex_unlock(&rtosal_timer_sync.lock);
+
+  return (p_timer);
+}
+
+/**
+  * @brief Start or Restart a Timer.
+  * @param  timer_id     - timer ID obtained by rtosalTimerNew.
+  * @param  millisec     - time delay value (in ms) of the timer.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalTimerStart(osTimerId timer_id, uint32_t millisec)
+{
+  rtosalStatus status = osOK;
+
+  if (timer_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    (void)pthread_mutex_lock(&rtosal_timer_sync.lock);
+    rtosal_timer_unlink(timer_id);
+    /* Minimum delay = 1 tick */
+    timer_id->period = (millisec == 0U) ? 1U : millisec;
+    timer_id->expiry = rtosal_now_ms() + (uint64_t)timer_id->period;
+    rtosal_timer_link(timer_id);
+    (void)pthread_cond_signal(&rtosal_timer_sync.cond);
+    (void)pthread_mutex_unlock(&rtosal_timer_sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief Stop a Timer.
+  * @param  timer_id     - timer ID obtained by rtosalTimerNew.
+  * @retval rtosalStatus - osOK even if the timer is not started (as CMSIS RTOS V1).
+  */
+rtosalStatus rtosalTimerStop(osTimerId timer_id)
+{
+  rtosalStatus status = osOK;
+
+  if (timer_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    (void)pthread_mutex_lock(&rtosal_timer_sync.lock);
+    rtosal_timer_unlink(timer_id);
+    (void)pthread_mutex_unlock(&rtosal_timer_sync.lock);
+  }
+
+  return (status);
+}
+
+/**
+  * @brief Delete a Timer object.
+  * @param   timer_id    - timer ID obtained by rtosalTimerNew.
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalTimerDelete(osTimerId timer_id)
+{
+  rtosalStatus status = rtosalTimerStop(timer_id);
+
+  if (status == osOK)
+  {
+    free(timer_id);
+  }
+
+  return (status);
+}
+
+/*********************************** DELAY ************************************/
+/**
+  * @brief Wait for Timeout (Time Delay).
+  * @param  millisec     - time delay value (in ms).
+  * @retval rtosalStatus - indicate the execution status of the function.
+  */
+rtosalStatus rtosalDelay(uint32_t millisec)
+{
+  struct timespec delay;
+
+  (void)pthread_once(&rtosal_posix_once, rtosal_posix_init);
+  delay = rtosal_real_time_from((uint64_t)millisec);
+  while (nanosleep(&delay, &delay) != 0)
+  {
+    /* Interrupted by a signal: sleep the remaining time */
+  }
+
+  return (osOK);
+}
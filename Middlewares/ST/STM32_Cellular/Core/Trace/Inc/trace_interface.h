@@ -25,6 +25,7 @@ extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
 #include "plf_config.h"
 #include "cellular_runtime_standard.h"
 #include "cellular_runtime_custom.h"
@@ -49,6 +50,55 @@ typedef uint8_t dbg_levels_t;
 /* Maximum buffer size (per channel) */
 #define DBG_IF_MAX_BUFFER_SIZE  (uint16_t)(256)
 
+/* Binary traces: to be defined in plf_sw_config.h
+ * 0: TRACE_PRINT formats the trace (sprintf) and sends it on UART in the context of the caller
+ * 1: TRACE_PRINT records a binary trace (format string address, timestamp, raw arguments) in a ring buffer,
+ *    a low priority thread sends the records on UART.
+ *    Text traces are rebuilt on host side by Scripts/trace_decoder.py using the application elf file.
+ */
+#if !defined TRACE_IF_BINARY
+#define TRACE_IF_BINARY         (0U)
+#endif /* !defined TRACE_IF_BINARY */
+
+#if (TRACE_IF_BINARY == 1U)
+/* Size in 32-bit words of the binary traces ring buffer (must be a power of 2) */
+#if !defined TRACE_IF_BIN_BUFFER_SIZE
+#define TRACE_IF_BIN_BUFFER_SIZE        (1024U)
+#endif /* !defined TRACE_IF_BIN_BUFFER_SIZE */
+/* Maximum size in 32-bit words of a binary trace record (255 max) */
+#define TRACE_IF_BIN_RECORD_MAX_SIZE    (96U)
+/* Maximum size of a string argument in a binary trace record (longer strings are truncated) */
+#define TRACE_IF_BIN_STRING_MAX_SIZE    (240U)
+/* Period in ms of the binary traces ring buffer flush */
+#define TRACE_IF_BIN_FLUSH_PERIOD       (10U)
+#endif /* TRACE_IF_BINARY == 1U */
+
+/* Trace transmission: to be defined in plf_sw_config.h
+ * 0: traces are sent on UART in blocking mode in the context of the caller
+ * 1: traces are copied in a double buffer and sent on UART in background
+ *    (DMA if a TX DMA is linked to the trace UART handle, interrupt otherwise)
+ *    HAL_UART_TxCpltCallback and HAL_UART_ErrorCallback must call traceIF_uartTxCpltCallback and
+ *    traceIF_uartErrorCallback for the trace UART instance.
+ */
+#if !defined TRACE_IF_TX_ASYNC
+#define TRACE_IF_TX_ASYNC       (0U)
+#endif /* !defined TRACE_IF_TX_ASYNC */
+
+#if (TRACE_IF_TX_ASYNC == 1U)
+/* Overflow policy when a trace doesn't fit in the buffer being filled */
+#define TRACE_IF_TX_DROP_NEWEST         (0U) /* the new trace is dropped */
+#define TRACE_IF_TX_DROP_OLDEST         (1U) /* oldest traces not yet in transmission are dropped */
+#if !defined TRACE_IF_TX_OVERFLOW_POLICY
+#define TRACE_IF_TX_OVERFLOW_POLICY     TRACE_IF_TX_DROP_NEWEST
+#endif /* !defined TRACE_IF_TX_OVERFLOW_POLICY */
+/* Size in bytes of each of the two transmission buffers */
+#if !defined TRACE_IF_TX_BUFFER_SIZE
+#define TRACE_IF_TX_BUFFER_SIZE         (1024U)
+#endif /* !defined TRACE_IF_TX_BUFFER_SIZE */
+/* Maximum number of traces in a transmission buffer */
+#define TRACE_IF_TX_TRACE_MAX_NB        (64U)
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+
 /* Exported types ------------------------------------------------------------*/
 
 /* Define here the list of channels */
@@ -144,11 +194,70 @@ void traceIF_BufCharPrint(dbg_channels_t chan, dbg_levels_t level, const CRC_CHA
   */
 void traceIF_BufHexPrint(dbg_channels_t chan, dbg_levels_t level, const CRC_CHAR_t *buf, uint16_t size);
 
+/**
+  * @brief  Check if a trace has to be printed
+  * @param  chan - component channel
+  * @param  lvl - trace level
+  * @retval true if global trace, trace level and component trace are enabled
+  */
+bool traceIF_isEnabled(uint8_t chan, uint8_t lvl);
+
+#if (TRACE_IF_BINARY == 1U)
+/**
+  * @brief  Record a binary trace in the ring buffer (no formatting)
+  * @note   Trace filter is not checked: call traceIF_isEnabled first
+  * @param  chan - component channel
+  * @param  lvl - trace level
+  * @param  p_format - format string of the trace (its address identifies the trace)
+  * @retval -
+  */
+void traceIF_binPrint(uint8_t chan, uint8_t lvl, const CRC_CHAR_t *p_format, ...);
+#endif /* TRACE_IF_BINARY == 1U */
+
+#if (TRACE_IF_TX_ASYNC == 1U)
+/**
+  * @brief  Trace UART transmission complete - to call from HAL_UART_TxCpltCallback
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void traceIF_uartTxCpltCallback(UART_HandleTypeDef *huart);
+
+/**
+  * @brief  Trace UART error - to call from HAL_UART_ErrorCallback
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void traceIF_uartErrorCallback(UART_HandleTypeDef *huart);
+
+/**
+  * @brief  Get the number of bytes dropped on a channel because of transmission buffer overflow
+  * @param  chan - component channel
+  * @retval number of dropped bytes
+  */
+uint32_t traceIF_getDroppedBytes(uint8_t chan);
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+
+/* Trace filter is checked first: no formatting cost for filtered traces */
 #if (TRACE_IF_TRACES_UART == 1U)
+#if (TRACE_IF_BINARY == 1U)
 #define TRACE_PRINT(chan, lvl, format, args...) \
-  (void)sprintf((CRC_CHAR_t *)dbgIF_buf[(chan)], format "", ## args);\
-  traceIF_uartPrint( (uint8_t)(chan), (uint8_t)lvl, (uint8_t *)dbgIF_buf[(chan)],\
-                     (uint16_t)crs_strlen(dbgIF_buf[(chan)]));
+  do {\
+    if (traceIF_isEnabled((uint8_t)(chan), (uint8_t)(lvl)) == true)\
+    {\
+      traceIF_binPrint((uint8_t)(chan), (uint8_t)(lvl), format "", ## args);\
+    }\
+  } while (false);
+#else
+#define TRACE_PRINT(chan, lvl, format, args...) \
+  do {\
+    if (traceIF_isEnabled((uint8_t)(chan), (uint8_t)(lvl)) == true)\
+    {\
+      (void)sprintf((CRC_CHAR_t *)dbgIF_buf[(chan)], format "", ## args);\
+      traceIF_uartPrint( (uint8_t)(chan), (uint8_t)lvl, (uint8_t *)dbgIF_buf[(chan)],\
+                         (uint16_t)crs_strlen(dbgIF_buf[(chan)]));\
+    }\
+  } while (false);
+#endif /* TRACE_IF_BINARY == 1U */
 #else
 #define TRACE_PRINT(...)      __NOP(); /* Nothing to do */
 #endif /* TRACE_IF_TRACES_UART == 1U */
@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+  ******************************************************************************
+  * @file    trace_decoder.py
+  * @author  MCD Application Team
+  * @brief   Host decoder of the binary traces (TRACE_IF_BINARY == 1U)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018-2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+
+  When TRACE_IF_BINARY is set to 1U, TRACE_PRINT does not format the trace on target:
+  it records the format string address, a timestamp and the raw arguments (see trace_interface.c).
+  This script rebuilds the text traces from the trace UART stream (or from a capture file)
+  and the elf file of the application (used to read the format strings).
+  Text traces (PRINT_FORCE, TRACE_VALID, ...) are passed through, once unescaped: in a text trace the bytes
+  TRACE_IF_BIN_SYNC and TRACE_IF_BIN_ESC are sent as TRACE_IF_BIN_ESC followed by the byte XOR TRACE_IF_BIN_ESC_XOR.
+
+  Usage:
+    trace_decoder.py app.elf capture.bin            decode a capture file
+    trace_decoder.py app.elf /dev/ttyACM0 -b 115200 decode a serial port (needs pyserial)
+    options: -t display the timestamp of binary traces
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+TRACE_IF_BIN_SYNC = 0xA5
+TRACE_IF_BIN_ESC = 0xDB
+TRACE_IF_BIN_ESC_XOR = 0x20
+TRACE_IF_BIN_HEADER_SIZE = 3
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+# %[flags][width][.precision][length]conversion - '*' width/precision are arguments
+FORMAT_SPEC = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t|L)?([diuoxXcspnfFeEgGaA%])")
+
+
+class ElfStrings:
+    """Read null terminated strings at a given address in the allocated sections of an ELF32 file"""
+
+    def __init__(self, path):
+        with open(path, "rb") as elf_file:
+            self.data = elf_file.read()
+        if self.data[0:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("%s is not an ELF32 file" % path)
+        endian = "<" if self.data[5] == 1 else ">"
+        e_shoff, = struct.unpack_from(endian + "I", self.data, 0x20)
+        e_shentsize, e_shnum = struct.unpack_from(endian + "HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(e_shnum):
+            (_, sh_type, sh_flags, sh_addr, sh_offset, sh_size) = \
+                struct.unpack_from(endian + "IIIIII", self.data, e_shoff + (i * e_shentsize))
+            if (sh_flags & SHF_ALLOC) and sh_type != SHT_NOBITS and sh_size != 0:
+                self.sections.append((sh_addr, sh_size, sh_offset))
+        self.cache = {}
+
+    def get(self, address):
+        if address not in self.cache:
+            string = None
+            for (sh_addr, sh_size, sh_offset) in self.sections:
+                if sh_addr <= address < sh_addr + sh_size:
+                    start = sh_offset + (address - sh_addr)
+                    end = self.data.find(b"\0", start, sh_offset + sh_size)
+                    if end >= 0:
+                        string = self.data[start:end].decode("latin-1")
+                    break
+            self.cache[address] = string
+        return self.cache[address]
+
+
+def format_record(fmt, words):
+    """Rebuild the text of a trace from its format string and its argument words"""
+    index = [0]
+
+    def next_word():
+        value = words[index[0]] if index[0] < len(words) else 0
+        index[0] += 1
+        return value
+
+    def signed32(value):
+        return value - (1 << 32) if value & 0x80000000 else value
+
+    def replace(match):
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if width == "*":
+            width = str(signed32(next_word()))
+        if precision == "*":
+            precision = str(signed32(next_word()))
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        if conversion in "fFeEgGaA" or (length == "ll" and conversion in "diuoxX"):
+            low = next_word()
+            value = low | (next_word() << 32)
+            if conversion in "fFeEgGaA":
+                value = struct.unpack("<d", struct.pack("<Q", value))[0]
+                conversion = "e" if conversion in "aA" else conversion.replace("F", "f")
+            elif conversion in "di" and value & (1 << 63):
+                value -= 1 << 64
+        elif conversion == "s":
+            length_str = next_word()
+            raw = b"".join(struct.pack("<I", next_word()) for _ in range((length_str + 3) // 4))
+            value = raw[:length_str].decode("latin-1")
+        elif conversion == "n":
+            next_word()
+            return ""
+        elif conversion == "p":
+            return "0x%08x" % next_word()
+        else:
+            value = next_word()
+            if conversion in "di":
+                value = signed32(value)
+                conversion = "d"
+            elif conversion == "u":
+                conversion = "d"
+            elif conversion == "c":
+                value = chr(value & 0xFF)
+            if length in ("h", "hh") and conversion not in "c":
+                mask = 0xFF if length == "hh" else 0xFFFF
+                if match.group(5) in "di":
+                    bits = 8 if length == "hh" else 16
+                    value &= mask
+                    value = value - (1 << bits) if value & (1 << (bits - 1)) else value
+                else:
+                    value &= mask
+        try:
+            return (spec + conversion) % value
+        except (TypeError, ValueError):
+            return "<?%s>" % match.group(0)
+
+    return FORMAT_SPEC.sub(replace, fmt)
+
+
+def decode(stream, strings, timestamp, output):
+    """Decode the trace stream: binary records start with TRACE_IF_BIN_SYNC, other bytes are (escaped) text"""
+    text_end = re.compile(bytes([ord("["), TRACE_IF_BIN_SYNC, TRACE_IF_BIN_ESC, ord("]")]))
+    buffer = b""
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        buffer += chunk
+        while buffer:
+            if buffer[0] == TRACE_IF_BIN_ESC:
+                if len(buffer) < 2:
+                    break
+                output.write(chr(buffer[1] ^ TRACE_IF_BIN_ESC_XOR))
+                buffer = buffer[2:]
+                continue
+            if buffer[0] != TRACE_IF_BIN_SYNC:
+                match = text_end.search(buffer)
+                text = buffer if match is None else buffer[:match.start()]
+                output.write(text.decode("latin-1"))
+                buffer = buffer[len(text):]
+                continue
+            if len(buffer) < 4:
+                break
+            nb_words = buffer[3]
+            if nb_words < TRACE_IF_BIN_HEADER_SIZE:
+                # not a valid record: resynchronize on next byte
+                output.write("<?>")
+                buffer = buffer[1:]
+                continue
+            if len(buffer) < nb_words * 4:
+                break
+            words = struct.unpack_from("<%dI" % nb_words, buffer, 0)
+            buffer = buffer[nb_words * 4:]
+            fmt = strings.get(words[2])
+            if fmt is None:
+                output.write("<unknown trace format 0x%08x>\r\n" % words[2])
+                continue
+            if timestamp:
+                output.write("[%10d] " % words[1])
+            output.write(format_record(fmt, list(words[TRACE_IF_BIN_HEADER_SIZE:])))
+        output.flush()
+
+
+class SerialStream:
+    """Blocking serial port read returning the bytes already received"""
+
+    def __init__(self, port):
+        self.port = port
+
+    def read(self, size):
+        return self.port.read(max(1, min(size, self.port.in_waiting)))
+
+    def close(self):
+        self.port.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode STM32_Cellular binary traces")
+    parser.add_argument("elf", help="elf file of the application")
+    parser.add_argument("input", help="capture file or serial port")
+    parser.add_argument("-b", "--baudrate", type=int, default=0, help="serial port baudrate")
+    parser.add_argument("-t", "--timestamp", action="store_true", help="display timestamp of binary traces")
+    args = parser.parse_args()
+
+    strings = ElfStrings(args.elf)
+    if args.baudrate != 0:
+        import serial  # pylint: disable=import-outside-toplevel
+        stream = SerialStream(serial.Serial(args.input, args.baudrate, timeout=None))
+    else:
+        stream = open(args.input, "rb")
+    try:
+        decode(stream, strings, args.timestamp, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stream.close()
+
+
+if __name__ == "__main__":
+    main()
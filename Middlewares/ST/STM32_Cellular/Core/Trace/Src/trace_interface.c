@@ -19,9 +19,15 @@
 /* Includes ------------------------------------------------------------------*/
 #include "trace_interface.h"
 #include "rtosal.h"
+#if (TRACE_IF_BINARY == 1U)
+#include "error_handler.h"
+#endif /* TRACE_IF_BINARY == 1U */
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#if (TRACE_IF_BINARY == 1U)
+#include <stdarg.h>
+#endif /* TRACE_IF_BINARY == 1U */
 
 
 #if (USE_CMD_CONSOLE == 1)
@@ -30,12 +36,47 @@
 
 
 /* Private typedef -----------------------------------------------------------*/
+#if (TRACE_IF_TX_ASYNC == 1U)
+/* Transmission buffer: filled by traceIF_uartTransmit while the other one is sent on UART */
+typedef struct
+{
+  uint8_t  data[TRACE_IF_TX_BUFFER_SIZE];             /* traces bytes              */
+  uint16_t size;                                      /* number of bytes in data   */
+  uint16_t trace_nb;                                  /* number of traces in data  */
+  uint16_t trace_size[TRACE_IF_TX_TRACE_MAX_NB];      /* size of each trace        */
+  uint8_t  trace_chan[TRACE_IF_TX_TRACE_MAX_NB];      /* channel of each trace     */
+  uint8_t  writers;                                   /* traces being copied in data: buffer not sent */
+  bool     compacting;                                /* data being moved after a drop of oldest traces */
+} traceIF_txBuffer_t;
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+
 /* Private macros ------------------------------------------------------------*/
 #define PRINT_FORCE(format, args...)  TRACE_PRINT_FORCE(DBG_CHAN_UTILITIES, DBL_LVL_P0, format, ## args)
 
 /* Private defines -----------------------------------------------------------*/
 #define MAX_HEX_PRINT_SIZE     210U
 
+#if (TRACE_IF_BINARY == 1U)
+/* Binary trace record (32-bit words):
+ * word 0 : header   = TRACE_IF_BIN_SYNC | (chan << 8) | (lvl << 16) | (record size in words << 24)
+ *                     written last: a record is available for the flush thread only when its header is written
+ * word 1 : timestamp in ms
+ * word 2 : format string address
+ * word 3..n : arguments (int/char/pointer: 1 word, long long/double: 2 words,
+ *                        string: 1 word length + bytes padded to 4 bytes)
+ * Text traces (PRINT_FORCE, ...) are sent between the records: in a text trace, the bytes TRACE_IF_BIN_SYNC and
+ * TRACE_IF_BIN_ESC are sent as TRACE_IF_BIN_ESC followed by the byte XOR TRACE_IF_BIN_ESC_XOR, so that
+ * TRACE_IF_BIN_SYNC received outside a record always starts a new record
+ */
+#define TRACE_IF_BIN_SYNC           (0xA5U)
+#define TRACE_IF_BIN_ESC            (0xDBU)
+#define TRACE_IF_BIN_ESC_XOR        (0x20U)
+#define TRACE_IF_BIN_ESC_CHUNK_SIZE (32U)   /* escaped text is sent by chunks of this size */
+#define TRACE_IF_BIN_HEADER_SIZE    (3U)
+#define TRACE_IF_BIN_RING_MASK      (TRACE_IF_BIN_BUFFER_SIZE - 1U)
+#define TRACE_IF_BIN_DROPPED_SIZE   (48U)
+#endif /* TRACE_IF_BINARY == 1U */
+
 /* Private variables ---------------------------------------------------------*/
 static bool traceIF_traceEnable = true; /* Trace enable per default */
 static uint32_t traceIF_Level = TRACE_IF_MASK;
@@ -63,13 +104,62 @@ static uint8_t traceIF_traceComponent[DBG_CHAN_MAX_VALUE] =
   1U    /*  DBG_CHAN_VALID             */
 };
 
+#if (TRACE_IF_BINARY == 1U)
+/* Binary traces ring buffer
+ * traceIF_binHead: words reserved by the producers (updated with exclusive access, no interrupt masking)
+ * traceIF_binTail: words sent by the flush thread (only consumer)
+ * Both are free running counters, index in the ring is obtained with TRACE_IF_BIN_RING_MASK
+ */
+static uint32_t traceIF_binRing[TRACE_IF_BIN_BUFFER_SIZE];
+static volatile uint32_t traceIF_binHead = 0U;
+static volatile uint32_t traceIF_binTail = 0U;
+/* Number of traces dropped because ring buffer full or record too big */
+static volatile uint32_t traceIF_binDropped = 0U;
+/* Thread sending binary traces on UART */
+static osThreadId traceIF_binThreadId = NULL;
+#endif /* TRACE_IF_BINARY == 1U */
+
+#if (TRACE_IF_TX_ASYNC == 1U)
+/* Double buffer: traceIF_txBuffer[traceIF_txFillIdx] is filled, the other one is in transmission */
+static traceIF_txBuffer_t traceIF_txBuffer[2];
+static volatile uint8_t traceIF_txFillIdx = 0U;
+static volatile bool traceIF_txOngoing = false;
+/* Number of bytes dropped per channel because of transmission buffer overflow */
+static uint32_t traceIF_txDroppedBytes[DBG_CHAN_MAX_VALUE];
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+
 #if (USE_CMD_CONSOLE == 1)
 #if (SW_DEBUG_VERSION == 1)
 static uint8_t *trace_cmd_label = (uint8_t *)"trace";
+
+/* Component name string */
+static uint8_t *traceIF_traceComponentName[DBG_CHAN_MAX_VALUE] =
+{
+  (uint8_t *)"main",
+  (uint8_t *)"atcmd",
+  (uint8_t *)"cellular_service",
+  (uint8_t *)"comlib",
+  (uint8_t *)"ipc",
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
+  (uint8_t *)"ppposif",
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_LWIP */
+  (uint8_t *)"utilities",
+  (uint8_t *)"error",
+#if (USE_DBG_CHAN_APPLICATION == 1U)
+  (uint8_t *)"app",
+#endif /* USE_DBG_CHAN_APPLICATION == 1U */
+  (uint8_t *)"valid"
+};
 #endif /* SW_DEBUG_VERSION == 1 */
 #endif  /* (USE_CMD_CONSOLE == 1) */
 
 /* Private function prototypes -----------------------------------------------*/
+#if (TRACE_IF_BINARY == 1U)
+static uint32_t traceIF_binEncode(const CRC_CHAR_t *p_format, va_list args, uint32_t pos, uint32_t max_words);
+static void traceIF_binWrite(uint32_t pos, uint32_t index, uint32_t max_words, uint32_t value);
+static void traceIF_binFlush(void);
+static void traceIF_binThreadBody(void *p_argument);
+#endif /* TRACE_IF_BINARY == 1U */
 
 #if (USE_CMD_CONSOLE == 1)
 #if (SW_DEBUG_VERSION == 1)
@@ -94,25 +184,6 @@ uint8_t dbgIF_buf[DBG_CHAN_MAX_VALUE][DBG_IF_MAX_BUFFER_SIZE];
   */
 static void CMD_ComponentEnableDisable(uint8_t *component, uint8_t enable)
 {
-  /* Component name string */
-  static uint8_t *traceIF_traceComponentName[DBG_CHAN_MAX_VALUE] =
-  {
-    (uint8_t *)"main",
-    (uint8_t *)"atcmd",
-    (uint8_t *)"cellular_service",
-    (uint8_t *)"comlib",
-    (uint8_t *)"ipc",
-#if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
-    (uint8_t *)"ppposif",
-#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_LWIP */
-    (uint8_t *)"utilities",
-    (uint8_t *)"error",
-#if (USE_DBG_CHAN_APPLICATION == 1U)
-    (uint8_t *)"app",
-#endif /* USE_DBG_CHAN_APPLICATION == 1U */
-    (uint8_t *)"valid"
-  };
-
   uint8_t i;
 
   /* Is request for all components ? */
@@ -180,7 +251,44 @@ static void traceIF_cmd_Help(void)
               trace_cmd_label)
 #endif /* USE_DBG_CHAN_APPLICATION == 1U */
   PRINT_FORCE(" -> disable traces of selected component\r\n")
+#if (TRACE_IF_TX_ASYNC == 1U)
+  PRINT_FORCE("%s dropped [reset] (display [then reset] bytes dropped per component)\r\n", trace_cmd_label)
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+}
+
+#if (TRACE_IF_TX_ASYNC == 1U)
+/**
+  * @brief  Display the number of bytes dropped per component
+  * @param  reset - true: reset the counters after display
+  * @retval -
+  */
+static void CMD_DisplayDropped(bool reset)
+{
+  uint32_t dropped[DBG_CHAN_MAX_VALUE];
+  uint32_t primask;
+  uint8_t i;
+
+  /* Counters are updated with interrupts disabled: take a coherent snapshot */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0U; i < (uint8_t)DBG_CHAN_MAX_VALUE; i++)
+  {
+    dropped[i] = traceIF_txDroppedBytes[i];
+    if (reset == true)
+    {
+      traceIF_txDroppedBytes[i] = 0U;
+    }
+  }
+  __set_PRIMASK(primask);
+
+  PRINT_FORCE("Trace bytes dropped (buffer %d bytes, policy %s):\r\n", TRACE_IF_TX_BUFFER_SIZE,
+              (TRACE_IF_TX_OVERFLOW_POLICY == TRACE_IF_TX_DROP_OLDEST) ? "drop oldest" : "drop newest")
+  for (i = 0U; i < (uint8_t)DBG_CHAN_MAX_VALUE; i++)
+  {
+    PRINT_FORCE(" %-16s: %ld\r\n", traceIF_traceComponentName[i], dropped[i])
+  }
 }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
 
 /**
   * @brief  console cmd management
@@ -251,6 +359,15 @@ static void traceIF_cmd(uint8_t *cmd_line_p)
           traceIF_Level = level;
         }
       }
+#if (TRACE_IF_TX_ASYNC == 1U)
+      /* 'dropped' : display bytes dropped per component */
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "dropped", strlen((CRC_CHAR_t *)argv_p[0])) == 0)
+      {
+        CMD_DisplayDropped(((argc > 1U)
+                            && (strncmp((CRC_CHAR_t *)argv_p[1], "reset", strlen((CRC_CHAR_t *)argv_p[1])) == 0))
+                           ? true : false);
+      }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
       /* 'off' : disable traces */
       else if (strncmp((CRC_CHAR_t *)argv_p[0], "off", strlen((CRC_CHAR_t *)argv_p[0])) == 0)
       {
@@ -269,14 +386,200 @@ static void traceIF_cmd(uint8_t *cmd_line_p)
 #endif /* SW_DEBUG_VERSION == 1 */
 #endif  /* (USE_CMD_CONSOLE == 1) */
 
+#if (TRACE_IF_TX_ASYNC == 1U)
+/**
+  * @brief  Drop the oldest traces of a transmission buffer
+  * @note   Called with interrupts disabled
+  *         Only the traces description is updated: the bytes of the remaining traces are still after the dropped
+  *         ones, the caller moves them at the beginning of the buffer
+  * @param  p_buffer - transmission buffer
+  * @param  nb - number of traces to drop
+  * @retval number of bytes dropped
+  */
+static uint16_t traceIF_txDrop(traceIF_txBuffer_t *p_buffer, uint16_t nb)
+{
+  uint16_t size = 0U;
+  uint16_t i;
+
+  /* Count the dropped bytes per channel */
+  for (i = 0U; i < nb; i++)
+  {
+    traceIF_txDroppedBytes[p_buffer->trace_chan[i]] += p_buffer->trace_size[i];
+    size += p_buffer->trace_size[i];
+  }
+
+  /* Keep the description of the remaining traces at the beginning */
+  if (nb < p_buffer->trace_nb)
+  {
+    (void)memmove((void *)&p_buffer->trace_size[0], (const void *)&p_buffer->trace_size[nb],
+                  ((size_t)p_buffer->trace_nb - nb) * sizeof(p_buffer->trace_size[0]));
+    (void)memmove((void *)&p_buffer->trace_chan[0], (const void *)&p_buffer->trace_chan[nb],
+                  ((size_t)p_buffer->trace_nb - nb) * sizeof(p_buffer->trace_chan[0]));
+  }
+  p_buffer->size -= size;
+  p_buffer->trace_nb -= nb;
+
+  return (size);
+}
+
+/**
+  * @brief  Start the transmission of the buffer being filled if no transmission is on going
+  * @note   The buffer is not sent while traces are copied in it: the last copy starts the transmission
+  *         Interrupts are disabled only to swap the buffers, not during the UART start
+  * @param  -
+  * @retval -
+  */
+static void traceIF_txStart(void)
+{
+  traceIF_txBuffer_t *p_buffer = NULL;
+  HAL_StatusTypeDef status;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((traceIF_txOngoing == false) && (traceIF_txBuffer[traceIF_txFillIdx].size != 0U)
+      && (traceIF_txBuffer[traceIF_txFillIdx].writers == 0U))
+  {
+    /* Swap the buffers: the other one (empty) is now filled */
+    p_buffer = &traceIF_txBuffer[traceIF_txFillIdx];
+    traceIF_txFillIdx ^= 1U;
+    traceIF_txOngoing = true;
+  }
+  __set_PRIMASK(primask);
+
+  if (p_buffer != NULL)
+  {
+    if (TRACE_INTERFACE_UART_HANDLE.hdmatx != NULL)
+    {
+      status = HAL_UART_Transmit_DMA(&TRACE_INTERFACE_UART_HANDLE, p_buffer->data, p_buffer->size);
+    }
+    else
+    {
+      status = HAL_UART_Transmit_IT(&TRACE_INTERFACE_UART_HANDLE, p_buffer->data, p_buffer->size);
+    }
+
+    if (status != HAL_OK)
+    {
+      /* Transmission not possible: the traces are lost */
+      primask = __get_PRIMASK();
+      __disable_irq();
+      (void)traceIF_txDrop(p_buffer, p_buffer->trace_nb);
+      traceIF_txOngoing = false;
+      __set_PRIMASK(primask);
+    }
+  }
+}
+
+/**
+  * @brief  Print a trace through UART - trace is copied in the transmission buffer and sent in background
+  * @note   No mutex: the place is reserved with interrupts disabled (short, no copy), the trace is copied with
+  *         interrupts enabled, then committed with interrupts disabled
+  * @param  chan - component channel
+  * @param  ptr - pointer on the trace string
+  * @param  len - length of the trace string
+  * @retval -
+  */
+static void traceIF_uartTransmit(uint8_t chan, uint8_t *ptr, uint16_t len)
+{
+  traceIF_txBuffer_t *p_buffer;
+  uint32_t primask;
+  uint16_t offset = 0U;
+  uint16_t move_offset = 0U; /* bytes of the oldest traces dropped */
+  uint16_t move_size = 0U;   /* bytes of the remaining traces to move at the beginning of the buffer */
+  bool reserved = false;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  p_buffer = &traceIF_txBuffer[traceIF_txFillIdx];
+
+#if (TRACE_IF_TX_OVERFLOW_POLICY == TRACE_IF_TX_DROP_OLDEST)
+  /* Drop the oldest traces not yet in transmission to make room (not possible while traces are copied) */
+  if ((len <= TRACE_IF_TX_BUFFER_SIZE) && (p_buffer->writers == 0U))
+  {
+    uint16_t nb = 0U;
+    uint32_t free_size = (uint32_t)TRACE_IF_TX_BUFFER_SIZE - p_buffer->size;
+    while ((nb < p_buffer->trace_nb)
+           && ((free_size < len) || ((uint32_t)p_buffer->trace_nb - nb) >= TRACE_IF_TX_TRACE_MAX_NB))
+    {
+      free_size += p_buffer->trace_size[nb];
+      nb++;
+    }
+    if (nb != 0U)
+    {
+      move_offset = traceIF_txDrop(p_buffer, nb);
+      move_size = p_buffer->size;
+      if (move_size != 0U)
+      {
+        /* Other traces are dropped until the data are moved */
+        p_buffer->compacting = true;
+        p_buffer->writers++;
+      }
+    }
+  }
+#endif /* TRACE_IF_TX_OVERFLOW_POLICY == TRACE_IF_TX_DROP_OLDEST */
+
+  if ((((uint32_t)p_buffer->size + len) <= TRACE_IF_TX_BUFFER_SIZE)
+      && (p_buffer->trace_nb < TRACE_IF_TX_TRACE_MAX_NB)
+      && ((p_buffer->compacting == false) || (move_size != 0U)))
+  {
+    /* Reserve the place of the trace */
+    offset = p_buffer->size;
+    p_buffer->trace_size[p_buffer->trace_nb] = len;
+    p_buffer->trace_chan[p_buffer->trace_nb] = chan;
+    p_buffer->trace_nb++;
+    p_buffer->size += len;
+    p_buffer->writers++;
+    reserved = true;
+  }
+  else
+  {
+    /* Overflow: the new trace is dropped */
+    traceIF_txDroppedBytes[chan] += len;
+  }
+
+  __set_PRIMASK(primask);
+
+  if ((reserved == true) || (move_size != 0U))
+  {
+    if (move_size != 0U)
+    {
+      (void)memmove((void *)&p_buffer->data[0], (const void *)&p_buffer->data[move_offset], move_size);
+    }
+    if (reserved == true)
+    {
+      (void)memcpy((void *)&p_buffer->data[offset], (const void *)ptr, len);
+    }
+
+    /* Commit: the buffer is sent once all its traces are copied */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (move_size != 0U)
+    {
+      p_buffer->compacting = false;
+      p_buffer->writers--;
+    }
+    if (reserved == true)
+    {
+      p_buffer->writers--;
+    }
+    __set_PRIMASK(primask);
+
+    traceIF_txStart();
+  }
+}
+#else
 /**
   * @brief  Print a trace through UART
+  * @param  chan - component channel (unused parameter)
   * @param  ptr - pointer on the trace string
   * @param  len - length of the trace string
   * @retval -
   */
-static void traceIF_uartTransmit(uint8_t *ptr, uint16_t len)
+static void traceIF_uartTransmit(uint8_t chan, uint8_t *ptr, uint16_t len)
 {
+  UNUSED(chan);
+
   /* Mutex is used to avoid trace mixing between components */
   (void)rtosalMutexAcquire(traceIF_uart_mutex, RTOSAL_WAIT_FOREVER);
 
@@ -285,6 +588,296 @@ static void traceIF_uartTransmit(uint8_t *ptr, uint16_t len)
 
   (void)rtosalMutexRelease(traceIF_uart_mutex);
 }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+
+/**
+  * @brief  Print a text trace through UART
+  * @note   In binary mode, TRACE_IF_BIN_SYNC and TRACE_IF_BIN_ESC bytes are escaped (see record format)
+  * @param  chan - component channel
+  * @param  ptr - pointer on the trace string
+  * @param  len - length of the trace string
+  * @retval -
+  */
+static void traceIF_uartTransmitText(uint8_t chan, uint8_t *ptr, uint16_t len)
+{
+#if (TRACE_IF_BINARY == 1U)
+  uint8_t chunk[TRACE_IF_BIN_ESC_CHUNK_SIZE];
+  uint16_t i;
+  uint16_t size = 0U;
+
+  /* Usual case: no byte to escape, the trace is sent as is */
+  for (i = 0U; (i < len) && (ptr[i] != TRACE_IF_BIN_SYNC) && (ptr[i] != TRACE_IF_BIN_ESC); i++)
+  {
+    __NOP();
+  }
+
+  if (i == len)
+  {
+    traceIF_uartTransmit(chan, ptr, len);
+  }
+  else
+  {
+    for (i = 0U; i < len; i++)
+    {
+      /* Room for an escaped byte ? */
+      if ((size + 2U) > TRACE_IF_BIN_ESC_CHUNK_SIZE)
+      {
+        traceIF_uartTransmit(chan, chunk, size);
+        size = 0U;
+      }
+      if ((ptr[i] == TRACE_IF_BIN_SYNC) || (ptr[i] == TRACE_IF_BIN_ESC))
+      {
+        chunk[size] = TRACE_IF_BIN_ESC;
+        chunk[size + 1U] = ptr[i] ^ TRACE_IF_BIN_ESC_XOR;
+        size += 2U;
+      }
+      else
+      {
+        chunk[size] = ptr[i];
+        size++;
+      }
+    }
+    traceIF_uartTransmit(chan, chunk, size);
+  }
+#else
+  traceIF_uartTransmit(chan, ptr, len);
+#endif /* TRACE_IF_BINARY == 1U */
+}
+
+#if (TRACE_IF_BINARY == 1U)
+/**
+  * @brief  Compute and optionally write the arguments part of a binary trace record
+  * @note   Only the arguments are encoded: the format is parsed on host side to rebuild the trace
+  * @param  p_format - format string of the trace
+  * @param  args     - arguments of the trace
+  * @param  pos      - position in the ring buffer of the first argument word (used only if max_words is not 0)
+  * @param  max_words - 0: only compute the arguments size,
+  *                     else: write the arguments in the ring buffer, in at most max_words words (place reserved)
+  * @note   A string may change between the two calls (e.g a buffer updated by another thread): its length is
+  *         clamped to the place reserved, the words exceeding the reservation are never written
+  * @retval number of 32-bit words needed by the arguments
+  */
+static uint32_t traceIF_binEncode(const CRC_CHAR_t *p_format, va_list args, uint32_t pos, uint32_t max_words)
+{
+  const CRC_CHAR_t *p_char = p_format;
+  uint32_t nb_words = 0U;
+  uint32_t long_nb; /* number of 'l' length modifier */
+  bool conversion;
+
+  while (*p_char != '\0')
+  {
+    if (*p_char != '%')
+    {
+      p_char++;
+    }
+    else
+    {
+      p_char++;
+      long_nb = 0U;
+      conversion = true;
+      /* Flags, width, precision and length modifiers */
+      while (conversion == true)
+      {
+        if (*p_char == '*')
+        {
+          /* Width or precision provided as an argument */
+          uint32_t value = (uint32_t)va_arg(args, int32_t);
+          traceIF_binWrite(pos, nb_words, max_words, value);
+          nb_words++;
+          p_char++;
+        }
+        else if (*p_char == 'l')
+        {
+          long_nb++;
+          p_char++;
+        }
+        else if ((strchr("-+ #0123456789.hzjtL", (int32_t)*p_char) != NULL) && (*p_char != '\0'))
+        {
+          p_char++;
+        }
+        else
+        {
+          conversion = false;
+        }
+      }
+
+      /* Conversion specifier */
+      if ((*p_char == 'f') || (*p_char == 'F') || (*p_char == 'e') || (*p_char == 'E')
+          || (*p_char == 'g') || (*p_char == 'G') || (*p_char == 'a') || (*p_char == 'A')
+          || (((*p_char == 'd') || (*p_char == 'i') || (*p_char == 'u') || (*p_char == 'x') || (*p_char == 'X')
+               || (*p_char == 'o')) && (long_nb >= 2U)))
+      {
+        /* double or long long argument: 2 words */
+        uint64_t value;
+        if ((*p_char == 'd') || (*p_char == 'i') || (*p_char == 'u') || (*p_char == 'x') || (*p_char == 'X')
+            || (*p_char == 'o'))
+        {
+          value = va_arg(args, uint64_t);
+        }
+        else
+        {
+          double value_double = va_arg(args, double);
+          (void)memcpy((void *)&value, (const void *)&value_double, sizeof(value));
+        }
+        traceIF_binWrite(pos, nb_words, max_words, (uint32_t)value);
+        traceIF_binWrite(pos, nb_words + 1U, max_words, (uint32_t)(value >> 32));
+        nb_words += 2U;
+        p_char++;
+      }
+      else if (*p_char == 's')
+      {
+        /* string argument: length then bytes - string is copied because it may be a temporary buffer */
+        const uint8_t *p_string = va_arg(args, const uint8_t *);
+        uint32_t length = 0U;
+        if (p_string != NULL)
+        {
+          length = (uint32_t)crs_strlen(p_string);
+          if (length > TRACE_IF_BIN_STRING_MAX_SIZE)
+          {
+            length = TRACE_IF_BIN_STRING_MAX_SIZE;
+          }
+        }
+        if (max_words != 0U)
+        {
+          uint32_t word = 0U;
+          /* Clamp the length to the words reserved after the length word */
+          if (nb_words >= max_words)
+          {
+            length = 0U;
+          }
+          else if (length > ((max_words - nb_words - 1U) * 4U))
+          {
+            length = (max_words - nb_words - 1U) * 4U;
+          }
+          else
+          {
+            __NOP();
+          }
+          traceIF_binWrite(pos, nb_words, max_words, length);
+          for (uint32_t i = 0U; i < length; i++)
+          {
+            word |= ((uint32_t)p_string[i] << (8U * (i & 3U)));
+            if (((i & 3U) == 3U) || ((i + 1U) == length))
+            {
+              traceIF_binWrite(pos, nb_words + 1U + (i >> 2), max_words, word);
+              word = 0U;
+            }
+          }
+        }
+        nb_words += 1U + ((length + 3U) >> 2);
+        p_char++;
+      }
+      else if ((*p_char == 'd') || (*p_char == 'i') || (*p_char == 'u') || (*p_char == 'x') || (*p_char == 'X')
+               || (*p_char == 'o') || (*p_char == 'c') || (*p_char == 'p') || (*p_char == 'n'))
+      {
+        /* int, char or pointer argument: 1 word */
+        uint32_t value = (*p_char == 'p') ? (uint32_t)va_arg(args, void *) : (uint32_t)va_arg(args, uint32_t);
+        traceIF_binWrite(pos, nb_words, max_words, value);
+        nb_words++;
+        p_char++;
+      }
+      else if (*p_char == '%')
+      {
+        /* '%%': no argument */
+        p_char++;
+      }
+      else
+      {
+        /* Unknown or truncated conversion: stop the parsing, next arguments are not recorded */
+        break;
+      }
+    }
+  }
+
+  return (nb_words);
+}
+
+/**
+  * @brief  Write an argument word of a binary trace record if it is in the place reserved
+  * @param  pos       - position in the ring buffer of the first argument word
+  * @param  index     - index of the word in the arguments
+  * @param  max_words - number of argument words reserved
+  * @param  value     - word value
+  * @retval -
+  */
+static void traceIF_binWrite(uint32_t pos, uint32_t index, uint32_t max_words, uint32_t value)
+{
+  if (index < max_words)
+  {
+    traceIF_binRing[(pos + index) & TRACE_IF_BIN_RING_MASK] = value;
+  }
+}
+
+/**
+  * @brief  Send on UART the binary traces committed in the ring buffer
+  * @note   Called only by the trace thread
+  * @param  -
+  * @retval -
+  */
+static void traceIF_binFlush(void)
+{
+  static uint32_t traceIF_binRecord[TRACE_IF_BIN_RECORD_MAX_SIZE];
+  static uint32_t traceIF_binDroppedReported = 0U;
+  static uint8_t traceIF_binDroppedTrace[TRACE_IF_BIN_DROPPED_SIZE];
+  uint32_t tail = traceIF_binTail;
+  uint32_t header;
+  uint32_t nb_words;
+  bool leave = false;
+
+  while ((tail != traceIF_binHead) && (leave == false))
+  {
+    header = traceIF_binRing[tail & TRACE_IF_BIN_RING_MASK];
+    nb_words = header >> 24;
+    /* Record not yet committed by its producer ? */
+    if (((header & 0xFFU) != TRACE_IF_BIN_SYNC) || (nb_words < TRACE_IF_BIN_HEADER_SIZE))
+    {
+      leave = true;
+    }
+    else
+    {
+      __DMB();
+      /* Copy the record and clear it: a not yet committed record must never be seen as valid */
+      for (uint32_t i = 0U; i < nb_words; i++)
+      {
+        traceIF_binRecord[i] = traceIF_binRing[(tail + i) & TRACE_IF_BIN_RING_MASK];
+        traceIF_binRing[(tail + i) & TRACE_IF_BIN_RING_MASK] = 0U;
+      }
+      __DMB();
+      tail += nb_words;
+      /* Free the place in the ring buffer before the (slow) UART transmission */
+      traceIF_binTail = tail;
+      traceIF_uartTransmit((uint8_t)((header >> 8) & 0xFFU), (uint8_t *)traceIF_binRecord,
+                           (uint16_t)(nb_words * sizeof(uint32_t)));
+    }
+  }
+
+  /* Report the dropped traces in a text trace */
+  if (traceIF_binDropped != traceIF_binDroppedReported)
+  {
+    traceIF_binDroppedReported = traceIF_binDropped;
+    (void)sprintf((CRC_CHAR_t *)traceIF_binDroppedTrace, "\r\n<TRACE: %ld dropped>\r\n",
+                  (int32_t)traceIF_binDroppedReported);
+    traceIF_uartTransmit((uint8_t)DBG_CHAN_UTILITIES, traceIF_binDroppedTrace,
+                         (uint16_t)crs_strlen(traceIF_binDroppedTrace));
+  }
+}
+
+/**
+  * @brief  Trace thread body - send periodically the binary traces on UART
+  * @param  p_argument - unused
+  * @retval -
+  */
+static void traceIF_binThreadBody(void *p_argument)
+{
+  UNUSED(p_argument);
+
+  for (;;)
+  {
+    traceIF_binFlush();
+    (void)rtosalDelay(TRACE_IF_BIN_FLUSH_PERIOD);
+  }
+}
+#endif /* TRACE_IF_BINARY == 1U */
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -308,15 +901,15 @@ void traceIF_trace_on(void)
 }
 
 /**
-  * @brief  Print a trace on UART
+  * @brief  Check if a trace has to be printed
   * @param  chan - component channel
   * @param  lvl - trace level
-  * @param  pptr - pointer on the trace
-  * @param  len - length of the trace
-  * @retval -
+  * @retval true if global trace, trace level and component trace are enabled
   */
-void traceIF_uartPrint(uint8_t chan, uint8_t lvl, uint8_t *pptr, uint16_t len)
+bool traceIF_isEnabled(uint8_t chan, uint8_t lvl)
 {
+  bool ret = false;
+
   /* Is trace enable ? */
   if (traceIF_traceEnable == true)
   {
@@ -324,17 +917,104 @@ void traceIF_uartPrint(uint8_t chan, uint8_t lvl, uint8_t *pptr, uint16_t len)
     if ((traceIF_Level & lvl) != 0U)
     {
       /* Is the trace for this component activated ? */
-      if (traceIF_traceComponent[chan] != 0U)
+      if ((chan < (uint8_t)DBG_CHAN_MAX_VALUE) && (traceIF_traceComponent[chan] != 0U))
       {
-        uint8_t *ptr;
-        ptr = pptr;
+        ret = true;
+      }
+    }
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  Print a trace on UART
+  * @param  chan - component channel
+  * @param  lvl - trace level
+  * @param  pptr - pointer on the trace
+  * @param  len - length of the trace
+  * @retval -
+  */
+void traceIF_uartPrint(uint8_t chan, uint8_t lvl, uint8_t *pptr, uint16_t len)
+{
+  /* Is trace enable for this level and this component ? */
+  if (traceIF_isEnabled(chan, lvl) == true)
+  {
+    uint8_t *ptr;
+    ptr = pptr;
+
+    /* Print bytes of the trace  */
+    traceIF_uartTransmitText(chan, ptr, len);
+  }
+}
+
+#if (TRACE_IF_BINARY == 1U)
+/**
+  * @brief  Record a binary trace in the ring buffer (no formatting)
+  * @note   Trace filter is not checked: call traceIF_isEnabled first
+  *         Lock-free: may be called concurrently by several threads and from interrupt
+  * @param  chan - component channel
+  * @param  lvl - trace level
+  * @param  p_format - format string of the trace (its address identifies the trace)
+  * @retval -
+  */
+void traceIF_binPrint(uint8_t chan, uint8_t lvl, const CRC_CHAR_t *p_format, ...)
+{
+  va_list args;
+  uint32_t nb_words;
+  uint32_t written;
+  uint32_t head;
+  bool reserved = false;
+
+  /* Compute the record size */
+  va_start(args, p_format);
+  nb_words = TRACE_IF_BIN_HEADER_SIZE + traceIF_binEncode(p_format, args, 0U, 0U);
+  va_end(args);
 
-        /* Print bytes of the trace  */
-        traceIF_uartTransmit(ptr, len);
+  if (nb_words <= TRACE_IF_BIN_RECORD_MAX_SIZE)
+  {
+    /* Reserve the place in the ring buffer */
+    do
+    {
+      head = __LDREXW(&traceIF_binHead);
+      if ((head + nb_words - traceIF_binTail) > TRACE_IF_BIN_BUFFER_SIZE)
+      {
+        /* Ring buffer full */
+        __CLREX();
+        break;
       }
+      reserved = (__STREXW(head + nb_words, &traceIF_binHead) == 0U) ? true : false;
+    } while (reserved == false);
+  }
+
+  if (reserved == true)
+  {
+    /* Write the record: header is written last to commit it */
+    traceIF_binRing[(head + 1U) & TRACE_IF_BIN_RING_MASK] = HAL_GetTick();
+    traceIF_binRing[(head + 2U) & TRACE_IF_BIN_RING_MASK] = (uint32_t)p_format;
+    va_start(args, p_format);
+    written = traceIF_binEncode(p_format, args, head + TRACE_IF_BIN_HEADER_SIZE, nb_words - TRACE_IF_BIN_HEADER_SIZE);
+    va_end(args);
+    /* Arguments shorter than at sizing (string changed): clear the end of the place reserved */
+    for (written += TRACE_IF_BIN_HEADER_SIZE; written < nb_words; written++)
+    {
+      traceIF_binRing[(head + written) & TRACE_IF_BIN_RING_MASK] = 0U;
     }
+    __DMB();
+    traceIF_binRing[head & TRACE_IF_BIN_RING_MASK] = TRACE_IF_BIN_SYNC | ((uint32_t)chan << 8)
+                                                     | ((uint32_t)lvl << 16) | (nb_words << 24);
+  }
+  else
+  {
+    /* Trace dropped */
+    uint32_t dropped;
+    do
+    {
+      dropped = __LDREXW(&traceIF_binDropped);
+    } while (__STREXW(dropped + 1U, &traceIF_binDropped) != 0U);
   }
 }
+#endif /* TRACE_IF_BINARY == 1U */
 
 /**
   * @brief  Print a trace on UART even if global or component trace is disable
@@ -345,15 +1025,68 @@ void traceIF_uartPrint(uint8_t chan, uint8_t lvl, uint8_t *pptr, uint16_t len)
   */
 void traceIF_uartPrintForce(uint8_t chan, uint8_t *pptr, uint16_t len)
 {
-  UNUSED(chan);
-
   uint8_t *ptr;
   ptr = pptr;
 
   /* Print bytes of the trace */
-  traceIF_uartTransmit(ptr, len);
+  traceIF_uartTransmitText(chan, ptr, len);
 }
 
+#if (TRACE_IF_TX_ASYNC == 1U)
+/**
+  * @brief  Trace UART transmission complete - to call from HAL_UART_TxCpltCallback
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void traceIF_uartTxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+
+  /* Buffer in transmission is now empty */
+  traceIF_txBuffer[traceIF_txFillIdx ^ 1U].size = 0U;
+  traceIF_txBuffer[traceIF_txFillIdx ^ 1U].trace_nb = 0U;
+  traceIF_txOngoing = false;
+
+  /* Send the traces received during the transmission */
+  traceIF_txStart();
+}
+
+/**
+  * @brief  Trace UART error - to call from HAL_UART_ErrorCallback
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void traceIF_uartErrorCallback(UART_HandleTypeDef *huart)
+{
+  /* Transmission aborted by HAL ? (error callback is also called for console reception errors) */
+  if ((traceIF_txOngoing == true) && (huart->gState == HAL_UART_STATE_READY))
+  {
+    /* Buffer in transmission is lost */
+    (void)traceIF_txDrop(&traceIF_txBuffer[traceIF_txFillIdx ^ 1U],
+                         traceIF_txBuffer[traceIF_txFillIdx ^ 1U].trace_nb);
+    traceIF_txOngoing = false;
+    traceIF_txStart();
+  }
+}
+
+/**
+  * @brief  Get the number of bytes dropped on a channel because of transmission buffer overflow
+  * @param  chan - component channel
+  * @retval number of dropped bytes
+  */
+uint32_t traceIF_getDroppedBytes(uint8_t chan)
+{
+  uint32_t ret = 0U;
+
+  if (chan < (uint8_t)DBG_CHAN_MAX_VALUE)
+  {
+    ret = traceIF_txDroppedBytes[chan];
+  }
+
+  return (ret);
+}
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+
 /**
   * @brief  Print a trace in hexadecimal format
   * @note   Available for UART trace And NOT for printf
@@ -526,6 +1259,20 @@ void traceIF_init(void)
   */
 void traceIF_start(void)
 {
+#if (TRACE_IF_BINARY == 1U)
+  /* Multi call protection */
+  if (traceIF_binThreadId == NULL)
+  {
+    /* Thread sending the binary traces on UART */
+    traceIF_binThreadId = rtosalThreadNew((const rtosal_char_t *)"TraceIF", (os_pthread)traceIF_binThreadBody,
+                                          TRACE_IF_THREAD_PRIO, (uint32_t)TRACE_IF_THREAD_STACK_SIZE, NULL);
+    if (traceIF_binThreadId == NULL)
+    {
+      ERROR_Handler(DBG_CHAN_UTILITIES, 1, ERROR_FATAL);
+    }
+  }
+#endif /* TRACE_IF_BINARY == 1U */
+
 #if (USE_CMD_CONSOLE == 1)
 #if (SW_DEBUG_VERSION == 1)
   /* Registration to cmd module to support cmd 'trace' */
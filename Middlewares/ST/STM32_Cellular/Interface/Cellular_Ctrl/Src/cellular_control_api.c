@@ -150,19 +150,29 @@ static cellular_result_t cellular_api_register_general_cb(void)
   static bool cellular_api_global_cb_registered = false;
 
   cellular_result_t ret = CELLULAR_SUCCESS;
+  dc_com_reg_id_t reg_id;
+  dc_com_event_mask_t event_mask;
 
   /* if global call back not already registered to Data Cache */
   if (cellular_api_global_cb_registered == false)
   {
     /* register general call back to Data Cache  */
-    if (dc_com_register_gen_event_cb(&dc_com_db, cellular_api_general_data_cache_callback, (const void *)NULL) ==
-        DC_COM_INVALID_ENTRY)
+    reg_id = dc_com_register_gen_event_cb(&dc_com_db, cellular_api_general_data_cache_callback, (const void *)NULL);
+    if (reg_id == DC_COM_INVALID_ENTRY)
     {
       /* Data Cache registration returned an error */
       ret = CELLULAR_ERR_INTERNAL;
     }
     else
     {
+      /* Only the entries reported by cellular_api_general_data_cache_callback are notified */
+      event_mask = DC_COM_EVENT_MASK(DC_CELLULAR_INFO) | DC_COM_EVENT_MASK(DC_CELLULAR_SIGNAL_INFO)
+                   | DC_COM_EVENT_MASK(DC_CELLULAR_SIM_INFO) | DC_COM_EVENT_MASK(DC_CELLULAR_NFMC_INFO)
+                   | DC_COM_EVENT_MASK(DC_CELLULAR_NIFMAN_INFO);
+#if (USE_LOW_POWER == 1)
+      event_mask |= DC_COM_EVENT_MASK(DC_CELLULAR_POWER_STATUS);
+#endif /* (USE_LOW_POWER == 1) */
+      (void)dc_com_set_event_mask(&dc_com_db, reg_id, event_mask);
       /* Data Cache registration is OK, store the fact that cellular api global call back is now registered */
       cellular_api_global_cb_registered = true;
       /* Reset the content of the structure containing the call back information */
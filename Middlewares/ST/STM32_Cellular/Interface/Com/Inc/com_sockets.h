@@ -397,6 +397,16 @@ int32_t com_recvfrom(int32_t sock,
                      int32_t flags,
                      com_sockaddr_t *from, int32_t *fromlen);
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until at least one of the sockets is ready for the requested events
+  * @param  fds       - array of socket descriptors with the requested events
+  * @param  nfds      - number of elements in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 on timeout) or error value
+  */
+int32_t com_poll(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+
 
 /**
   * @brief  Socket close
@@ -568,6 +578,18 @@ bool com_sockets_init(void);
   */
 void com_sockets_start(void);
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/*** Used by com_sockets_ip_modem/com_sockets_lwip_mcu - Not an User Interface */
+
+/**
+  * @brief  DNS cache network status update
+  * @note   Network down: the cache is flushed
+  * @param  is_up     - true/false network up/down
+  * @retval -
+  */
+void com_sockets_dns_cache_network_status(bool is_up);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 #endif /* USE_COM_SOCKETS == 1 */
 
 
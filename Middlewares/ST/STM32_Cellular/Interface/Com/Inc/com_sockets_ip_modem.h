@@ -33,8 +33,27 @@ extern "C" {
 
 #include "com_common.h"
 #include "com_sockets_addr_compat.h"
+#include "com_sockets_net_compat.h"
 
 /* Exported constants --------------------------------------------------------*/
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+/* Size in bytes of the receive cache of each TCP socket */
+#if !defined COM_SOCKETS_RCV_CACHE_SIZE
+#define COM_SOCKETS_RCV_CACHE_SIZE          (1536U)
+#endif /* !defined COM_SOCKETS_RCV_CACHE_SIZE */
+
+/* High-water mark: no more data read from the modem while the cache holds at least this number of bytes */
+#if !defined COM_SOCKETS_RCV_CACHE_HIGH_WATER
+#define COM_SOCKETS_RCV_CACHE_HIGH_WATER    ((COM_SOCKETS_RCV_CACHE_SIZE * 3U) / 4U)
+#endif /* !defined COM_SOCKETS_RCV_CACHE_HIGH_WATER */
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+/* Size in bytes of the transmit queue of each TCP socket */
+#if !defined COM_SOCKETS_SND_QUEUE_SIZE
+#define COM_SOCKETS_SND_QUEUE_SIZE          (1536U)
+#endif /* !defined COM_SOCKETS_SND_QUEUE_SIZE */
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
 
 /* Exported types ------------------------------------------------------------*/
 
@@ -199,6 +218,12 @@ int32_t com_connect_ip_modem(int32_t sock,
   *         - if flags = COM_MSG_WAIT, application accept to wait
   *         if len of buffer to send > interface between COM and low level.
   *          COM will fragment the buffer according to the interface (multiple sends)
+  * @note   If COM_SOCKETS_SND_QUEUE == 1U, on a TCP socket data are copied in the socket transmit queue
+  *         and sent to the modem later: the number of bytes returned is the number of bytes queued
+  *         - if flags = COM_MSG_DONTWAIT, only the free part of the queue is used
+  *         (COM_SOCKETS_ERR_WOULDBLOCK if the queue is full)
+  *         - if flags = COM_MSG_WAIT, COM waits for free space until all data are queued
+  *         A send error at low level is returned by the next com_send (queued data are then lost)
   * @retval int32_t   - number of bytes sent or error value
   */
 int32_t com_send_ip_modem(int32_t sock,
@@ -238,9 +263,10 @@ int32_t com_sendto_ip_modem(int32_t sock,
   * @param  buf       - pointer to application data buffer to store the data to
   * @note   see below
   * @param  len       - size of application data buffer (in bytes)
-  * @note   even if len > interface between COM and low level
-  *         a maximum of the interface capacity can be received
-  *         at each function call
+  * @note   if len > interface between COM and low level
+  *         and the modem still has data after a read of the interface capacity
+  *         the next data are read in the same function call
+  *         until the application buffer is full
   * @param  flags     - options
   * @note
   *         - if flags = COM_MSG_DONTWAIT, application request to not wait
@@ -283,6 +309,19 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
                               int32_t flags,
                               com_sockaddr_t *from, int32_t *fromlen);
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until at least one of the sockets is ready for the requested events
+  *         Readiness is updated by the data received and closing notifications of the modem
+  *         Only one application thread at a time can wait in poll
+  * @param  fds       - array of socket descriptors with the requested events
+  * @param  nfds      - number of elements in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, negative value: wait forever
+  * @note   COM_POLLIN may be reported even if a next com_recv/com_recvfrom returns no data
+  * @retval int32_t   - number of sockets with returned events (0 on timeout) or error value
+  */
+int32_t com_poll_ip_modem(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
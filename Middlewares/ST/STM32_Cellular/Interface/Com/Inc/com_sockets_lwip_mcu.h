@@ -34,6 +34,7 @@ extern "C" {
 
 #include "com_common.h"
 #include "com_sockets_addr_compat.h"
+#include "com_sockets_net_compat.h"
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -228,6 +229,17 @@ int32_t com_recvfrom_lwip_mcu(int32_t sock,
                               int32_t flags,
                               com_sockaddr_t *from, int32_t *fromlen);
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until at least one of the sockets is ready for the requested events
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  fds       - array of socket descriptors with the requested events
+  * @param  nfds      - number of elements in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 on timeout) or error value
+  */
+int32_t com_poll_lwip_mcu(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
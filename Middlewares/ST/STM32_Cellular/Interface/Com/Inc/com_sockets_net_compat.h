@@ -93,12 +93,33 @@ extern "C" {
 #define COM_MSG_WAIT       0x00    /*!< Blocking     */
 #define COM_MSG_DONTWAIT   0x01    /*!< Non blocking */
 
+/* Events used with poll. */
+#define COM_POLLIN         0x01    /*!< Data can be read without blocking - requested/returned        */
+#define COM_POLLOUT        0x02    /*!< Data can be sent - requested/returned                         */
+#define COM_POLLERR        0x04    /*!< Error reported on the socket - always returned                */
+#define COM_POLLHUP        0x08    /*!< Closure received from remote - always returned                */
+#define COM_POLLNVAL       0x10    /*!< Socket handle unknown or not created - always returned        */
+
 /**
   * @}
   */
 
 /* Exported types ------------------------------------------------------------*/
-/* None */
+/** @addtogroup COM_SOCKETS_Types
+  * @{
+  */
+
+/* Socket descriptor used with poll */
+typedef struct
+{
+  int32_t fd;      /*!< socket handle obtained with com_socket - a negative value is ignored */
+  int16_t events;  /*!< requested events: COM_POLLIN and/or COM_POLLOUT                     */
+  int16_t revents; /*!< returned events                                                      */
+} com_pollfd_t;
+
+/**
+  * @}
+  */
 
 /* External variables --------------------------------------------------------*/
 /* None */
@@ -162,8 +183,15 @@ extern "C" {
 #define COM_MSG_WAIT       0x00
 #define COM_MSG_DONTWAIT   MSG_DONTWAIT
 
+/* Events used with poll. */
+#define COM_POLLIN         POLLIN
+#define COM_POLLOUT        POLLOUT
+#define COM_POLLERR        POLLERR
+#define COM_POLLHUP        POLLHUP
+#define COM_POLLNVAL       POLLNVAL
+
 /* Exported types ------------------------------------------------------------*/
-/* None */
+typedef struct pollfd com_pollfd_t;
 
 /* External variables --------------------------------------------------------*/
 /* None */
@@ -38,7 +38,7 @@ extern "C" {
   * @{
   */
 
-/* Internal usage only: use by com_sockets_ip_modem to update statistics */
+/* Internal usage only: use by com_sockets modules to update statistics */
 typedef enum
 {
   COM_SOCKET_STAT_CRE_OK = 0,
@@ -52,7 +52,9 @@ typedef enum
   COM_SOCKET_STAT_CLS_OK,
   COM_SOCKET_STAT_CLS_NOK,
   COM_SOCKET_STAT_NWK_UP,
-  COM_SOCKET_STAT_NWK_DWN
+  COM_SOCKET_STAT_NWK_DWN,
+  COM_SOCKET_STAT_DNS_HIT,
+  COM_SOCKET_STAT_DNS_MISS
 } com_sockets_stat_update_t;
 
 /**
@@ -837,8 +837,13 @@ bool com_icc_init(void)
   */
 void com_icc_start(void)
 {
+  dc_com_reg_id_t reg_id;
+
   /* Datacache registration for icc status */
-  (void)dc_com_core_register_gen_event_cb(&dc_com_db, com_icc_datacache_cb, (void *)NULL);
+  reg_id = dc_com_core_register_gen_event_cb(&dc_com_db, com_icc_datacache_cb, (void *)NULL);
+  /* Only sim and modem status are managed by com_icc_datacache_cb */
+  (void)dc_com_set_event_mask(&dc_com_db, reg_id,
+                              DC_COM_EVENT_MASK(DC_CELLULAR_SIM_INFO) | DC_COM_EVENT_MASK(DC_CELLULAR_INFO));
 }
 
 #endif /* USE_COM_ICC == 1 */
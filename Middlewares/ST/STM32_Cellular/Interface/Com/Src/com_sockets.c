@@ -34,14 +34,271 @@
 #include "com_sockets_statistic.h"
 #include "cellular_service_os.h"
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+#include <string.h>
+
+#include "rtosal.h"
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
+#include "lwip/err.h"
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_LWIP */
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Private defines -----------------------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/* Number of host names kept in the DNS cache */
+#if !defined COM_SOCKETS_DNS_CACHE_NB
+#define COM_SOCKETS_DNS_CACHE_NB            (4U)
+#endif /* !defined COM_SOCKETS_DNS_CACHE_NB */
+
+/* Time to live (in s) of a resolved host name
+   Neither the modem nor LwIP netconn provide the DNS record TTL: a fixed value is used */
+#if !defined COM_SOCKETS_DNS_CACHE_TTL
+#define COM_SOCKETS_DNS_CACHE_TTL           (3600U)
+#endif /* !defined COM_SOCKETS_DNS_CACHE_TTL */
+
+/* Time to live (in s) of a host name which could not be resolved - 0U: failures are not cached
+   Only COM_SOCKETS_DNS_CACHE_NEG_ERROR is cached, the other failures (no network, modem or stack error)
+   are transient and never answered from the cache */
+#if !defined COM_SOCKETS_DNS_CACHE_NEG_TTL
+#define COM_SOCKETS_DNS_CACHE_NEG_TTL       (30U)
+#endif /* !defined COM_SOCKETS_DNS_CACHE_NEG_TTL */
+
+/* Error of a genuine resolution failure: network up and host name without address */
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+#define COM_SOCKETS_DNS_CACHE_NEG_ERROR     COM_SOCKETS_ERR_NONAME
+#else /* USE_SOCKETS_TYPE == USE_SOCKETS_LWIP */
+#define COM_SOCKETS_DNS_CACHE_NEG_ERROR     ((int32_t)ERR_VAL) /* netconn_gethostbyname() error */
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
+/* Refresh-ahead (in s): a request done less than this time before the expiry of a resolved host name
+   resolves it again; if the new resolution fails the cached address is still used - 0U: no refresh-ahead */
+#if !defined COM_SOCKETS_DNS_CACHE_REFRESH
+#define COM_SOCKETS_DNS_CACHE_REFRESH       (0U)
+#endif /* !defined COM_SOCKETS_DNS_CACHE_REFRESH */
+
+#if (COM_SOCKETS_DNS_CACHE_REFRESH >= COM_SOCKETS_DNS_CACHE_TTL)
+#error COM_SOCKETS_DNS_CACHE_REFRESH must be lower than COM_SOCKETS_DNS_CACHE_TTL
+#endif /* COM_SOCKETS_DNS_CACHE_REFRESH >= COM_SOCKETS_DNS_CACHE_TTL */
+
+/* Maximum length of a host name kept in the cache - a longer host name is always resolved */
+#define COM_SOCKETS_DNS_CACHE_NAME_SIZE     (64U)
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 
 /* Private typedef -----------------------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+typedef char COM_SOCKETS_CHAR_t; /* used in string.h service call */
+
+/* DNS cache entry state */
+typedef enum
+{
+  COM_DNS_CACHE_FREE = 0,
+  COM_DNS_CACHE_RESOLVED,     /* addr is valid                        */
+  COM_DNS_CACHE_FAILED        /* resolution failed: error is returned */
+} com_dns_cache_state_t;
+
+/* DNS cache entry */
+typedef struct
+{
+  com_dns_cache_state_t state;
+  bool           refreshing;  /* a refresh-ahead resolution is on-going */
+  int32_t        error;       /* error returned when state is FAILED    */
+  uint32_t       timestamp;   /* time of the resolution (in ms)         */
+  uint32_t       ttl;         /* time to live (in ms)                   */
+  uint32_t       last_use;    /* time of the last use (in ms)           */
+  com_sockaddr_t addr;        /* host IP when state is RESOLVED         */
+  com_char_t     name[COM_SOCKETS_DNS_CACHE_NAME_SIZE + 1U];
+} com_dns_cache_entry_t;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/* DNS cache */
+static com_dns_cache_entry_t com_dns_cache[COM_SOCKETS_DNS_CACHE_NB];
+/* Mutex to protect access to com_dns_cache - never kept during a resolution */
+static osMutexId ComDnsCacheMutexHandle;
+/* Network status - the cache is flushed when the network goes down */
+static bool com_dns_cache_network_is_up;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/* Find the cache entry of a host name */
+static com_dns_cache_entry_t *com_dns_cache_find(const com_char_t *name);
+/* Answer a host name resolution from the cache */
+static bool com_dns_cache_lookup(const com_char_t *name, com_sockaddr_t *addr, int32_t *p_result);
+/* Store the result of a host name resolution in the cache */
+static int32_t com_dns_cache_update(const com_char_t *name, com_sockaddr_t *addr, int32_t result);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Private function Definition -----------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/**
+  * @brief  Find the cache entry of a host name
+  * @note   ComDnsCacheMutexHandle must be acquired by the caller
+  * @param  name - host name
+  * @retval com_dns_cache_entry_t* - cache entry or NULL if host name is not in the cache
+  */
+static com_dns_cache_entry_t *com_dns_cache_find(const com_char_t *name)
+{
+  com_dns_cache_entry_t *p_entry = NULL;
+
+  for (uint8_t i = 0U; (i < COM_SOCKETS_DNS_CACHE_NB) && (p_entry == NULL); i++)
+  {
+    if ((com_dns_cache[i].state != COM_DNS_CACHE_FREE)
+        && (strcmp((const COM_SOCKETS_CHAR_t *)&com_dns_cache[i].name[0], (const COM_SOCKETS_CHAR_t *)name) == 0))
+    {
+      p_entry = &com_dns_cache[i];
+    }
+  }
+
+  return (p_entry);
+}
+
+/**
+  * @brief  Answer a host name resolution from the cache
+  * @note   On refresh-ahead, the first request is not answered and must resolve the host name again
+  * @param  name     - host name
+  * @param  addr     - host IP corresponding to host name
+  * @param  p_result - resolution result when answered from the cache
+  * @retval bool     - false/true resolution must be done/answered from the cache
+  */
+static bool com_dns_cache_lookup(const com_char_t *name, com_sockaddr_t *addr, int32_t *p_result)
+{
+  bool result = false;
+  uint32_t now;
+  uint32_t age;
+  com_dns_cache_entry_t *p_entry;
+
+  if ((name != NULL) && (addr != NULL) && (strlen((const COM_SOCKETS_CHAR_t *)name) <= COM_SOCKETS_DNS_CACHE_NAME_SIZE))
+  {
+    (void)rtosalMutexAcquire(ComDnsCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+    now = rtosalGetSysTimerCount();
+    p_entry = com_dns_cache_find(name);
+    if (p_entry != NULL)
+    {
+      age = now - p_entry->timestamp;
+      if (age >= p_entry->ttl)
+      {
+        /* Expired */
+        p_entry->state = COM_DNS_CACHE_FREE;
+      }
+      else if (p_entry->state == COM_DNS_CACHE_FAILED)
+      {
+        *p_result = p_entry->error;
+        result = true;
+      }
+      else if ((COM_SOCKETS_DNS_CACHE_REFRESH != 0U) && (p_entry->refreshing == false)
+               && (age >= (p_entry->ttl - (COM_SOCKETS_DNS_CACHE_REFRESH * 1000U))))
+      {
+        /* Close to expiry: this request refreshes the entry, the other ones still use it */
+        p_entry->refreshing = true;
+      }
+      else
+      {
+        (void)memcpy((void *)addr, (const void *)&p_entry->addr, sizeof(com_sockaddr_t));
+        *p_result = COM_SOCKETS_ERR_OK;
+        result = true;
+      }
+      if (result == true)
+      {
+        p_entry->last_use = now;
+      }
+    }
+    (void)rtosalMutexRelease(ComDnsCacheMutexHandle);
+
+    com_sockets_statistic_update((result == true) ? COM_SOCKET_STAT_DNS_HIT : COM_SOCKET_STAT_DNS_MISS);
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  Store the result of a host name resolution in the cache
+  * @note   A free or expired entry is used first, else the least recently used one
+  *         A failed refresh-ahead keeps the cached address until its expiry
+  *         Only a genuine resolution failure (COM_SOCKETS_DNS_CACHE_NEG_ERROR with network up) is cached
+  * @param  name   - host name
+  * @param  addr   - host IP corresponding to host name
+  * @param  result - resolution result
+  * @retval int32_t - result to return to the application
+  */
+static int32_t com_dns_cache_update(const com_char_t *name, com_sockaddr_t *addr, int32_t result)
+{
+  int32_t ret = result;
+  uint32_t now;
+  uint32_t age;
+  uint32_t age_max = 0U;
+  com_dns_cache_entry_t *p_entry;
+
+  if ((name != NULL) && (addr != NULL) && (strlen((const COM_SOCKETS_CHAR_t *)name) <= COM_SOCKETS_DNS_CACHE_NAME_SIZE))
+  {
+    (void)rtosalMutexAcquire(ComDnsCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+    now = rtosalGetSysTimerCount();
+    p_entry = com_dns_cache_find(name);
+
+    if ((result != COM_SOCKETS_ERR_OK) && (p_entry != NULL) && (p_entry->state == COM_DNS_CACHE_RESOLVED)
+        && ((now - p_entry->timestamp) < p_entry->ttl))
+    {
+      /* Refresh-ahead failed: cached address still valid */
+      PRINT_INFO("DNS cache refresh NOK - cached address used")
+      p_entry->refreshing = false;
+      p_entry->last_use = now;
+      (void)memcpy((void *)addr, (const void *)&p_entry->addr, sizeof(com_sockaddr_t));
+      ret = COM_SOCKETS_ERR_OK;
+    }
+    else if ((result != COM_SOCKETS_ERR_OK)
+             && ((COM_SOCKETS_DNS_CACHE_NEG_TTL == 0U) || (result != COM_SOCKETS_DNS_CACHE_NEG_ERROR)
+                 || (com_dns_cache_network_is_up == false)))
+    {
+      /* Failure not cached: next request resolves the host name again */
+      if (p_entry != NULL)
+      {
+        p_entry->state = COM_DNS_CACHE_FREE;
+      }
+    }
+    else
+    {
+      if (p_entry == NULL)
+      {
+        /* Free or expired entry else least recently used one */
+        for (uint8_t i = 0U; i < COM_SOCKETS_DNS_CACHE_NB; i++)
+        {
+          age = ((com_dns_cache[i].state == COM_DNS_CACHE_FREE)
+                 || ((now - com_dns_cache[i].timestamp) >= com_dns_cache[i].ttl)) ?
+                0xFFFFFFFFU : (now - com_dns_cache[i].last_use);
+          if ((p_entry == NULL) || (age > age_max))
+          {
+            p_entry = &com_dns_cache[i];
+            age_max = age;
+          }
+        }
+      }
+      (void)strcpy((COM_SOCKETS_CHAR_t *)&p_entry->name[0], (const COM_SOCKETS_CHAR_t *)name);
+      p_entry->refreshing = false;
+      p_entry->timestamp  = now;
+      p_entry->last_use   = now;
+      if (result == COM_SOCKETS_ERR_OK)
+      {
+        p_entry->state = COM_DNS_CACHE_RESOLVED;
+        p_entry->error = COM_SOCKETS_ERR_OK;
+        p_entry->ttl   = COM_SOCKETS_DNS_CACHE_TTL * 1000U;
+        (void)memcpy((void *)&p_entry->addr, (const void *)addr, sizeof(com_sockaddr_t));
+      }
+      else
+      {
+        p_entry->state = COM_DNS_CACHE_FAILED;
+        p_entry->error = result;
+        p_entry->ttl   = COM_SOCKETS_DNS_CACHE_NEG_TTL * 1000U;
+      }
+    }
+    (void)rtosalMutexRelease(ComDnsCacheMutexHandle);
+  }
+
+  return (ret);
+}
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 
 
 /* Functions Definition ------------------------------------------------------*/
@@ -317,6 +574,28 @@ int32_t com_recvfrom(int32_t sock,
 }
 
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until at least one of the sockets is ready for the requested events
+  * @param  fds       - array of socket descriptors with the requested events
+  * @param  nfds      - number of elements in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 on timeout) or error value
+  */
+int32_t com_poll(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  result = com_poll_ip_modem(fds, nfds, timeout);
+#else
+  result = com_poll_lwip_mcu(fds, nfds, timeout);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
+  return (result);
+}
+
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
@@ -342,6 +621,7 @@ int32_t com_closesocket(int32_t sock)
 /**
   * @brief  Get host IP from host name
   * @note   Retrieve host IP address from host name
+  *         If COM_SOCKETS_DNS_CACHE == 1U, the result is answered from the DNS cache when possible
   * @param  name      - host name
   * @param  addr      - host IP corresponding to host name
   * @retval int32_t   - ok or error value
@@ -351,11 +631,20 @@ int32_t com_gethostbyname(const com_char_t *name,
 {
   int32_t result;
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+  /* No access to the modem or to the network if the host name is in the cache */
+  if (com_dns_cache_lookup(name, addr, &result) == false)
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+  {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-  result = com_gethostbyname_ip_modem(name, addr);
+    result = com_gethostbyname_ip_modem(name, addr);
 #else
-  result = com_gethostbyname_lwip_mcu(name, addr);
+    result = com_gethostbyname_lwip_mcu(name, addr);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+    result = com_dns_cache_update(name, addr, result);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+  }
 
   return (result);
 }
@@ -502,6 +791,16 @@ bool com_sockets_init(void)
 
   com_sockets_statistic_init();
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+  (void)memset((void *)&com_dns_cache[0], 0, sizeof(com_dns_cache));
+  com_dns_cache_network_is_up = false; /* Network status update see com_sockets_dns_cache_network_status() */
+  ComDnsCacheMutexHandle = rtosalMutexNew((const rtosal_char_t *)"COMSOCK_MUT_DNS_CACHE");
+  if (ComDnsCacheMutexHandle == NULL)
+  {
+    result = false;
+  }
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
   return (result);
 }
 
@@ -525,4 +824,26 @@ void com_sockets_start(void)
   /* no com_sockets_statistic_start(); */
 }
 
+
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/**
+  * @brief  DNS cache network status update
+  * @note   Called by the network status callback of com_sockets_ip_modem / com_sockets_lwip_mcu
+  *         Network down: the cached addresses may be wrong on the next PDN, the cache is flushed
+  * @param  is_up     - true/false network up/down
+  * @retval -
+  */
+void com_sockets_dns_cache_network_status(bool is_up)
+{
+  (void)rtosalMutexAcquire(ComDnsCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+  if ((is_up == false) && (com_dns_cache_network_is_up == true))
+  {
+    (void)memset((void *)&com_dns_cache[0], 0, sizeof(com_dns_cache));
+    PRINT_INFO("DNS cache flushed - network down")
+  }
+  com_dns_cache_network_is_up = is_up;
+  (void)rtosalMutexRelease(ComDnsCacheMutexHandle);
+}
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 #endif /* USE_COM_SOCKETS == 1 */
@@ -25,6 +25,7 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <stdbool.h>
 
@@ -43,10 +44,16 @@
 #include "dc_common.h"
 #include "cellular_service_datacache.h"
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+#include "com_sockets.h" /* DNS cache network status update */
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 #if (UDP_SERVICE_SUPPORTED == 1U)
 #include "rng.h" /* Random functions used for local port */
 #endif /* UDP_SERVICE_SUPPORTED == 1U */
 
+#include "error_handler.h"
+
 /* Private defines -----------------------------------------------------------*/
 
 /* Maximum data that can be passed between COM and low level */
@@ -70,10 +77,12 @@ typedef char CSIP_CHAR_t; /* used in stdio.h and string.h service call */
 typedef uint16_t com_socket_msg_type_t;
 #define COM_SOCKET_MSG        (com_socket_msg_type_t)1    /* MSG is SOCKET type       */
 #define COM_PING_MSG          (com_socket_msg_type_t)2    /* MSG is PING type         */
+#define COM_POLL_MSG          (com_socket_msg_type_t)3    /* MSG is POLL type         */
 
 typedef uint16_t com_socket_msg_id_t;
 #define COM_DATA_RCV          (com_socket_msg_id_t)1      /* MSG id is DATA_RCV       */
 #define COM_CLOSING_RCV       (com_socket_msg_id_t)2      /* MSG id is CLOSING_RCV    */
+#define COM_DATA_SND          (com_socket_msg_id_t)3      /* MSG id is DATA_SND       */
 
 /* Message Description :
 socket_msg_t
@@ -102,6 +111,7 @@ typedef struct _socket_desc_t
   bool                  local;       /*   internal id - e.g for ping
                                        or external id - e.g modem    */
   bool                  closing;     /* close recv from remote  */
+  bool                  rcv_ready;   /* data ready URC not read */
   uint8_t               type;        /* Socket Type TCP/UDP/RAW */
   int32_t               error;       /* last command status     */
   int32_t               id;          /* identifier              */
@@ -117,6 +127,37 @@ typedef struct _socket_desc_t
   struct _socket_desc_t *p_next;     /* chained list            */
 } socket_desc_t;
 
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+/* Receive cache of a TCP socket - array index = modem socket id */
+typedef struct
+{
+  bool     active;          /* cache used by a connected TCP socket                 */
+  bool     data_pending;    /* modem may still have data to read for this socket    */
+  bool     fetch_requested; /* a fetch request is in the receive cache queue        */
+  bool     error;           /* last read from the modem is in error                 */
+  uint32_t generation;      /* incremented at each reset: an on-going fetch is lost */
+  uint32_t rd_idx;          /* read index in buffer                                 */
+  uint32_t wr_idx;          /* write index in buffer                                */
+  uint32_t count;           /* number of bytes available in buffer                  */
+  uint8_t  buffer[COM_SOCKETS_RCV_CACHE_SIZE];
+} com_rcv_cache_t;
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+/* Transmit queue of a TCP socket - array index = modem socket id */
+typedef struct
+{
+  bool     active;          /* queue used by a connected TCP socket                */
+  bool     drain_requested; /* a drain request is in the transmit queue thread queue */
+  int32_t  error;           /* last send to the modem status - reported only one time */
+  uint32_t generation;      /* incremented at each reset: an on-going send is lost  */
+  uint32_t rd_idx;          /* read index in buffer                                 */
+  uint32_t wr_idx;          /* write index in buffer                                */
+  uint32_t count;           /* number of bytes waiting to be sent in buffer         */
+  uint8_t  buffer[COM_SOCKETS_SND_QUEUE_SIZE];
+} com_snd_queue_t;
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+
 typedef struct
 {
   CS_IPaddrType_t ip_type; /* possible values: IPv4 or IPv6 - only IPv4 supported */
@@ -168,6 +209,11 @@ static int32_t ping_socket_id; /* Ping socket id */
 /* Network status is managed through Datacache */
 static bool com_sockets_network_is_up;
 
+/* Queue to wake up the application waiting in com_poll */
+static osMessageQId ComPollQueueHandle;
+/* Application waiting in com_poll - only one at a time */
+static bool com_poll_in_progress;
+
 #if (USE_LOW_POWER == 1)
 /* Timer to check inactivity on socket and maybe to go in data idle mode */
 static osTimerId ComTimerInactivityId;
@@ -184,6 +230,32 @@ static osMutexId ComTimerInactivityMutexHandle;
 static uint16_t com_local_port; /* a value in range [COM_LOCAL_PORT_BEGIN, COM_LOCAL_PORT_BEGIN] */
 #endif /* UDP_SERVICE_SUPPORTED == 1U */
 
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+/* Receive cache of each TCP socket */
+static com_rcv_cache_t com_rcv_cache[CELLULAR_MAX_SOCKETS];
+/* Mutex to protect access to com_rcv_cache - never kept during a modem access */
+static osMutexId ComRcvCacheMutexHandle;
+/* Fetch requests for the receive cache thread: msg = socket id + 1U */
+static osMessageQId ComRcvCacheQueueHandle;
+/* Thread reading the modem data in the receive cache */
+static osThreadId ComRcvCacheThreadId;
+/* Read buffer of the receive cache thread - used when the free part of a cache wraps at its end */
+static uint8_t com_rcv_cache_chunk[COM_MODEM_MAX_RX_DATA_SIZE];
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+/* Transmit queue of each TCP socket */
+static com_snd_queue_t com_snd_queue[CELLULAR_MAX_SOCKETS];
+/* Mutex to protect access to com_snd_queue - never kept during a modem access */
+static osMutexId ComSndQueueMutexHandle;
+/* Drain requests for the transmit queue thread: msg = socket id + 1U */
+static osMessageQId ComSndQueueQueueHandle;
+/* Thread sending the queued data to the modem */
+static osThreadId ComSndQueueThreadId;
+/* Send buffer of the transmit queue thread - used when the queued data wrap at the end of a queue */
+static uint8_t com_snd_queue_chunk[COM_MODEM_MAX_TX_DATA_SIZE];
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+
 /* Global variables ----------------------------------------------------------*/
 
 /* Private function prototypes -----------------------------------------------*/
@@ -220,6 +292,62 @@ static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local);
 
 /* Empty queue from all messages */
 static void com_ip_modem_empty_queue(osMessageQId queue);
+/* Read the next data of a TCP socket in the application buffer */
+static int32_t com_ip_modem_recv_next(int32_t sock, com_char_t *p_buf, uint32_t len, int32_t len_rcv,
+                                      bool *p_rcv_full);
+
+/* Wake up the application waiting in com_poll */
+static void com_ip_modem_poll_notify(void);
+/* Compute the events of a socket descriptor used with com_poll */
+static int16_t com_ip_modem_poll_revents(const com_pollfd_t *p_fd);
+
+/*** BEGIN Receive cache functions ***/
+/* Reset the receive cache of a socket */
+static void com_ip_modem_rcv_cache_reset(int32_t sock, bool active);
+/* Notify the receive cache that data may be available in the modem */
+static bool com_ip_modem_rcv_cache_notify(int32_t sock);
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+/* Post a fetch request to the receive cache thread */
+static void com_ip_modem_rcv_cache_request_fetch(int32_t sock);
+/* Read data from the receive cache */
+static int32_t com_ip_modem_rcv_cache_read(int32_t sock, com_char_t *p_buf, uint32_t len);
+/* Is remote closure received and all data read */
+static bool com_ip_modem_rcv_cache_is_closed(const socket_desc_t *p_socket_desc);
+/* Is a receive possible without waiting */
+static bool com_ip_modem_rcv_cache_is_readable(const socket_desc_t *p_socket_desc);
+/* Read the modem data of a socket in its receive cache */
+static void com_ip_modem_rcv_cache_fetch(int32_t sock);
+/* Receive cache thread body */
+static void com_ip_modem_rcv_cache_thread(void *p_argument);
+/* Receive data of a TCP socket from its receive cache */
+static int32_t com_ip_modem_rcv_cache_recv(socket_desc_t *p_socket_desc, com_char_t *p_buf, uint32_t len,
+                                           int32_t flags, int32_t *p_len_rcv);
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+/*** END Receive cache functions ***/
+
+/*** BEGIN Transmit queue functions ***/
+/* Reset the transmit queue of a socket */
+static void com_ip_modem_snd_queue_reset(int32_t sock, bool active);
+/* Wait the transmit queue of a socket is sent to the modem before to close it */
+static void com_ip_modem_snd_queue_flush(socket_desc_t *p_socket_desc);
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+/* Post a drain request to the transmit queue thread */
+static void com_ip_modem_snd_queue_request_drain(int32_t sock);
+/* Copy data in the transmit queue */
+static int32_t com_ip_modem_snd_queue_write(int32_t sock, const com_char_t *p_buf, uint32_t len, bool report_error);
+/* Wait until the transmit queue holds at most a number of bytes */
+static bool com_ip_modem_snd_queue_wait(socket_desc_t *p_socket_desc, uint32_t max_count);
+/* Is a send possible without waiting */
+static bool com_ip_modem_snd_queue_is_writable(const socket_desc_t *p_socket_desc);
+/* Send the transmit queue of a socket to the modem */
+static void com_ip_modem_snd_queue_drain(int32_t sock);
+/* Transmit queue thread body */
+static void com_ip_modem_snd_queue_thread(void *p_argument);
+/* Send data of a TCP socket through its transmit queue */
+static int32_t com_ip_modem_snd_queue_send(socket_desc_t *p_socket_desc, const com_char_t *p_buf, uint32_t len,
+                                           int32_t flags);
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+/*** END Transmit queue functions ***/
 
 /*** BEGIN Conversion IP address functions ***/
 static bool com_translate_ip_address(const com_sockaddr_t *p_addr, int32_t addrlen, socket_addr_t *p_socket_addr);
@@ -263,6 +391,7 @@ static void com_ip_modem_init_socket_desc(socket_desc_t *p_socket_desc)
   p_socket_desc->state            = COM_SOCKET_INVALID;
   p_socket_desc->local            = false;
   p_socket_desc->closing          = false;
+  p_socket_desc->rcv_ready        = false;
   p_socket_desc->id               = COM_SOCKET_INVALID_ID;
   p_socket_desc->local_port       = 0U;
   p_socket_desc->remote_port      = 0U;
@@ -439,6 +568,12 @@ static void com_ip_modem_delete_socket_desc(int32_t sock, bool local)
   }
   if (found == true)
   {
+    if (local == false)
+    {
+      /* Data not read by the application and data not sent to the modem are lost */
+      com_ip_modem_rcv_cache_reset(sock, false);
+      com_ip_modem_snd_queue_reset(sock, false);
+    }
     /* Always keep a created socket */
     com_ip_modem_init_socket_desc(p_socket_desc);
     if (local == true)
@@ -482,36 +617,940 @@ static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local)
       }
     }
   }
-  else
+  else
+  {
+    p_socket_desc = NULL;
+  }
+
+  /* If found == false then p_socket_desc = NULL */
+  return (p_socket_desc);
+}
+
+/**
+  * @brief  Empty queue from potential messages
+  * @param  queue - queue to empty
+  * @retval -
+  */
+static void com_ip_modem_empty_queue(osMessageQId queue)
+{
+  com_socket_msg_t msg_queue;
+
+  do
+  {
+    msg_queue = 0U; /* if msg_queue = 0U after MessageQueueGet() then the queue is empty */
+    /* Read the queue to suppress the msg from it */
+    (void)rtosalMessageQueueGet(queue, &msg_queue, 0U); /* timeout = 0U */
+    if (msg_queue != 0U)
+    {
+      /* Message available in the queue */
+      PRINT_DBG("rcv cleanup MSGqueue")
+    }
+  } while (msg_queue != 0U);
+}
+
+/**
+  * @brief  Read the next data of a TCP socket in the application buffer
+  * @note   Called when the previous read filled the interface capacity: the modem may still have data
+  *         Reads of the interface capacity are done without waiting
+  *         until the application buffer is full or the modem has no more data
+  * @note   An error at low level stops the reads but the data already received are kept
+  * @param  sock       - modem socket id
+  * @param  p_buf      - pointer to application data buffer
+  * @param  len        - size of application data buffer (in bytes)
+  * @param  len_rcv    - number of bytes already received in application data buffer
+  * @param  p_rcv_full - true: last read filled the requested length (modem may still have data) / false: otherwise
+  * @retval int32_t    - number of bytes received in application data buffer
+  */
+static int32_t com_ip_modem_recv_next(int32_t sock, com_char_t *p_buf, uint32_t len, int32_t len_rcv,
+                                      bool *p_rcv_full)
+{
+  int32_t result = len_rcv;
+  int32_t len_next;
+  uint32_t length_to_read;
+
+  while ((*p_rcv_full == true) && ((uint32_t)result < len))
+  {
+    length_to_read = COM_MIN((len - (uint32_t)result), COM_MODEM_MAX_RX_DATA_SIZE);
+    len_next = osCDS_socket_receive(sock, &p_buf[result], length_to_read);
+    if (len_next > 0)
+    {
+      result += len_next;
+    }
+    else if (len_next < 0)
+    {
+      PRINT_ERR("rcv data next NOK at low level")
+    }
+    else
+    {
+      /* No more data in the modem */
+    }
+    *p_rcv_full = (len_next == (int32_t)length_to_read);
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  Wake up the application waiting in com_poll
+  * @note   Called on each socket event (data received, closing, ...)
+  * @param  -
+  * @retval -
+  */
+static void com_ip_modem_poll_notify(void)
+{
+  com_socket_msg_t msg_queue = 0U;
+
+  if (com_poll_in_progress == true)
+  {
+    SET_SOCKET_MSG_TYPE(msg_queue, COM_POLL_MSG);
+    SET_SOCKET_MSG_ID(msg_queue, COM_DATA_RCV);
+    /* If the queue is full a wake up is already pending - no need to put another message */
+    (void)rtosalMessageQueuePut(ComPollQueueHandle, msg_queue, 0U);
+  }
+}
+
+/**
+  * @brief  Compute the events of a socket descriptor used with com_poll
+  * @param  p_fd    - socket descriptor with the requested events
+  * @retval int16_t - returned events
+  */
+static int16_t com_ip_modem_poll_revents(const com_pollfd_t *p_fd)
+{
+  int16_t revents = 0;
+  bool readable;
+  bool writable;
+  socket_desc_t *p_socket_desc;
+
+  p_socket_desc = com_ip_modem_find_socket(p_fd->fd, false);
+
+  if ((p_socket_desc == NULL) || (p_socket_desc->state < COM_SOCKET_CREATED))
+  {
+    revents = (int16_t)COM_POLLNVAL;
+  }
+  else
+  {
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+    if (p_socket_desc->type == (uint8_t)COM_SOCK_STREAM)
+    {
+      readable = com_ip_modem_rcv_cache_is_readable(p_socket_desc);
+    }
+    else
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+    {
+      readable = (p_socket_desc->rcv_ready == true) || (p_socket_desc->closing == true);
+    }
+    if (((p_fd->events & COM_POLLIN) != 0) && (readable == true))
+    {
+      revents |= (int16_t)COM_POLLIN;
+    }
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+    if (p_socket_desc->type == (uint8_t)COM_SOCK_STREAM)
+    {
+      /* Send is asynchronous: a connected TCP socket can send when its transmit queue is not full */
+      writable = (p_socket_desc->state >= COM_SOCKET_CONNECTED)
+                 && (com_ip_modem_snd_queue_is_writable(p_socket_desc) == true);
+    }
+    else
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+    {
+      /* Send is synchronous: a connected socket (or an UDP one) can always send */
+      writable = (p_socket_desc->state >= COM_SOCKET_CONNECTED) || (p_socket_desc->type == (uint8_t)COM_SOCK_DGRAM);
+    }
+    if (((p_fd->events & COM_POLLOUT) != 0) && (p_socket_desc->closing == false) && (writable == true))
+    {
+      revents |= (int16_t)COM_POLLOUT;
+    }
+    if (p_socket_desc->closing == true)
+    {
+      revents |= (int16_t)COM_POLLHUP;
+    }
+  }
+
+  return (revents);
+}
+
+/**
+  * @brief  Reset the receive cache of a socket
+  * @note   Data still in the cache are lost and an on-going fetch is ignored
+  * @param  sock   - modem socket id
+  * @param  active - false/true cache not used/used by the socket after the reset
+  * @retval -
+  */
+static void com_ip_modem_rcv_cache_reset(int32_t sock, bool active)
+{
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+  if ((sock >= 0) && ((uint32_t)sock < CELLULAR_MAX_SOCKETS))
+  {
+    com_rcv_cache_t *p_cache = &com_rcv_cache[sock];
+
+    (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+    p_cache->active       = active;
+    p_cache->data_pending = false;
+    p_cache->error        = false;
+    p_cache->generation++;
+    p_cache->rd_idx       = 0U;
+    p_cache->wr_idx       = 0U;
+    p_cache->count        = 0U;
+    /* p_cache->fetch_requested is not reset - it is cleared when the request is read from the queue */
+    (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+  }
+#else /* COM_SOCKETS_RCV_CACHE == 0U */
+  UNUSED(sock);
+  UNUSED(active);
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+}
+
+/**
+  * @brief  Notify the receive cache that data may be available in the modem
+  * @note   Called by URC callbacks: no modem access, a fetch is requested to the receive cache thread
+  * @param  sock - modem socket id
+  * @retval bool - false/true socket not managed/managed by the receive cache
+  */
+static bool com_ip_modem_rcv_cache_notify(int32_t sock)
+{
+  bool result = false;
+
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+  if ((sock >= 0) && ((uint32_t)sock < CELLULAR_MAX_SOCKETS))
+  {
+    (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+    if (com_rcv_cache[sock].active == true)
+    {
+      com_rcv_cache[sock].data_pending = true;
+      com_ip_modem_rcv_cache_request_fetch(sock);
+      result = true;
+    }
+    (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+  }
+#else /* COM_SOCKETS_RCV_CACHE == 0U */
+  UNUSED(sock);
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+  return (result);
+}
+
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+/**
+  * @brief  Post a fetch request to the receive cache thread
+  * @note   ComRcvCacheMutexHandle must be acquired by the caller
+  *         At most one request per socket is in the queue
+  * @param  sock - modem socket id
+  * @retval -
+  */
+static void com_ip_modem_rcv_cache_request_fetch(int32_t sock)
+{
+  if (com_rcv_cache[sock].fetch_requested == false)
+  {
+    if (rtosalMessageQueuePut(ComRcvCacheQueueHandle, (uint32_t)sock + 1U, 0U) == osOK)
+    {
+      com_rcv_cache[sock].fetch_requested = true;
+    }
+    else
+    {
+      PRINT_ERR("rcv cache socket %ld fetch request NOK", sock)
+    }
+  }
+}
+
+/**
+  * @brief  Read data from the receive cache
+  * @note   When the cache goes under the high-water mark and data are still in the modem
+  *         a new fetch is requested
+  * @param  sock  - modem socket id
+  * @param  p_buf - buffer to store the data
+  * @param  len   - size of p_buf (in bytes)
+  * @retval int32_t - number of bytes read or -1 if last read from the modem is in error
+  */
+static int32_t com_ip_modem_rcv_cache_read(int32_t sock, com_char_t *p_buf, uint32_t len)
+{
+  int32_t result;
+  uint32_t length;
+  uint32_t length_first;
+  com_rcv_cache_t *p_cache = &com_rcv_cache[sock];
+
+  (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  length = COM_MIN(len, p_cache->count);
+  if (length > 0U)
+  {
+    /* Data may be split at the end of the buffer */
+    length_first = COM_MIN(length, (COM_SOCKETS_RCV_CACHE_SIZE - p_cache->rd_idx));
+    (void)memcpy((void *)p_buf, (const void *)&p_cache->buffer[p_cache->rd_idx], length_first);
+    if (length_first < length)
+    {
+      (void)memcpy((void *)&p_buf[length_first], (const void *)&p_cache->buffer[0], (length - length_first));
+    }
+    p_cache->rd_idx = (p_cache->rd_idx + length) % COM_SOCKETS_RCV_CACHE_SIZE;
+    p_cache->count -= length;
+    result = (int32_t)length;
+  }
+  else if (p_cache->error == true)
+  {
+    /* Error is reported only one time */
+    p_cache->error = false;
+    result = -1;
+  }
+  else
+  {
+    result = 0;
+  }
+
+  /* Restart fetch stopped by the high-water mark */
+  if ((p_cache->data_pending == true) && (p_cache->count < COM_SOCKETS_RCV_CACHE_HIGH_WATER))
+  {
+    com_ip_modem_rcv_cache_request_fetch(sock);
+  }
+
+  (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+
+  return (result);
+}
+
+/**
+  * @brief  Is remote closure received and all data read
+  * @param  p_socket_desc - socket descriptor
+  * @retval bool - false/true data can still be received/socket closed by remote and cache empty
+  */
+static bool com_ip_modem_rcv_cache_is_closed(const socket_desc_t *p_socket_desc)
+{
+  bool result = false;
+  const com_rcv_cache_t *p_cache = &com_rcv_cache[p_socket_desc->id];
+
+  if (p_socket_desc->closing == true)
+  {
+    (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+    if ((p_cache->count == 0U) && (p_cache->data_pending == false) && (p_cache->fetch_requested == false))
+    {
+      result = true;
+    }
+    (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  Is a receive possible without waiting
+  * @param  p_socket_desc - socket descriptor
+  * @retval bool - false/true receive will wait/will not wait (data, error or closure to report)
+  */
+static bool com_ip_modem_rcv_cache_is_readable(const socket_desc_t *p_socket_desc)
+{
+  bool result;
+  const com_rcv_cache_t *p_cache = &com_rcv_cache[p_socket_desc->id];
+
+  (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+  result = (p_cache->count > 0U) || (p_cache->error == true);
+  (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+
+  return ((result == true) || (com_ip_modem_rcv_cache_is_closed(p_socket_desc) == true));
+}
+
+/**
+  * @brief  Read the modem data of a socket in its receive cache
+  * @note   Modem is read directly in the free part of the cache until no more data
+  *         or until the high-water mark is reached
+  *         ComRcvCacheMutexHandle is not kept during the modem access
+  * @param  sock - modem socket id
+  * @retval -
+  */
+static void com_ip_modem_rcv_cache_fetch(int32_t sock)
+{
+  bool fetch;
+  bool notify = false;
+  uint32_t generation = 0U;
+  uint32_t wr_idx = 0U;
+  uint32_t length = 0U;
+  uint32_t length_first = 0U;
+  int32_t len_rcv;
+  com_socket_msg_t msg_queue = 0U;
+  socket_desc_t *p_socket_desc;
+  com_rcv_cache_t *p_cache = &com_rcv_cache[sock];
+
+  (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+  /* Request is read: a new notification must post a new request */
+  p_cache->fetch_requested = false;
+  fetch = p_cache->active;
+  if (fetch == true)
+  {
+    /* Even if the read done before the notification found no data, data are now expected */
+    p_cache->data_pending = true;
+  }
+  (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+
+  if (fetch == true)
+  {
+    com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
+
+    while (fetch == true)
+    {
+      (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+      if ((p_cache->active == true) && (p_cache->data_pending == true)
+          && (p_cache->count < COM_SOCKETS_RCV_CACHE_HIGH_WATER))
+      {
+        generation = p_cache->generation;
+        wr_idx = p_cache->wr_idx;
+        /* Free part of the buffer - cache is not full because count < high-water mark */
+        length = COM_MIN((COM_SOCKETS_RCV_CACHE_SIZE - p_cache->count), COM_MODEM_MAX_RX_DATA_SIZE);
+        /* Contiguous free part of the buffer */
+        length_first = COM_MIN(length, (COM_SOCKETS_RCV_CACHE_SIZE - wr_idx));
+      }
+      else
+      {
+        fetch = false;
+      }
+      (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+
+      if (fetch == true)
+      {
+        if (length_first == length)
+        {
+          len_rcv = osCDS_socket_receive(sock, (CS_CHAR_t *)&p_cache->buffer[wr_idx], length);
+        }
+        else
+        {
+          /* Free part wraps at the end of the buffer: one modem read of the full length, then split */
+          len_rcv = osCDS_socket_receive(sock, (CS_CHAR_t *)&com_rcv_cache_chunk[0], length);
+        }
+
+        (void)rtosalMutexAcquire(ComRcvCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+        if (generation != p_cache->generation)
+        {
+          /* Socket closed during the modem access: data are ignored */
+          fetch = false;
+        }
+        else if (len_rcv > 0)
+        {
+          if (length_first != length)
+          {
+            /* Split the data in the free part of the buffer */
+            (void)memcpy((void *)&p_cache->buffer[wr_idx], (const void *)&com_rcv_cache_chunk[0],
+                         COM_MIN((uint32_t)len_rcv, length_first));
+            if ((uint32_t)len_rcv > length_first)
+            {
+              (void)memcpy((void *)&p_cache->buffer[0], (const void *)&com_rcv_cache_chunk[length_first],
+                           ((uint32_t)len_rcv - length_first));
+            }
+          }
+          p_cache->wr_idx = (wr_idx + (uint32_t)len_rcv) % COM_SOCKETS_RCV_CACHE_SIZE;
+          p_cache->count += (uint32_t)len_rcv;
+          notify = true;
+        }
+        else
+        {
+          /* No more data in the modem or error */
+          p_cache->data_pending = false;
+          if (len_rcv < 0)
+          {
+            p_cache->error = true;
+            notify = true;
+            PRINT_ERR("rcv cache socket %ld fetch NOK at low level", sock)
+          }
+          fetch = false;
+        }
+        (void)rtosalMutexRelease(ComRcvCacheMutexHandle);
+      }
+    }
+
+    com_ip_modem_idlemode_request(false);
+
+    /* Wake up the application waiting for data or for the closure */
+    if (notify == true)
+    {
+      com_ip_modem_poll_notify();
+    }
+    p_socket_desc = com_ip_modem_find_socket(sock, false);
+    if ((p_socket_desc != NULL) && (p_socket_desc->state == COM_SOCKET_WAITING)
+        && ((notify == true) || (p_socket_desc->closing == true)))
+    {
+      SET_SOCKET_MSG_TYPE(msg_queue, COM_SOCKET_MSG);
+      SET_SOCKET_MSG_ID(msg_queue, COM_DATA_RCV);
+      PRINT_DBG("rcv cache socket %ld MSGput %lu queue %p", sock, msg_queue, p_socket_desc->queue)
+      (void)rtosalMessageQueuePut(p_socket_desc->queue, msg_queue, 0U);
+    }
+  }
+}
+
+/**
+  * @brief  Receive cache thread body
+  * @note   Read the modem data of the sockets on fetch request
+  * @param  p_argument - unused
+  * @retval -
+  */
+static void com_ip_modem_rcv_cache_thread(void *p_argument)
+{
+  uint32_t msg_queue;
+
+  UNUSED(p_argument);
+
+  for (;;)
+  {
+    msg_queue = 0U;
+    (void)rtosalMessageQueueGet(ComRcvCacheQueueHandle, &msg_queue, RTOSAL_WAIT_FOREVER);
+    if ((msg_queue != 0U) && (msg_queue <= CELLULAR_MAX_SOCKETS))
+    {
+      com_ip_modem_rcv_cache_fetch((int32_t)msg_queue - 1);
+    }
+  }
+}
+
+/**
+  * @brief  Receive data of a TCP socket from its receive cache
+  * @note   No modem access: data are read from the modem by the receive cache thread
+  * @param  p_socket_desc - socket descriptor
+  * @param  p_buf         - buffer to store the data
+  * @param  len           - size of p_buf (in bytes)
+  * @param  flags         - COM_MSG_DONTWAIT or COM_MSG_WAIT
+  * @param  p_len_rcv     - number of bytes received
+  * @retval int32_t       - ok or error value
+  */
+static int32_t com_ip_modem_rcv_cache_recv(socket_desc_t *p_socket_desc, com_char_t *p_buf, uint32_t len,
+                                           int32_t flags, int32_t *p_len_rcv)
+{
+  int32_t result = COM_SOCKETS_ERR_OK;
+  int32_t len_rcv;
+  com_socket_msg_t msg_queue;
+  rtosalStatus status_queue;
+
+  /* Empty the queue from possible messages */
+  com_ip_modem_empty_queue(p_socket_desc->queue);
+  /* State must be WAITING before to read the cache to be notified of the data fetched after the read */
+  p_socket_desc->state = COM_SOCKET_WAITING;
+
+  len_rcv = com_ip_modem_rcv_cache_read(p_socket_desc->id, p_buf, len);
+
+  if ((len_rcv == 0) && (flags != COM_MSG_DONTWAIT) && (com_ip_modem_rcv_cache_is_closed(p_socket_desc) == false))
+  {
+    /* Waiting for Distant response or Closure Socket or Timeout */
+    msg_queue = 0U;
+    status_queue = rtosalMessageQueueGet(p_socket_desc->queue, &msg_queue, p_socket_desc->rcv_timeout);
+    if ((status_queue == osEventTimeout) || (status_queue == osErrorTimeoutResource))
+    {
+      result = COM_SOCKETS_ERR_TIMEOUT;
+      PRINT_INFO("rcv data exit timeout")
+    }
+    else
+    {
+      /* Data fetched, error or closure: answer is in the cache */
+      len_rcv = com_ip_modem_rcv_cache_read(p_socket_desc->id, p_buf, len);
+    }
+  }
+
+  if (len_rcv < 0)
+  {
+    len_rcv = 0;
+    result = COM_SOCKETS_ERR_GENERAL;
+    PRINT_ERR("rcv data exit err low level")
+  }
+  else if ((len_rcv == 0) && (result == COM_SOCKETS_ERR_OK)
+           && (com_ip_modem_rcv_cache_is_closed(p_socket_desc) == true))
+  {
+    result = COM_SOCKETS_ERR_CLOSING;
+    PRINT_INFO("rcv data exit socket closing")
+  }
+  else
+  {
+    PRINT_DBG("rcv data exit with %ld bytes", len_rcv)
+  }
+
+  p_socket_desc->state = COM_SOCKET_CONNECTED;
+  /* Empty the queue from possible messages */
+  com_ip_modem_empty_queue(p_socket_desc->queue);
+
+  *p_len_rcv = len_rcv;
+
+  return (result);
+}
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+/**
+  * @brief  Reset the transmit queue of a socket
+  * @note   Data still in the queue are lost and an on-going send is ignored
+  * @param  sock   - modem socket id
+  * @param  active - false/true queue not used/used by the socket after the reset
+  * @retval -
+  */
+static void com_ip_modem_snd_queue_reset(int32_t sock, bool active)
+{
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+  if ((sock >= 0) && ((uint32_t)sock < CELLULAR_MAX_SOCKETS))
+  {
+    com_snd_queue_t *p_queue = &com_snd_queue[sock];
+
+    (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+    p_queue->active = active;
+    p_queue->error  = COM_SOCKETS_ERR_OK;
+    p_queue->generation++;
+    p_queue->rd_idx = 0U;
+    p_queue->wr_idx = 0U;
+    p_queue->count  = 0U;
+    /* p_queue->drain_requested is not reset - it is cleared when the request is read from the queue */
+    (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+  }
+#else /* COM_SOCKETS_SND_QUEUE == 0U */
+  UNUSED(sock);
+  UNUSED(active);
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+}
+
+/**
+  * @brief  Wait the transmit queue of a socket is sent to the modem before to close it
+  * @note   Wait is limited by the socket send timeout: data still in the queue are then lost
+  * @param  p_socket_desc - socket descriptor
+  * @retval -
+  */
+static void com_ip_modem_snd_queue_flush(socket_desc_t *p_socket_desc)
+{
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+  com_socket_state_t state;
+
+  if ((p_socket_desc->type == (uint8_t)COM_SOCK_STREAM) && (p_socket_desc->state >= COM_SOCKET_CONNECTED))
+  {
+    /* State SENDING to be woken up by the transmit queue thread */
+    state = p_socket_desc->state;
+    p_socket_desc->state = COM_SOCKET_SENDING;
+    if (com_ip_modem_snd_queue_wait(p_socket_desc, 0U) == false)
+    {
+      PRINT_INFO("close socket %ld: data not sent are lost", p_socket_desc->id)
+    }
+    p_socket_desc->state = state;
+  }
+#else /* COM_SOCKETS_SND_QUEUE == 0U */
+  UNUSED(p_socket_desc);
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+}
+
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+/**
+  * @brief  Post a drain request to the transmit queue thread
+  * @note   ComSndQueueMutexHandle must be acquired by the caller
+  *         At most one request per socket is in the queue
+  * @param  sock - modem socket id
+  * @retval -
+  */
+static void com_ip_modem_snd_queue_request_drain(int32_t sock)
+{
+  if (com_snd_queue[sock].drain_requested == false)
+  {
+    if (rtosalMessageQueuePut(ComSndQueueQueueHandle, (uint32_t)sock + 1U, 0U) == osOK)
+    {
+      com_snd_queue[sock].drain_requested = true;
+    }
+    else
+    {
+      PRINT_ERR("snd queue socket %ld drain request NOK", sock)
+    }
+  }
+}
+
+/**
+  * @brief  Copy data in the transmit queue
+  * @note   Only the free part of the queue is used and a drain is requested
+  * @param  sock         - modem socket id
+  * @param  p_buf        - data to send
+  * @param  len          - length of the data to send (in bytes)
+  * @param  report_error - false/true keep/clear the pending error when it is returned
+  * @retval int32_t      - number of bytes queued or error value
+  */
+static int32_t com_ip_modem_snd_queue_write(int32_t sock, const com_char_t *p_buf, uint32_t len, bool report_error)
+{
+  int32_t result;
+  uint32_t length;
+  uint32_t length_first;
+  com_snd_queue_t *p_queue = &com_snd_queue[sock];
+
+  (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  if (p_queue->active == false)
+  {
+    /* Socket reset in the meantime */
+    result = COM_SOCKETS_ERR_STATE;
+  }
+  else if (p_queue->error != COM_SOCKETS_ERR_OK)
+  {
+    result = p_queue->error;
+    if (report_error == true)
+    {
+      /* Error is reported only one time */
+      p_queue->error = COM_SOCKETS_ERR_OK;
+    }
+  }
+  else
+  {
+    length = COM_MIN(len, (COM_SOCKETS_SND_QUEUE_SIZE - p_queue->count));
+    if (length > 0U)
+    {
+      /* Data may be split at the end of the buffer */
+      length_first = COM_MIN(length, (COM_SOCKETS_SND_QUEUE_SIZE - p_queue->wr_idx));
+      (void)memcpy((void *)&p_queue->buffer[p_queue->wr_idx], (const void *)p_buf, length_first);
+      if (length_first < length)
+      {
+        (void)memcpy((void *)&p_queue->buffer[0], (const void *)&p_buf[length_first], (length - length_first));
+      }
+      p_queue->wr_idx = (p_queue->wr_idx + length) % COM_SOCKETS_SND_QUEUE_SIZE;
+      p_queue->count += length;
+      com_ip_modem_snd_queue_request_drain(sock);
+    }
+    result = (int32_t)length;
+  }
+
+  (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+
+  return (result);
+}
+
+/**
+  * @brief  Wait until the transmit queue holds at most a number of bytes
+  * @note   Socket state must be COM_SOCKET_SENDING to be woken up by the transmit queue thread
+  *         Wait ends also on a send error or a socket reset
+  * @param  p_socket_desc - socket descriptor
+  * @param  max_count     - number of bytes that can remain in the queue
+  * @retval bool          - false/true socket send timeout expired/wait ended
+  */
+static bool com_ip_modem_snd_queue_wait(socket_desc_t *p_socket_desc, uint32_t max_count)
+{
+  bool result = true;
+  bool done = false;
+  com_socket_msg_t msg_queue;
+  rtosalStatus status_queue;
+  const com_snd_queue_t *p_queue = &com_snd_queue[p_socket_desc->id];
+
+  /* Empty the queue from possible messages - queue is checked after: no wake up can be lost */
+  com_ip_modem_empty_queue(p_socket_desc->queue);
+
+  while (done == false)
+  {
+    (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+    done = (p_queue->active == false) || (p_queue->error != COM_SOCKETS_ERR_OK) || (p_queue->count <= max_count);
+    (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+
+    if (done == false)
+    {
+      msg_queue = 0U;
+      status_queue = rtosalMessageQueueGet(p_socket_desc->queue, &msg_queue, p_socket_desc->snd_timeout);
+      if ((status_queue == osEventTimeout) || (status_queue == osErrorTimeoutResource))
+      {
+        result = false;
+        done = true;
+      }
+    }
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  Is a send possible without waiting
+  * @param  p_socket_desc - socket descriptor
+  * @retval bool - false/true send will wait/will not wait (free space or error to report)
+  */
+static bool com_ip_modem_snd_queue_is_writable(const socket_desc_t *p_socket_desc)
+{
+  bool result;
+  const com_snd_queue_t *p_queue = &com_snd_queue[p_socket_desc->id];
+
+  (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+  result = (p_queue->count < COM_SOCKETS_SND_QUEUE_SIZE) || (p_queue->error != COM_SOCKETS_ERR_OK);
+  (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+
+  return (result);
+}
+
+/**
+  * @brief  Send the transmit queue of a socket to the modem
+  * @note   Queue is sent back-to-back in chunks of the interface size until it is empty
+  *         After each chunk the application waiting for free space is woken up and can refill the queue
+  *         ComSndQueueMutexHandle is not kept during the modem access
+  * @param  sock - modem socket id
+  * @retval -
+  */
+static void com_ip_modem_snd_queue_drain(int32_t sock)
+{
+  bool drain;
+  uint32_t generation = 0U;
+  uint32_t rd_idx = 0U;
+  uint32_t length = 0U;
+  uint32_t length_first;
+  const uint8_t *p_chunk = NULL;
+  CS_Status_t status;
+  com_socket_msg_t msg_queue;
+  socket_desc_t *p_socket_desc;
+  com_snd_queue_t *p_queue = &com_snd_queue[sock];
+
+  (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+  /* Request is read: a new write must post a new request */
+  p_queue->drain_requested = false;
+  drain = p_queue->active;
+  (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+
+  if (drain == true)
+  {
+    com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
+
+    while (drain == true)
+    {
+      (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+      if ((p_queue->active == true) && (p_queue->error == COM_SOCKETS_ERR_OK) && (p_queue->count > 0U))
+      {
+        generation = p_queue->generation;
+        rd_idx = p_queue->rd_idx;
+        /* Full interface size whenever possible: the fewest modem sends */
+        length = COM_MIN(p_queue->count, COM_MODEM_MAX_TX_DATA_SIZE);
+        length_first = COM_MIN(length, (COM_SOCKETS_SND_QUEUE_SIZE - rd_idx));
+        if (length_first == length)
+        {
+          p_chunk = &p_queue->buffer[rd_idx];
+        }
+        else
+        {
+          /* Data wrap at the end of the buffer: gather them in one send */
+          (void)memcpy((void *)&com_snd_queue_chunk[0], (const void *)&p_queue->buffer[rd_idx], length_first);
+          (void)memcpy((void *)&com_snd_queue_chunk[length_first], (const void *)&p_queue->buffer[0],
+                       (length - length_first));
+          p_chunk = &com_snd_queue_chunk[0];
+        }
+      }
+      else
+      {
+        drain = false;
+      }
+      (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+
+      if (drain == true)
+      {
+        /* Data being sent are not overwritten: count is decreased only after the send */
+        status = osCDS_socket_send(sock, p_chunk, length);
+
+        (void)rtosalMutexAcquire(ComSndQueueMutexHandle, RTOSAL_WAIT_FOREVER);
+        if (generation != p_queue->generation)
+        {
+          /* Socket closed during the modem access */
+          drain = false;
+        }
+        else if (status == CELLULAR_OK)
+        {
+          p_queue->rd_idx = (rd_idx + length) % COM_SOCKETS_SND_QUEUE_SIZE;
+          p_queue->count -= length;
+        }
+        else
+        {
+          /* Data still in the queue are lost - error reported to the application by the next send */
+          p_queue->error  = COM_SOCKETS_ERR_GENERAL;
+          p_queue->rd_idx = p_queue->wr_idx;
+          p_queue->count  = 0U;
+          drain = false;
+          PRINT_ERR("snd queue socket %ld send NOK at low level", sock)
+        }
+        (void)rtosalMutexRelease(ComSndQueueMutexHandle);
+
+        /* Wake up the application waiting for free space or for the end of the send */
+        com_ip_modem_poll_notify();
+        p_socket_desc = com_ip_modem_find_socket(sock, false);
+        if ((p_socket_desc != NULL) && (p_socket_desc->state == COM_SOCKET_SENDING))
+        {
+          msg_queue = 0U;
+          SET_SOCKET_MSG_TYPE(msg_queue, COM_SOCKET_MSG);
+          SET_SOCKET_MSG_ID(msg_queue, COM_DATA_SND);
+          /* If the queue is full a wake up is already pending */
+          (void)rtosalMessageQueuePut(p_socket_desc->queue, msg_queue, 0U);
+        }
+      }
+    }
+
+    com_ip_modem_idlemode_request(false);
+  }
+}
+
+/**
+  * @brief  Transmit queue thread body
+  * @note   Send the queued data of the sockets to the modem on drain request
+  * @param  p_argument - unused
+  * @retval -
+  */
+static void com_ip_modem_snd_queue_thread(void *p_argument)
+{
+  uint32_t msg_queue;
+
+  UNUSED(p_argument);
+
+  for (;;)
   {
-    p_socket_desc = NULL;
+    msg_queue = 0U;
+    (void)rtosalMessageQueueGet(ComSndQueueQueueHandle, &msg_queue, RTOSAL_WAIT_FOREVER);
+    if ((msg_queue != 0U) && (msg_queue <= CELLULAR_MAX_SOCKETS))
+    {
+      com_ip_modem_snd_queue_drain((int32_t)msg_queue - 1);
+    }
   }
-
-  /* If found == false then p_socket_desc = NULL */
-  return (p_socket_desc);
 }
 
 /**
-  * @brief  Empty queue from potential messages
-  * @param  queue - queue to empty
-  * @retval -
+  * @brief  Send data of a TCP socket through its transmit queue
+  * @note   No modem access: data are sent to the modem by the transmit queue thread
+  *         Socket state must be COM_SOCKET_SENDING
+  * @param  p_socket_desc - socket descriptor
+  * @param  p_buf         - data to send
+  * @param  len           - length of the data to send (in bytes)
+  * @param  flags         - COM_MSG_DONTWAIT: only free space is used, COM_MSG_WAIT: wait until all data are queued
+  * @retval int32_t       - number of bytes queued or error value
   */
-static void com_ip_modem_empty_queue(osMessageQId queue)
+static int32_t com_ip_modem_snd_queue_send(socket_desc_t *p_socket_desc, const com_char_t *p_buf, uint32_t len,
+                                           int32_t flags)
 {
-  com_socket_msg_t msg_queue;
+  int32_t result = COM_SOCKETS_ERR_OK;
+  int32_t length_write;
+  uint32_t length_send = 0U;
+  bool wait = true;
 
-  do
+  while ((result == COM_SOCKETS_ERR_OK) && (length_send < len) && (wait == true))
   {
-    msg_queue = 0U; /* if msg_queue = 0U after MessageQueueGet() then the queue is empty */
-    /* Read the queue to suppress the msg from it */
-    (void)rtosalMessageQueueGet(queue, &msg_queue, 0U); /* timeout = 0U */
-    if (msg_queue != 0U)
+    /* An error is reported only if no data were queued by this call: else it is kept for the next one */
+    length_write = com_ip_modem_snd_queue_write(p_socket_desc->id, &p_buf[length_send], len - length_send,
+                                                (length_send == 0U));
+    if (length_write < 0)
     {
-      /* Message available in the queue */
-      PRINT_DBG("rcv cleanup MSGqueue")
+      result = length_write;
     }
-  } while (msg_queue != 0U);
+    else
+    {
+      length_send += (uint32_t)length_write;
+      if (length_send < len)
+      {
+        if (flags == COM_MSG_DONTWAIT)
+        {
+          wait = false;
+        }
+        /* Queue full: wait for free space */
+        else if (com_ip_modem_snd_queue_wait(p_socket_desc, COM_SOCKETS_SND_QUEUE_SIZE - 1U) == false)
+        {
+          result = COM_SOCKETS_ERR_TIMEOUT;
+        }
+        else
+        {
+          __NOP();
+        }
+      }
+    }
+  }
+
+  if (length_send > 0U)
+  {
+    result = (int32_t)length_send;
+    PRINT_DBG("snd queue socket %ld: %lu bytes queued", p_socket_desc->id, length_send)
+  }
+  else if (result == COM_SOCKETS_ERR_OK)
+  {
+    /* COM_MSG_DONTWAIT and queue full */
+    result = COM_SOCKETS_ERR_WOULDBLOCK;
+  }
+  else
+  {
+    PRINT_ERR("snd queue socket %ld NOK", p_socket_desc->id)
+  }
+
+  return (result);
 }
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
 
 #if (USE_LOW_POWER == 1)
 /**
@@ -619,7 +1658,7 @@ static bool com_convert_IPString_to_sockaddr(uint16_t ipaddr_port, com_char_t *p
 
     (void)memset(p_sockaddr, 0, sizeof(com_sockaddr_t));
 
-    count = sscanf((CSIP_CHAR_t *)(&(p_ipaddr_str[begin])), "%03lu.%03lu.%03lu.%03lu",
+    count = sscanf((CSIP_CHAR_t *)(&(p_ipaddr_str[begin])), "%03" SCNu32 ".%03" SCNu32 ".%03" SCNu32 ".%03" SCNu32,
                    &ip_addr_tmp[0], &ip_addr_tmp[1], &ip_addr_tmp[2], &ip_addr_tmp[3]);
 
     if (count == 4)
@@ -935,17 +1974,28 @@ static void com_ip_modem_data_received_cb(socket_handle_t sock)
   {
     if (p_socket_desc->closing != true)
     {
-      if (p_socket_desc->state == COM_SOCKET_WAITING)
+      if (com_ip_modem_rcv_cache_notify(p_socket_desc->id) == true)
       {
-        PRINT_INFO("cb socket %ld data ready called: waiting", p_socket_desc->id)
-        SET_SOCKET_MSG_TYPE(msg_queue, msg_type);
-        SET_SOCKET_MSG_ID(msg_queue, msg_id);
-        PRINT_DBG("cb socket %ld MSGput %lu queue %p", p_socket_desc->id, msg_queue, p_socket_desc->queue)
-        (void)rtosalMessageQueuePut(p_socket_desc->queue, msg_queue, 0U);
+        /* Data read by the receive cache thread - it wakes up the application if needed */
+        PRINT_DBG("cb socket %ld data ready called: fetch requested", p_socket_desc->id)
       }
       else
       {
-        PRINT_INFO("cb socket data ready called: socket_state:%i NOK", p_socket_desc->state)
+        /* Data ready until read by the application - used by com_poll */
+        p_socket_desc->rcv_ready = true;
+        com_ip_modem_poll_notify();
+        if (p_socket_desc->state == COM_SOCKET_WAITING)
+        {
+          PRINT_INFO("cb socket %ld data ready called: waiting", p_socket_desc->id)
+          SET_SOCKET_MSG_TYPE(msg_queue, msg_type);
+          SET_SOCKET_MSG_ID(msg_queue, msg_id);
+          PRINT_DBG("cb socket %ld MSGput %lu queue %p", p_socket_desc->id, msg_queue, p_socket_desc->queue)
+          (void)rtosalMessageQueuePut(p_socket_desc->queue, msg_queue, 0U);
+        }
+        else
+        {
+          PRINT_INFO("cb socket data ready called: socket_state:%i NOK", p_socket_desc->state)
+        }
       }
     }
     else
@@ -979,13 +2029,18 @@ static void com_ip_modem_closing_cb(socket_handle_t sock)
 
   if (p_socket_desc != NULL)
   {
+    bool cache_notified;
+
     PRINT_INFO("cb socket closing called: close rqt")
+    /* Data may still be in the modem: receive cache must be notified before closing is set */
+    cache_notified = com_ip_modem_rcv_cache_notify(p_socket_desc->id);
     if (p_socket_desc->closing == false)
     {
       p_socket_desc->closing = true;
       PRINT_INFO("cb socket closing: close rqt")
     }
-    if (p_socket_desc->state == COM_SOCKET_WAITING)
+    com_ip_modem_poll_notify();
+    if ((cache_notified == false) && (p_socket_desc->state == COM_SOCKET_WAITING))
     {
       PRINT_ERR("!!! cb socket %ld closing called: data_expected !!!", p_socket_desc->id)
       SET_SOCKET_MSG_TYPE(msg_queue, msg_type);
@@ -1031,6 +2086,9 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
         {
           com_sockets_network_is_up = true;
           com_sockets_statistic_update(COM_SOCKET_STAT_NWK_UP);
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+          com_sockets_dns_cache_network_status(true);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 #if (USE_LOW_POWER == 1)
           (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
           com_timer_inactivity_state = COM_TIMER_RUN;
@@ -1047,6 +2105,10 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
         {
           com_sockets_network_is_up = false;
           com_sockets_statistic_update(COM_SOCKET_STAT_NWK_DWN);
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+          /* Addresses resolved on this PDN may be wrong on the next one */
+          com_sockets_dns_cache_network_status(false);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 #if (USE_LOW_POWER == 1)
           (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
           com_timer_inactivity_state = COM_TIMER_IDLE;
@@ -1669,6 +2731,8 @@ int32_t com_connect_ip_modem(int32_t sock, const com_sockaddr_t *addr, int32_t a
         /* Check Network status */
         if (com_ip_modem_is_network_up() == true)
         {
+          /* Receive cache activated before the connection: data may be received as soon as it is established */
+          com_ip_modem_rcv_cache_reset(p_socket_desc->id, true);
           com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
           if (osCDS_socket_connect(p_socket_desc->id, socket_addr.ip_type, &socket_addr.ip_value[0], socket_addr.port)
               == CELLULAR_OK)
@@ -1677,9 +2741,11 @@ int32_t com_connect_ip_modem(int32_t sock, const com_sockaddr_t *addr, int32_t a
             /* result = COM_SOCKETS_ERR_OK; */
             PRINT_INFO("socket connect ok")
             p_socket_desc->state = COM_SOCKET_CONNECTED;
+            com_ip_modem_snd_queue_reset(p_socket_desc->id, true);
           }
           else
           {
+            com_ip_modem_rcv_cache_reset(p_socket_desc->id, false);
             result = COM_SOCKETS_ERR_GENERAL;
             PRINT_ERR("socket connect NOK at low level")
           }
@@ -1810,6 +2876,16 @@ int32_t com_send_ip_modem(int32_t sock, const com_char_t *buf, int32_t len, int3
           }
           else
 #endif /* UDP_SERVICE_SUPPORTED == 1 */
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+          if (p_socket_desc->type == (uint8_t)COM_SOCK_STREAM)
+          {
+            /* Data sent to the modem by the transmit queue thread */
+            p_socket_desc->state = COM_SOCKET_SENDING;
+            result = com_ip_modem_snd_queue_send(p_socket_desc, buf, (uint32_t)len, flags);
+            p_socket_desc->state = COM_SOCKET_CONNECTED;
+          }
+          else
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
           {
             uint32_t length_to_send;
             uint32_t length_send;
@@ -2135,9 +3211,10 @@ int32_t com_sendto_ip_modem(int32_t sock,
   * @param  buf       - pointer to application data buffer to store the data to
   * @note   see below
   * @param  len       - size of application data buffer (in bytes)
-  * @note   even if len > interface between COM and low level
-  *         a maximum of the interface capacity can be received
-  *         at each function call
+  * @note   if len > interface between COM and low level
+  *         and the modem still has data after a read of the interface capacity
+  *         the next data are read in the same function call
+  *         until the application buffer is full
   * @param  flags     - options
   * @note
   *         - if flags = COM_MSG_DONTWAIT, application request to not wait
@@ -2163,106 +3240,134 @@ int32_t com_recv_ip_modem(int32_t sock, com_char_t *buf, int32_t len, int32_t fl
        but still some data to read */
     if (p_socket_desc->state == COM_SOCKET_CONNECTED)
     {
-      uint32_t length_to_read;
-      length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
-      p_socket_desc->state = COM_SOCKET_WAITING;
-
-      com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
-
-      /* Empty the queue from possible messages */
-      com_ip_modem_empty_queue(p_socket_desc->queue);
-
-      if (flags == COM_MSG_DONTWAIT)
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+      if (p_socket_desc->type == (uint8_t)COM_SOCK_STREAM)
       {
-
-        /* Application don't want to wait if there is no data available */
-        len_rcv = osCDS_socket_receive(p_socket_desc->id, buf, length_to_read);
-        result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
-        p_socket_desc->state = COM_SOCKET_CONNECTED;
-        PRINT_INFO("rcv data DONTWAIT")
+        /* Data already read from the modem by the receive cache thread */
+        result = com_ip_modem_rcv_cache_recv(p_socket_desc, buf, (uint32_t)len, flags, &len_rcv);
       }
       else
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
       {
-        /* Maybe still some data available
-           because application don't read all data with previous calls */
-        PRINT_DBG("rcv data waiting")
-        len_rcv = osCDS_socket_receive(p_socket_desc->id, buf, length_to_read);
-        PRINT_DBG("rcv data waiting exit")
+        bool rcv_full;
+        uint32_t length_to_read;
+        length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
+        p_socket_desc->state = COM_SOCKET_WAITING;
+        /* Data ready is set again by a new URC or if the modem may still have data */
+        p_socket_desc->rcv_ready = false;
+
+        com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
+
+        /* Empty the queue from possible messages */
+        com_ip_modem_empty_queue(p_socket_desc->queue);
 
-        if (len_rcv == 0)
+        if (flags == COM_MSG_DONTWAIT)
         {
-          /* Waiting for Distant response or Closure Socket or Timeout */
-          msg_queue = 0U;
-          status_queue = rtosalMessageQueueGet(p_socket_desc->queue, &msg_queue, p_socket_desc->rcv_timeout);
-          /* For Timeout returned result :
-           * osEventTimeout in case cmsisV1
-           * osErrorTimeoutResource = osErrorTimeout in case cmsisV2
-           * osErrorTimeoutResource defined for cmsisV1 and V2 so better than osErrorTimeout */
-          if ((status_queue == osEventTimeout) || (status_queue == osErrorTimeoutResource))
-          {
-            result = COM_SOCKETS_ERR_TIMEOUT;
-            p_socket_desc->state = COM_SOCKET_CONNECTED;
-            PRINT_INFO("rcv data exit timeout")
-          }
-          else
+
+          /* Application don't want to wait if there is no data available */
+          len_rcv = osCDS_socket_receive(p_socket_desc->id, buf, length_to_read);
+          result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
+          p_socket_desc->state = COM_SOCKET_CONNECTED;
+          PRINT_INFO("rcv data DONTWAIT")
+        }
+        else
+        {
+          /* Maybe still some data available
+             because application don't read all data with previous calls */
+          PRINT_DBG("rcv data waiting")
+          len_rcv = osCDS_socket_receive(p_socket_desc->id, buf, length_to_read);
+          PRINT_DBG("rcv data waiting exit")
+
+          if (len_rcv == 0)
           {
-            /* A message is in the queue and it it a SOCKET one */
-            com_socket_msg_type_t msg_type = GET_SOCKET_MSG_TYPE(msg_queue);
-            com_socket_msg_type_t msg_id   = GET_SOCKET_MSG_ID(msg_queue);
-            if ((msg_queue != 0U) && (msg_type == COM_SOCKET_MSG))
+            /* Waiting for Distant response or Closure Socket or Timeout */
+            msg_queue = 0U;
+            status_queue = rtosalMessageQueueGet(p_socket_desc->queue, &msg_queue, p_socket_desc->rcv_timeout);
+            /* For Timeout returned result :
+             * osEventTimeout in case cmsisV1
+             * osErrorTimeoutResource = osErrorTimeout in case cmsisV2
+             * osErrorTimeoutResource defined for cmsisV1 and V2 so better than osErrorTimeout */
+            if ((status_queue == osEventTimeout) || (status_queue == osErrorTimeoutResource))
             {
-              switch (msg_id)
+              result = COM_SOCKETS_ERR_TIMEOUT;
+              p_socket_desc->state = COM_SOCKET_CONNECTED;
+              PRINT_INFO("rcv data exit timeout")
+            }
+            else
+            {
+              /* A message is in the queue and it it a SOCKET one */
+              com_socket_msg_type_t msg_type = GET_SOCKET_MSG_TYPE(msg_queue);
+              com_socket_msg_type_t msg_id   = GET_SOCKET_MSG_ID(msg_queue);
+              if ((msg_queue != 0U) && (msg_type == COM_SOCKET_MSG))
               {
-                case COM_DATA_RCV :
+                switch (msg_id)
                 {
-                  len_rcv = osCDS_socket_receive(p_socket_desc->id, buf, length_to_read);
-                  result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
-                  p_socket_desc->state = COM_SOCKET_CONNECTED;
-                  if (len_rcv == 0)
+                  case COM_DATA_RCV :
                   {
-                    PRINT_DBG("rcv data exit with no data")
+                    len_rcv = osCDS_socket_receive(p_socket_desc->id, buf, length_to_read);
+                    result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
+                    p_socket_desc->state = COM_SOCKET_CONNECTED;
+                    if (len_rcv == 0)
+                    {
+                      PRINT_DBG("rcv data exit with no data")
+                    }
+                    PRINT_INFO("rcv data exit with data")
+                    break;
+                  }
+                  case COM_CLOSING_RCV :
+                  {
+                    result = COM_SOCKETS_ERR_CLOSING;
+                    p_socket_desc->state = COM_SOCKET_CONNECTED;
+                    PRINT_INFO("rcv data exit socket closing")
+                    break;
+                  }
+                  default :
+                  {
+                    /* Impossible case */
+                    result = COM_SOCKETS_ERR_GENERAL;
+                    p_socket_desc->state = COM_SOCKET_CONNECTED;
+                    PRINT_ERR("rcv data exit NOK impossible case")
+                    break;
                   }
-                  PRINT_INFO("rcv data exit with data")
-                  break;
-                }
-                case COM_CLOSING_RCV :
-                {
-                  result = COM_SOCKETS_ERR_CLOSING;
-                  p_socket_desc->state = COM_SOCKET_CONNECTED;
-                  PRINT_INFO("rcv data exit socket closing")
-                  break;
-                }
-                default :
-                {
-                  /* Impossible case */
-                  result = COM_SOCKETS_ERR_GENERAL;
-                  p_socket_desc->state = COM_SOCKET_CONNECTED;
-                  PRINT_ERR("rcv data exit NOK impossible case")
-                  break;
                 }
               }
-            }
-            else
-            {
-              /* Error or empty queue */
-              result = COM_SOCKETS_ERR_GENERAL;
-              p_socket_desc->state = COM_SOCKET_CONNECTED;
-              PRINT_ERR("rcv data msg NOK or empty queue")
+              else
+              {
+                /* Error or empty queue */
+                result = COM_SOCKETS_ERR_GENERAL;
+                p_socket_desc->state = COM_SOCKET_CONNECTED;
+                PRINT_ERR("rcv data msg NOK or empty queue")
+              }
             }
           }
+          else
+          {
+            result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
+            p_socket_desc->state = COM_SOCKET_CONNECTED;
+            PRINT_INFO("rcv data exit data available or err low level")
+          }
         }
-        else
+
+        rcv_full = (len_rcv == (int32_t)length_to_read);
+        if ((rcv_full == true) && (p_socket_desc->type == (uint8_t)COM_SOCK_STREAM) && ((uint32_t)len > length_to_read))
         {
-          result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
+          /* Interface capacity reached but not application buffer size: read the next data in the same call */
+          p_socket_desc->state = COM_SOCKET_WAITING;
+          len_rcv = com_ip_modem_recv_next(p_socket_desc->id, buf, (uint32_t)len, len_rcv, &rcv_full);
           p_socket_desc->state = COM_SOCKET_CONNECTED;
-          PRINT_INFO("rcv data exit data available or err low level")
         }
-      }
 
-      /* Empty the queue from possible messages */
-      com_ip_modem_empty_queue(p_socket_desc->queue);
+        /* Empty the queue from possible messages */
+        com_ip_modem_empty_queue(p_socket_desc->queue);
+
+        if (rcv_full == true)
+        {
+          /* Buffer is full: modem may still have data */
+          p_socket_desc->rcv_ready = true;
+        }
 
-      com_ip_modem_idlemode_request(false);
+        com_ip_modem_idlemode_request(false);
+      }
     }
     else
     {
@@ -2370,6 +3475,8 @@ int32_t com_recvfrom_ip_modem(int32_t sock, com_char_t *buf, int32_t len, int32_
           uint32_t length_to_read;
           length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
           p_socket_desc->state = COM_SOCKET_WAITING;
+          /* Data ready is set again by a new URC or if the modem may still have data */
+          p_socket_desc->rcv_ready = false;
 
           /* Empty the queue from possible messages */
           com_ip_modem_empty_queue(p_socket_desc->queue);
@@ -2467,6 +3574,12 @@ int32_t com_recvfrom_ip_modem(int32_t sock, com_char_t *buf, int32_t len, int32_
 
           /* Empty the queue from possible messages */
           com_ip_modem_empty_queue(p_socket_desc->queue);
+
+          if (len_rcv > 0)
+          {
+            /* One datagram read: modem may still have others */
+            p_socket_desc->rcv_ready = true;
+          }
         }
         else
         {
@@ -2499,6 +3612,103 @@ int32_t com_recvfrom_ip_modem(int32_t sock, com_char_t *buf, int32_t len, int32_
 }
 
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until at least one of the sockets is ready for the requested events
+  *         Readiness is updated by the data received and closing notifications of the modem
+  *         Only one application thread at a time can wait in poll
+  * @param  fds       - array of socket descriptors with the requested events
+  * @param  nfds      - number of elements in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, negative value: wait forever
+  * @note   COM_POLLIN may be reported even if a next com_recv/com_recvfrom returns no data
+  * @retval int32_t   - number of sockets with returned events (0 on timeout) or error value
+  */
+int32_t com_poll_ip_modem(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  int32_t result = COM_SOCKETS_ERR_PARAMETER;
+  int32_t nb_ready;
+  bool wait = true;
+  uint32_t tick_start;
+  uint32_t tick_elapsed;
+  uint32_t wait_time = RTOSAL_WAIT_FOREVER;
+  com_socket_msg_t msg_queue;
+
+  if ((fds != NULL) && (nfds > 0U))
+  {
+    /* Only one application at a time can wait in poll */
+    (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+    if (com_poll_in_progress == false)
+    {
+      com_poll_in_progress = true;
+      result = COM_SOCKETS_ERR_OK;
+    }
+    else
+    {
+      result = COM_SOCKETS_ERR_INPROGRESS;
+      PRINT_ERR("poll NOK already in progress")
+    }
+    (void)rtosalMutexRelease(ComSocketsMutexHandle);
+  }
+
+  if (result == COM_SOCKETS_ERR_OK)
+  {
+    /* Events notified before this poll are checked below */
+    com_ip_modem_empty_queue(ComPollQueueHandle);
+    tick_start = HAL_GetTick();
+
+    do
+    {
+      nb_ready = 0;
+      for (uint32_t i = 0U; i < nfds; i++)
+      {
+        fds[i].revents = (fds[i].fd < 0) ? (int16_t)0 : com_ip_modem_poll_revents(&fds[i]);
+        if (fds[i].revents != 0)
+        {
+          nb_ready++;
+        }
+      }
+
+      if ((nb_ready > 0) || (timeout == 0))
+      {
+        wait = false;
+      }
+      else if (timeout > 0)
+      {
+        tick_elapsed = HAL_GetTick() - tick_start;
+        if (tick_elapsed >= (uint32_t)timeout)
+        {
+          wait = false;
+        }
+        else
+        {
+          wait_time = (uint32_t)timeout - tick_elapsed;
+        }
+      }
+      else
+      {
+        /* timeout < 0: wait forever - wait_time already set to RTOSAL_WAIT_FOREVER */
+      }
+
+      if (wait == true)
+      {
+        /* Waiting for a socket event or Timeout - all sockets are checked again in both cases */
+        msg_queue = 0U;
+        (void)rtosalMessageQueueGet(ComPollQueueHandle, &msg_queue, wait_time);
+      }
+    } while (wait == true);
+
+    (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+    com_poll_in_progress = false;
+    (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+    result = nb_ready;
+    PRINT_DBG("poll exit with %ld socket(s) ready", nb_ready)
+  }
+
+  return (result);
+}
+
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
@@ -2524,6 +3734,8 @@ int32_t com_closesocket_ip_modem(int32_t sock)
     }
     else
     {
+      /* Data accepted by com_send must be sent before the close */
+      com_ip_modem_snd_queue_flush(p_socket_desc);
       result = COM_SOCKETS_ERR_GENERAL;
       com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
       if (osCDS_socket_close(sock, 0U) == CELLULAR_OK)
@@ -2556,6 +3768,8 @@ int32_t com_closesocket_ip_modem(int32_t sock)
   * @param  addr      - host IP corresponding to host name
   * @note   only IPv4 address is managed
   * @retval int32_t   - ok or error value
+  *                     COM_SOCKETS_ERR_NONAME: network up and host name not resolved by the modem
+  *                     COM_SOCKETS_ERR_NONETWORK: network down before or during the resolution
   */
 int32_t com_gethostbyname_ip_modem(const com_char_t *name, com_sockaddr_t   *addr)
 {
@@ -2571,25 +3785,42 @@ int32_t com_gethostbyname_ip_modem(const com_char_t *name, com_sockaddr_t   *add
       (void)strcpy((CSIP_CHAR_t *)&dns_req.host_name[0], (const CSIP_CHAR_t *)name);
 
       result = COM_SOCKETS_ERR_GENERAL;
-      com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
-      if (osCDS_dns_request(PDN_conf_id, &dns_req, &dns_resp) == CELLULAR_OK)
+      /* network maybe down, refuse to resolve: the failure is not the one of the host name */
+      if (com_ip_modem_is_network_up() == false)
+      {
+        result = COM_SOCKETS_ERR_NONETWORK;
+        PRINT_ERR("DNS resolution NOK no network")
+      }
+      else
       {
-        PRINT_INFO("DNS resolution OK - Remote: %s IP: %s", name, dns_resp.host_addr)
-        if (com_convert_IPString_to_sockaddr(0U, (com_char_t *)&dns_resp.host_addr[0], addr) == true)
+        com_ip_modem_wakeup_request(); /* Before to interact with the modem, wakeup it */
+        if (osCDS_dns_request(PDN_conf_id, &dns_req, &dns_resp) == CELLULAR_OK)
         {
-          PRINT_DBG("DNS conversion OK")
-          result = COM_SOCKETS_ERR_OK;
+          PRINT_INFO("DNS resolution OK - Remote: %s IP: %s", name, dns_resp.host_addr)
+          if (com_convert_IPString_to_sockaddr(0U, (com_char_t *)&dns_resp.host_addr[0], addr) == true)
+          {
+            PRINT_DBG("DNS conversion OK")
+            result = COM_SOCKETS_ERR_OK;
+          }
+          else
+          {
+            PRINT_ERR("DNS conversion NOK")
+          }
+        }
+        else if (com_ip_modem_is_network_up() == false)
+        {
+          /* network lost during the resolution */
+          result = COM_SOCKETS_ERR_NONETWORK;
+          PRINT_ERR("DNS resolution NOK for %s - no network", name)
         }
         else
         {
-          PRINT_ERR("DNS conversion NOK")
+          /* network up: the modem did not resolve the host name */
+          result = COM_SOCKETS_ERR_NONAME;
+          PRINT_ERR("DNS resolution NOK for %s", name)
         }
+        com_ip_modem_idlemode_request(false);
       }
-      else
-      {
-        PRINT_ERR("DNS resolution NOK for %s", name)
-      }
-      com_ip_modem_idlemode_request(false);
     }
   }
 
@@ -2943,7 +4174,10 @@ bool com_init_ip_modem(void)
 
   /* Initialize Mutex to protect socket descriptor list access */
   ComSocketsMutexHandle = rtosalMutexNew((const rtosal_char_t *)"COMSOCKIP_MUT_SOCKET_LIST");
-  if (ComSocketsMutexHandle != NULL)
+  /* Initialize queue to wake up the application waiting in poll - one message is enough */
+  com_poll_in_progress = false;
+  ComPollQueueHandle = rtosalMessageQueueNew((const rtosal_char_t *)"COMSOCKIP_QUE_POLL", 1U);
+  if ((ComSocketsMutexHandle != NULL) && (ComPollQueueHandle != NULL))
   {
     /* Create always the first element of the list */
     p_socket_desc_list = com_ip_modem_create_socket_desc();
@@ -2974,6 +4208,32 @@ bool com_init_ip_modem(void)
   com_local_port = 0U; /* com_start_ip in charge to initialize it to a random value */
 #endif /* UDP_SERVICE_SUPPORTED == 1U */
 
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+  /* Initialize receive cache - one fetch request at most per socket in the queue */
+  (void)memset((void *)&com_rcv_cache[0], 0, sizeof(com_rcv_cache));
+  ComRcvCacheMutexHandle = rtosalMutexNew((const rtosal_char_t *)"COMSOCKIP_MUT_RCV_CACHE");
+  ComRcvCacheQueueHandle = rtosalMessageQueueNew((const rtosal_char_t *)"COMSOCKIP_QUE_RCV_CACHE",
+                                                 CELLULAR_MAX_SOCKETS);
+  ComRcvCacheThreadId = NULL;
+  if ((ComRcvCacheMutexHandle == NULL) || (ComRcvCacheQueueHandle == NULL))
+  {
+    result = false;
+  }
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+  /* Initialize transmit queue - one drain request at most per socket in the queue */
+  (void)memset((void *)&com_snd_queue[0], 0, sizeof(com_snd_queue));
+  ComSndQueueMutexHandle = rtosalMutexNew((const rtosal_char_t *)"COMSOCKIP_MUT_SND_QUEUE");
+  ComSndQueueQueueHandle = rtosalMessageQueueNew((const rtosal_char_t *)"COMSOCKIP_QUE_SND_QUEUE",
+                                                 CELLULAR_MAX_SOCKETS);
+  ComSndQueueThreadId = NULL;
+  if ((ComSndQueueMutexHandle == NULL) || (ComSndQueueQueueHandle == NULL))
+  {
+    result = false;
+  }
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
+
   return (result);
 }
 
@@ -2988,8 +4248,20 @@ bool com_init_ip_modem(void)
   */
 void com_start_ip_modem(void)
 {
+  dc_com_reg_id_t reg_id;
+
   /* Datacache registration for netwok on/off status */
-  (void)dc_com_core_register_gen_event_cb(&dc_com_db, com_socket_datacache_cb, (void *)NULL);
+  reg_id = dc_com_core_register_gen_event_cb(&dc_com_db, com_socket_datacache_cb, (void *)NULL);
+  if (reg_id == DC_COM_INVALID_ENTRY)
+  {
+    /* Network status would never be known: sockets would never be usable */
+    ERROR_Handler(DBG_CHAN_COMLIB, 3, ERROR_FATAL);
+  }
+  else
+  {
+    /* Only network status is managed by com_socket_datacache_cb */
+    (void)dc_com_set_event_mask(&dc_com_db, reg_id, DC_COM_EVENT_MASK(DC_CELLULAR_NIFMAN_INFO));
+  }
 
 #if (UDP_SERVICE_SUPPORTED == 1U)
   uint32_t random;
@@ -3003,6 +4275,36 @@ void com_start_ip_modem(void)
   random = random + COM_LOCAL_PORT_BEGIN;
   com_local_port = (uint16_t)(random);
 #endif /* UDP_SERVICE_SUPPORTED == 1U */
+
+#if (COM_SOCKETS_RCV_CACHE == 1U)
+  /* Multi call protection */
+  if (ComRcvCacheThreadId == NULL)
+  {
+    /* Thread reading the modem data in the receive cache */
+    ComRcvCacheThreadId = rtosalThreadNew((const rtosal_char_t *)"ComRcvCache",
+                                          (os_pthread)com_ip_modem_rcv_cache_thread, COM_RCV_CACHE_THREAD_PRIO,
+                                          (uint32_t)COM_RCV_CACHE_THREAD_STACK_SIZE, NULL);
+    if (ComRcvCacheThreadId == NULL)
+    {
+      ERROR_Handler(DBG_CHAN_COMLIB, 1, ERROR_FATAL);
+    }
+  }
+#endif /* COM_SOCKETS_RCV_CACHE == 1U */
+
+#if (COM_SOCKETS_SND_QUEUE == 1U)
+  /* Multi call protection */
+  if (ComSndQueueThreadId == NULL)
+  {
+    /* Thread sending the queued data to the modem */
+    ComSndQueueThreadId = rtosalThreadNew((const rtosal_char_t *)"ComSndQueue",
+                                          (os_pthread)com_ip_modem_snd_queue_thread, COM_SND_QUEUE_THREAD_PRIO,
+                                          (uint32_t)COM_SND_QUEUE_THREAD_STACK_SIZE, NULL);
+    if (ComSndQueueThreadId == NULL)
+    {
+      ERROR_Handler(DBG_CHAN_COMLIB, 2, ERROR_FATAL);
+    }
+  }
+#endif /* COM_SOCKETS_SND_QUEUE == 1U */
 }
 
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
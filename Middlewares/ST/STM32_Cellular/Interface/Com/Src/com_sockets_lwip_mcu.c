@@ -27,6 +27,13 @@
 #include "com_sockets_net_compat.h"
 #include "com_trace.h"
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+#include "com_sockets.h" /* DNS cache network status update */
+#include "dc_common.h"
+#include "cellular_service_datacache.h"
+#include "error_handler.h"
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* LwIP is a Third Party so MISRAC messages linked to it are ignored */
 /*cstat -MISRAC2012-* */
 #include "lwip/sockets.h"
@@ -61,8 +68,67 @@ static com_char_t *ping_rcv;
 static uint8_t ping_seqno;
 #endif /* USE_COM_PING == 1 */
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/* Network status - only needed by the DNS cache */
+static bool com_sockets_network_is_up;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/* Callback called when a value in datacache changed */
+static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p_private_gui_data);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
+/* Private function Definition -----------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/**
+  * @brief  Callback called when a value in datacache changed
+  * @note   Managed datacache value changed
+  * @param  dc_event_id - value changed
+  * @note   -
+  * @param  p_private_gui_data - value provided at service subscription
+  * @note   Unused
+  * @retval -
+  */
+static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p_private_gui_data)
+{
+  UNUSED(p_private_gui_data);
+
+  if (dc_event_id == DC_CELLULAR_NIFMAN_INFO)
+  {
+    dc_nifman_info_t dc_nifman_rt_info;
+
+    if (dc_com_read(&dc_com_db, DC_CELLULAR_NIFMAN_INFO, (void *)&dc_nifman_rt_info, sizeof(dc_nifman_rt_info))
+        == DC_COM_OK)
+    {
+      /* Is Data ready or not ? */
+      if (dc_nifman_rt_info.rt_state == DC_SERVICE_ON)
+      {
+        if (com_sockets_network_is_up == false)
+        {
+          com_sockets_network_is_up = true;
+          com_sockets_dns_cache_network_status(true);
+        }
+      }
+      else
+      {
+        if (com_sockets_network_is_up == true)
+        {
+          com_sockets_network_is_up = false;
+          /* Addresses resolved on this PDN may be wrong on the next one */
+          com_sockets_dns_cache_network_status(false);
+        }
+      }
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Functions Definition ------------------------------------------------------*/
 
 
@@ -260,6 +326,21 @@ int32_t com_recvfrom_lwip_mcu(int32_t sock,
 }
 
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until at least one of the sockets is ready for the requested events
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  fds       - array of socket descriptors with the requested events
+  * @param  nfds      - number of elements in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 on timeout) or error value
+  */
+int32_t com_poll_lwip_mcu(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  return (lwip_poll(fds, (nfds_t)nfds, timeout));
+}
+
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
@@ -603,6 +684,10 @@ bool com_init_lwip_mcu(void)
   /* else result already set to true */
 #endif /* USE_COM_PING == 1 */
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+  com_sockets_network_is_up = false; /* Network status update by Datacache see com_socket_datacache_cb() */
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
   return (result);
 }
 
@@ -617,8 +702,25 @@ bool com_init_lwip_mcu(void)
   */
 void com_start_lwip_mcu(void)
 {
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+  dc_com_reg_id_t reg_id;
+
+  /* Datacache registration for network on/off status - it takes the core subscriber slot of com_sockets_ip_modem */
+  reg_id = dc_com_core_register_gen_event_cb(&dc_com_db, com_socket_datacache_cb, (void *)NULL);
+  if (reg_id == DC_COM_INVALID_ENTRY)
+  {
+    /* DNS cache would never be flushed on network down */
+    ERROR_Handler(DBG_CHAN_COMLIB, 1, ERROR_FATAL);
+  }
+  else
+  {
+    /* Only network status is managed by com_socket_datacache_cb */
+    (void)dc_com_set_event_mask(&dc_com_db, reg_id, DC_COM_EVENT_MASK(DC_CELLULAR_NIFMAN_INFO));
+  }
+#else
   /* Nothing to do */
   __NOP();
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 }
 
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_LWIP */
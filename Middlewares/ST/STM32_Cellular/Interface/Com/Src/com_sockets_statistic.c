@@ -54,6 +54,7 @@ typedef struct
   com_sockets_stat_counter_t receive;
   com_sockets_stat_counter_t close;
   com_sockets_stat_counter_t network;
+  com_sockets_stat_counter_t dns;     /* ok: answered by the DNS cache, nok: resolution done */
 } com_socket_statistic_t;
 
 /* Private macros ------------------------------------------------------------*/
@@ -196,6 +197,12 @@ void com_sockets_statistic_update(com_sockets_stat_update_t stat)
     case COM_SOCKET_STAT_CLS_NOK:
       com_socket_statistic.close.nok++;
       break;
+    case COM_SOCKET_STAT_DNS_HIT:
+      com_socket_statistic.dns.ok++;
+      break;
+    case COM_SOCKET_STAT_DNS_MISS:
+      com_socket_statistic.dns.nok++;
+      break;
     default:
       __NOP(); /* Nothing to do */
       break;
@@ -238,6 +245,11 @@ void com_sockets_statistic_display(void)
     PRINT_FORCE("ComLibStat: Cls: ok:%5d - nok:%5d - tot:%6d",
                 com_socket_statistic.close.ok, com_socket_statistic.close.nok,
                 (com_socket_statistic.close.ok + com_socket_statistic.close.nok))
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+    PRINT_FORCE("ComLibStat: Dns: hit:%4d - miss:%4d - tot:%6d",
+                com_socket_statistic.dns.ok, com_socket_statistic.dns.nok,
+                (com_socket_statistic.dns.ok + com_socket_statistic.dns.nok))
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 #if 0
     /* Socket status displayed */
     while (socket_desc != NULL)
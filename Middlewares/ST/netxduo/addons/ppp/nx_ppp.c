@@ -91,6 +91,18 @@ const USHORT _nx_ppp_crc_table[256] =
 };
 
 
+/* STMicroelectronics local patch (see st_readme.txt): FCS hooks.
+   NX_PPP_FCS_BYTE updates the CRC with one byte, it is used in the loop
+   which escapes the transmitted frame. NX_PPP_FCS_BLOCK, when defined in
+   nx_user.h, is a function updating the CRC with a block of data
+   (USHORT crc, UCHAR *data, ULONG length), it is used to check the CRC
+   of the received frames, e.g. on a CRC peripheral.  */
+
+#ifndef NX_PPP_FCS_BYTE
+#define NX_PPP_FCS_BYTE(crc, byte)  ((USHORT)(((crc) >> 8) ^ _nx_ppp_crc_table[((crc) & 0xFF) ^ (byte)]))
+#endif
+
+
 /* Bring in externs for caller checking code.  */
 
 NX_CALLER_CHECKING_EXTERNS
@@ -7816,8 +7828,9 @@ NX_PACKET   *packet_ptr;
 /*                                                                        */
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
-/*    This function adds a CRC to the current transmit buffer and then    */ 
-/*    sends the buffer via the user supplied byte output routine.         */
+/*    This function sends the buffer via the user supplied byte output    */ 
+/*    routine. The CRC is computed in the same pass as the escaping, so   */
+/*    each byte of the buffer is read only once.                          */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -7831,7 +7844,7 @@ NX_PACKET   *packet_ptr;
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    [_nx_ppp_debug_log_capture]           Put send frame in debug log   */ 
-/*    _nx_ppp_crc_append                    Add PPP CRC                   */ 
+/*    NX_PPP_FCS_BYTE                       Update the CRC with a byte    */
 /*    (nx_ppp_byte_send)                    User supplied byte send       */ 
 /*    nx_packet_transmit_release            Release the transmit packet   */ 
 /*                                                                        */ 
@@ -7861,6 +7874,9 @@ NX_PACKET   *packet_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     STMicroelectronics       Modified: CRC computed while  */
+/*                                            escaping the frame (local   */
+/*                                            patch, see st_readme.txt)   */
 /*                                                                        */
 /**************************************************************************/
 void  _nx_ppp_packet_transmit(NX_PPP *ppp_ptr, NX_PACKET *packet_ptr)
@@ -7872,6 +7888,7 @@ UCHAR       byte;
 UCHAR       *buffer_ptr;
 UCHAR       hdlc[3] = {0x7e, 0xff, 0x03};
 UCHAR       crc[2];
+USHORT      crc_value;
 #ifdef NX_PPP_PPPOE_ENABLE
 UINT        release_packet = NX_TRUE;
 #endif /* NX_PPP_PPPOE_ENABLE  */
@@ -7923,6 +7940,12 @@ UINT        release_packet = NX_TRUE;
             ppp_ptr -> nx_ppp_byte_send(byte);
         }
 
+        /* Initialize CRC value with the address and control fields. The CRC
+           is updated with each data byte as it is sent (see _nx_ppp_crc_append). */
+        crc_value = 0xffff;
+        crc_value = NX_PPP_FCS_BYTE(crc_value, hdlc[1]);
+        crc_value = NX_PPP_FCS_BYTE(crc_value, hdlc[2]);
+
         /* Step2. Send the data.  */
         /* Initialize the current packet pointer to the packet pointer.  */
         current_packet_ptr =  packet_ptr;
@@ -7969,6 +7992,9 @@ UINT        release_packet = NX_TRUE;
             /* Pickup the next byte to be sent.  */
             byte =  *buffer_ptr++;
 
+            /* Update the CRC before the byte is escaped.  */
+            crc_value = NX_PPP_FCS_BYTE(crc_value, byte);
+
             /* Determine if this byte needs an escape sequence.  */
             if ((byte < ((UCHAR) 0x20)) || (byte == 0x7e) || (byte == 0x7d))
             {
@@ -7999,8 +8025,10 @@ UINT        release_packet = NX_TRUE;
         }
 
         /* Step3. Send CRC.  */
-        /* Place a CRC at the end of the transmit buffer.  */
-         _nx_ppp_crc_append(packet_ptr, crc);
+        /* Complement the CRC value computed with the data.  */
+        crc_value = crc_value ^ 0xffff;
+        crc[0] =  (UCHAR) (crc_value & 0xff);
+        crc[1] =  (UCHAR) ((crc_value >> 8) & 0xff);
 
         /* Now send the CRC and end-of-frame bytes.  */
         for (i = 0; i < 2; i++)
@@ -8100,7 +8128,8 @@ UINT        release_packet = NX_TRUE;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */ 
+/*    [NX_PPP_FCS_BLOCK]                    User supplied CRC of a block  */
+/*    NX_PPP_FCS_BYTE                       Update the CRC with a byte    */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -8113,16 +8142,25 @@ UINT        release_packet = NX_TRUE;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     STMicroelectronics       Modified: CRC computed by     */
+/*                                            blocks when NX_PPP_FCS_     */
+/*                                            BLOCK is defined (local     */
+/*                                            patch, see st_readme.txt)   */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_ppp_check_crc(NX_PACKET *packet_ptr)
 {
 
 NX_PACKET   *current_packet_ptr;   
-UCHAR       byte;
 UCHAR       *buffer_ptr;
-USHORT      i;
 USHORT      crc_value;
+#ifdef NX_PPP_FCS_BLOCK
+ULONG       remaining;
+ULONG       length;
+#else
+UCHAR       byte;
+USHORT      i;
+#endif
    
 
     /* Set initial CRC value.  */
@@ -8134,6 +8172,51 @@ USHORT      crc_value;
     /* Setup the current packet pointer.  */
     current_packet_ptr =  packet_ptr;
 
+#ifdef NX_PPP_FCS_BLOCK
+
+    /* The CRC is computed over the frame without its start and end flags.  */
+    remaining =  0;
+    if (packet_ptr -> nx_packet_length > 2)
+    {
+        remaining =  packet_ptr -> nx_packet_length - 2;
+    }
+
+    /* Loop to process the CRC of each packet of the chain in one block.  */
+    while (remaining > 0)
+    {
+
+        /* Compute the length of the frame in the current packet.  */
+        length =  0;
+        if (buffer_ptr < current_packet_ptr -> nx_packet_append_ptr)
+        {
+            length =  (ULONG)(current_packet_ptr -> nx_packet_append_ptr - buffer_ptr);
+        }
+        if (length > remaining)
+        {
+            length =  remaining;
+        }
+
+        /* Update the CRC.  */
+        crc_value =  NX_PPP_FCS_BLOCK(crc_value, buffer_ptr, length);
+        remaining =  remaining - length;
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+
+        /* Move to the next packet.  */
+        current_packet_ptr =  current_packet_ptr -> nx_packet_next;
+
+        /* Determine if there is a next packet.  */
+        if (current_packet_ptr == NX_NULL)
+            break;
+
+        /* Setup the buffer pointer to the first byte in the next packet.  */
+        buffer_ptr =  current_packet_ptr -> nx_packet_prepend_ptr;
+#else
+        break;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+    }
+#else
+
     /* Loop to process the CRC for the receive buffer.  */
     for(i = 1; i < (packet_ptr -> nx_packet_length - 1); i++)
     {
@@ -8164,8 +8247,9 @@ USHORT      crc_value;
         byte =  *buffer_ptr++; 
 
         /* Update the CRC.  */
-        crc_value =  (( crc_value >> 8 ) ^ _nx_ppp_crc_table[ ( crc_value & 0xFF ) ^ byte ]);
+        crc_value =  NX_PPP_FCS_BYTE(crc_value, byte);
     }
+#endif /* NX_PPP_FCS_BLOCK */
 
     /* At this point, the CRC should be 0xf0b8.  */
     if (crc_value != 0xf0b8)
@@ -8210,7 +8294,8 @@ USHORT      crc_value;
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
-/*    _nx_ppp_packet_transmit               PPP packet transmit routine   */ 
+/*    None, _nx_ppp_packet_transmit computes the CRC while it escapes     */
+/*    the frame (local patch, see st_readme.txt)                          */
 /*                                                                        */ 
 /*  RELEASE HISTORY                                                       */ 
 /*                                                                        */ 
@@ -8244,8 +8329,8 @@ UCHAR       control = 0x03;
     crc_value = 0xffff;
 
     /* Step1. Calculate address and control.  */
-    crc_value = ( crc_value >> 8 ) ^ _nx_ppp_crc_table[ ( crc_value & 0xFF ) ^ address ];
-    crc_value = ( crc_value >> 8 ) ^ _nx_ppp_crc_table[ ( crc_value & 0xFF ) ^ control ];
+    crc_value = NX_PPP_FCS_BYTE(crc_value, address);
+    crc_value = NX_PPP_FCS_BYTE(crc_value, control);
 
     /* Step2. Calculate protocol, information and padding fiedls.  */
 
@@ -8288,7 +8373,7 @@ UCHAR       control = 0x03;
         byte =  *buffer_ptr++;
 
         /* Update the CRC.  */
-        crc_value = ( crc_value >> 8 ) ^ _nx_ppp_crc_table[ ( crc_value & 0xFF ) ^ byte ];
+        crc_value = NX_PPP_FCS_BYTE(crc_value, byte);
     }
 
     /* Now complement the CRC value.  */
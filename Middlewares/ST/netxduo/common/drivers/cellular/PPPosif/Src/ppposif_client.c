@@ -45,6 +45,15 @@
 #define PPPOSIF_CONFIG_TIMEOUT_VALUE 15000U
 #define PPPOSIF_CONFIG_FAIL_MAX 3
 
+/* Size of the output buffer: a PPP frame is sent to the modem in one IPC transfer when it fits in the buffer,
+   a longer frame is sent in several chunks of this size */
+#if !defined PPPOSIF_CLIENT_OUTPUT_BUFFER_SIZE
+#define PPPOSIF_CLIENT_OUTPUT_BUFFER_SIZE 256U
+#endif /* !defined PPPOSIF_CLIENT_OUTPUT_BUFFER_SIZE */
+
+/* HDLC flag sequence starting and ending each PPP frame */
+#define PPPOSIF_FRAME_FLAG ((UCHAR)0x7EU)
+
 /* Private typedef -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
@@ -53,6 +62,11 @@ static ppp_pcb      *ppp_pcb_client;
 static osTimerId     ppposif_config_timeout_timer_handle;
 static osSemaphoreId sem_ppp_init_client = NULL;
 
+/* PPP output stage: only accessed by the NX_PPP thread through ppposif_byte_output */
+static UCHAR    ppposif_output_buffer[PPPOSIF_CLIENT_OUTPUT_BUFFER_SIZE];
+static uint32_t ppposif_output_len = 0U;
+static bool     ppposif_output_in_frame = false;
+
 /* Global variables ----------------------------------------------------------*/
 
 /* Private function prototypes -----------------------------------------------*/
@@ -60,6 +74,7 @@ static void ppposif_reconf(void);
 static void ppposif_client_thread(void *argument);
 static void ppposif_config_timeout_timer_callback(void const *argument);
 
+static void ppposif_output_flush(void);
 static void ppposif_byte_output(UCHAR byte);
 static void link_up_callback(NX_PPP *ppp_ptr);
 static void link_down_callback(NX_PPP *ppp_ptr);
@@ -118,14 +133,52 @@ static void ppposif_config_timeout_timer_callback(void const *argument)
 }
 
 /**
-  * @brief  byte output routine
+  * @brief  send the bytes collected in the output buffer
   * @note   This function calls the PPPoS serial output callback
+  * @param  none
+  * @retval none
+  */
+static void ppposif_output_flush(void)
+{
+  if (ppposif_output_len != 0U)
+  {
+    (void) ppposif_output_cb(ppp_pcb_client, ppposif_output_buffer, ppposif_output_len, (void *)IPC_DEVICE);
+    ppposif_output_len = 0U;
+  }
+}
+
+/**
+  * @brief  byte output routine
+  * @note   Bytes of a PPP frame (already escaped by NX_PPP) are collected from the starting flag
+  *         up to the ending flag and sent in one IPC transfer
+  *         (or when the output buffer is full for a long frame)
+  *         Bytes out of a frame (raw data sent by NX_PPP) are sent one by one
   * @param  byte character to write
   * @retval none
   */
 static void ppposif_byte_output(UCHAR byte)
 {
-  (void) ppposif_output_cb(ppp_pcb_client, &byte, sizeof(byte), (void *)IPC_DEVICE);
+  if ((ppposif_output_in_frame == false) && (byte != PPPOSIF_FRAME_FLAG))
+  {
+    /* Not a PPP frame: no end known, send byte immediately */
+    (void) ppposif_output_cb(ppp_pcb_client, &byte, sizeof(byte), (void *)IPC_DEVICE);
+  }
+  else
+  {
+    ppposif_output_buffer[ppposif_output_len] = byte;
+    ppposif_output_len++;
+
+    if (byte == PPPOSIF_FRAME_FLAG)
+    {
+      /* Starting flag opens the frame, ending flag closes it: NX_PPP never sends an empty frame */
+      ppposif_output_in_frame = !ppposif_output_in_frame;
+    }
+
+    if ((ppposif_output_in_frame == false) || (ppposif_output_len == PPPOSIF_CLIENT_OUTPUT_BUFFER_SIZE))
+    {
+      ppposif_output_flush();
+    }
+  }
 }
 
 /**
@@ -251,6 +304,10 @@ ppposif_status_t ppposif_client_config(void)
   PRINT_PPPOSIF("ppposif_client_config")
   ppposif_ipc_select(IPC_DEVICE);
 
+  /* New PPP session: discard a frame not completed by the previous one */
+  ppposif_output_len = 0U;
+  ppposif_output_in_frame = false;
+
   if (ppposif_create_done == 0U)
   {
     ppp_pcb_client = &ppp_0;
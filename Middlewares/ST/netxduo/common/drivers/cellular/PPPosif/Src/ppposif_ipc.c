@@ -99,12 +99,14 @@ void ppposif_ipc_init(IPC_Device_t pDevice)
   ppposif_ipc_ctx[pDevice].sndSemaphoreFlag  = 0U;
   ppposif_ipc_ctx[pDevice].TransmitOnGoing   = 0U;
 
+  /* binary semaphore: signaled by IPC when data arrives in an empty stream buffer */
   ppposif_ipc_ctx[pDevice].rcvSemaphore = rtosalSemaphoreNew((const rtosal_char_t *) "SEM_UART_RCV",
-                                                             (uint16_t) 10000U);
+                                                             (uint16_t) 1U);
   if (ppposif_ipc_ctx[pDevice].rcvSemaphore == NULL)
   {
     ERROR_Handler(DBG_CHAN_PPPOSIF, 11, ERROR_FATAL);
   }
+  (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
 
   ppposif_ipc_ctx[pDevice].sndSemaphore = rtosalSemaphoreNew((const rtosal_char_t *) "SEM_UART_SND",
                                                              (uint16_t) 1U);
@@ -150,9 +152,14 @@ int16_t ppposif_ipc_read(IPC_Device_t pDevice, u8_t *buff, int16_t size)
   ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 2U;
   (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
   ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 0U;
-  __disable_irq();
   (void)IPC_streamReceive(ppposif_ipc_ctx[pDevice].ipcHandle, buff, &size);
-  __enable_irq();
+
+  /* IPC only signals the stream buffer going from empty to not empty: keep the semaphore signaled while data
+     remains. Checked after the read index update, so data received meanwhile is signaled here or by IPC */
+  if (IPC_streamAvailable(ppposif_ipc_ctx[pDevice].ipcHandle) != 0U)
+  {
+    (void)rtosalSemaphoreRelease(ppposif_ipc_ctx[pDevice].rcvSemaphore);
+  }
 
   return size;
 }
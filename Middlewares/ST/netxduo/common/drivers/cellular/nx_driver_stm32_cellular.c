@@ -46,6 +46,12 @@
 #define NX_DRIVER_THREAD_INTERVAL               10
 #endif /* NX_DRIVER_THREAD_INTERVAL */
 
+/* Maximum time in ms the driver thread waits for a data received notification. It also bounds the delay before a
+   socket connected during the wait is polled. The default value is NX_DRIVER_THREAD_INTERVAL converted in ms.  */
+#ifndef NX_DRIVER_POLL_TIMEOUT
+#define NX_DRIVER_POLL_TIMEOUT                  ((NX_DRIVER_THREAD_INTERVAL * 1000) / NX_IP_PERIODIC_RATE)
+#endif /* NX_DRIVER_POLL_TIMEOUT */
+
 /* Define the maximum sockets at the same time.  */
 #ifndef NX_DRIVER_SOCKETS_MAXIMUM
 #define NX_DRIVER_SOCKETS_MAXIMUM               16
@@ -87,6 +93,9 @@ typedef struct NX_DRIVER_SOCKET_STRUCT
 
 static NX_DRIVER_INFORMATION nx_driver_information;
 static NX_DRIVER_SOCKET nx_driver_sockets[NX_DRIVER_SOCKETS_MAXIMUM];
+/* Snapshot of the driver sockets and poll set used by the driver thread outside of the IP mutex.  */
+static NX_DRIVER_SOCKET nx_driver_poll_sockets[NX_DRIVER_SOCKETS_MAXIMUM];
+static com_pollfd_t nx_driver_poll_fds[NX_DRIVER_SOCKETS_MAXIMUM];
 static TX_THREAD nx_driver_thread;
 static UCHAR nx_driver_thread_stack[NX_DRIVER_STACK_SIZE];
 
@@ -106,6 +115,7 @@ static VOID         _nx_driver_capability_set(NX_IP_DRIVER *driver_req_ptr);
 #endif /* NX_ENABLE_INTERFACE_CAPABILITY */
 static VOID         _nx_driver_deferred_processing(NX_IP_DRIVER *driver_req_ptr);
 static VOID         _nx_driver_thread_entry(ULONG thread_input);
+static UINT         _nx_driver_socket_is_unchanged(UINT index, const NX_DRIVER_SOCKET *snapshot_ptr);
 static UINT         _nx_driver_tcpip_handler(struct NX_IP_STRUCT *ip_ptr,
                                              struct NX_INTERFACE_STRUCT *interface_ptr,
                                              VOID *socket_ptr, UINT operation, NX_PACKET *packet_ptr,
@@ -936,8 +946,10 @@ static VOID  _nx_driver_deferred_processing(NX_IP_DRIVER *driver_req_ptr)
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function is the driver thread entry. In this thread, it        */
-/*    performs checking for incoming TCP and UDP packets. On new packet,  */
-/*    it will be passed to NetX.                                          */
+/*    waits for data received notifications of the connected sockets     */
+/*    and reads only the sockets with pending data. On new packet, it     */
+/*    will be passed to NetX. The IP mutex is not held during the modem   */
+/*    I/O, only while the sockets are listed and packets are delivered.   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -952,6 +964,8 @@ static VOID  _nx_driver_deferred_processing(NX_IP_DRIVER *driver_req_ptr)
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*    tx_thread_sleep                       Sleep driver thread           */
+/*    com_poll                              Wait for socket readiness     */
+/*    com_recvfrom                          Read data from the modem      */
 /*    nx_packet_allocate                    Allocate a packet for incoming*/
 /*                                            TCP and UDP data            */
 /*    _nx_tcp_socket_driver_packet_receive  Receive TCP packet            */
@@ -966,6 +980,8 @@ static VOID  _nx_driver_deferred_processing(NX_IP_DRIVER *driver_req_ptr)
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  xx-xx-xxxx     Yuxin Zhou               Initial Version 6.x           */
+/*  17-10-2026     STMicrolectronics.       Wait on socket readiness      */
+/*                                          instead of periodic polling   */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_driver_thread_entry(ULONG thread_input)
@@ -979,6 +995,7 @@ static VOID _nx_driver_thread_entry(ULONG thread_input)
   int ret;
   com_sockaddr_in_t remote_addr;
   int data_length;
+  NX_DRIVER_SOCKET *socket_ptr;
   NX_IP *ip_ptr = nx_driver_information.nx_driver_information_ip_ptr;
   NX_INTERFACE *interface_ptr = nx_driver_information.nx_driver_information_interface;
   NX_PACKET_POOL *pool_ptr = nx_driver_information.nx_driver_information_packet_pool_ptr;
@@ -988,12 +1005,19 @@ static VOID _nx_driver_thread_entry(ULONG thread_input)
   for (;;)
   {
 
-    /* Obtain the IP internal mutex before processing the IP event.  */
+    /* Obtain the IP internal mutex to list the sockets to poll.  */
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
     /* Loop through TCP socket.  */
     for (i = 0; i < NX_DRIVER_SOCKETS_MAXIMUM; i++)
     {
+
+      /* Socket not polled by default.  */
+      nx_driver_poll_fds[i].fd = -1;
+      nx_driver_poll_fds[i].events = 0;
+      nx_driver_poll_fds[i].revents = 0;
+      nx_driver_poll_sockets[i] = nx_driver_sockets[i];
+
       if (nx_driver_sockets[i].socket_ptr == NX_NULL)
       {
 
@@ -1009,78 +1033,110 @@ static VOID _nx_driver_thread_entry(ULONG thread_input)
         continue;
       }
 
-      /* Set packet type.  */
-      if (nx_driver_sockets[i].protocol == NX_PROTOCOL_TCP)
+      if ((nx_driver_sockets[i].protocol == NX_PROTOCOL_TCP) &&
+          (nx_driver_sockets[i].tcp_connected == NX_FALSE))
       {
-        packet_type = NX_TCP_PACKET;
-        if ((nx_driver_sockets[i].tcp_connected == NX_FALSE) &&
-            (nx_driver_sockets[i].is_client == NX_FALSE))
+        if (nx_driver_sockets[i].is_client == NX_FALSE)
         {
 
           /* TCP server. Try accept. */
-          if (_nx_tcp_socket_driver_establish(nx_driver_sockets[i].socket_ptr, interface_ptr, 0))
-          {
-
-            /* NetX TCP socket is not ready to accept. Just sleep to avoid starving.  */
-            tx_thread_sleep(NX_DRIVER_THREAD_INTERVAL);
-            continue;
-          }
+          (VOID)_nx_tcp_socket_driver_establish(nx_driver_sockets[i].socket_ptr, interface_ptr, 0);
         }
+
+        /* TCP socket disconnected.  */
+        continue;
+      }
+
+      nx_driver_poll_fds[i].fd = nx_driver_sockets[i].socket_fd;
+      nx_driver_poll_fds[i].events = COM_POLLIN;
+    }
+
+    /* Release the IP internal mutex before waiting for the modem.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Wait for data received or closure notification on one of the sockets. On timeout no socket is ready and
+       the socket list is refreshed.  */
+    if (com_poll(nx_driver_poll_fds, NX_DRIVER_SOCKETS_MAXIMUM, NX_DRIVER_POLL_TIMEOUT) < 0)
+    {
+
+      /* Poll not available (e.g. already used by another thread). Fall back to a periodic read of all sockets.  */
+      tx_thread_sleep(NX_DRIVER_THREAD_INTERVAL);
+      for (i = 0; i < NX_DRIVER_SOCKETS_MAXIMUM; i++)
+      {
+        nx_driver_poll_fds[i].revents = (nx_driver_poll_fds[i].fd < 0) ? 0 : COM_POLLIN;
       }
-      else
+    }
+
+    /* Loop through the sockets with pending data or event.  */
+    for (i = 0; i < NX_DRIVER_SOCKETS_MAXIMUM; i++)
+    {
+      if (nx_driver_poll_fds[i].revents == 0)
       {
-        packet_type = NX_UDP_PACKET;
+
+        /* Skip sockets not ready.  */
+        continue;
       }
 
+      socket_ptr = &nx_driver_poll_sockets[i];
+
+      /* Set packet type.  */
+      packet_type = (socket_ptr -> protocol == NX_PROTOCOL_TCP) ? NX_TCP_PACKET : NX_UDP_PACKET;
+
       /* Loop to receive all data on current socket.  */
       for (;;)
       {
-        if ((nx_driver_sockets[i].protocol == NX_PROTOCOL_TCP) &&
-            (nx_driver_sockets[i].tcp_connected == NX_FALSE))
-        {
-
-          /* TCP socket disconnected.  */
-          break;
-        }
-
         if (nx_packet_allocate(pool_ptr, &packet_ptr, packet_type, NX_NO_WAIT))
         {
 
-          /* Packet not available.  */
+          /* Packet not available. The socket stays ready, sleep to let NetX release packets.  */
+          tx_thread_sleep(NX_DRIVER_THREAD_INTERVAL);
           break;
         }
 
         /* Get available size of packet.  */
         data_length = (int)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_prepend_ptr);
 
-        /* Receive data. */
+        /* Receive data. The IP mutex is not held: reading from the modem takes several AT transactions.  */
         addrlen = sizeof(remote_addr);
-        ret = com_recvfrom(nx_driver_sockets[i].socket_fd,
+        ret = com_recvfrom(socket_ptr -> socket_fd,
                            (com_char_t *)packet_ptr -> nx_packet_prepend_ptr, data_length, COM_MSG_DONTWAIT,
                            (com_sockaddr_t *)&remote_addr, &addrlen);
 
+        if (ret == 0)
+        {
+
+          /* No incoming data.  */
+          nx_packet_release(packet_ptr);
+          break;
+        }
+
+        /* Obtain the IP internal mutex before passing the result to NetX.  */
+        tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+        if (_nx_driver_socket_is_unchanged(i, socket_ptr) == NX_FALSE)
+        {
+
+          /* Socket disconnected or released by NetX during the receive. Drop the data.  */
+          tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+          nx_packet_release(packet_ptr);
+          break;
+        }
+
         if (ret < 0)
         {
 
           /* Connection error. Notify upper layer with Null packet.  */
-          if (nx_driver_sockets[i].protocol == NX_PROTOCOL_TCP)
+          if (socket_ptr -> protocol == NX_PROTOCOL_TCP)
           {
-            _nx_tcp_socket_driver_packet_receive(nx_driver_sockets[i].socket_ptr, NX_NULL);
+            _nx_tcp_socket_driver_packet_receive(socket_ptr -> socket_ptr, NX_NULL);
             nx_driver_sockets[i].tcp_connected = NX_FALSE;
           }
           else
           {
-            _nx_udp_socket_driver_packet_receive(nx_driver_sockets[i].socket_ptr, NX_NULL,
+            _nx_udp_socket_driver_packet_receive(socket_ptr -> socket_ptr, NX_NULL,
                                                  NX_NULL, NX_NULL, 0);
           }
-          nx_packet_release(packet_ptr);
-          break;
-        }
-
-        if (ret == 0)
-        {
-
-          /* No incoming data.  */
+          tx_mutex_put(&(ip_ptr -> nx_ip_protection));
           nx_packet_release(packet_ptr);
           break;
         }
@@ -1091,9 +1147,9 @@ static VOID _nx_driver_thread_entry(ULONG thread_input)
         packet_ptr -> nx_packet_ip_interface = interface_ptr;
 
         /* Pass it to NetXDuo.  */
-        if (nx_driver_sockets[i].protocol == NX_PROTOCOL_TCP)
+        if (socket_ptr -> protocol == NX_PROTOCOL_TCP)
         {
-          _nx_tcp_socket_driver_packet_receive(nx_driver_sockets[i].socket_ptr, packet_ptr);
+          _nx_tcp_socket_driver_packet_receive(socket_ptr -> socket_ptr, packet_ptr);
         }
         else
         {
@@ -1104,19 +1160,43 @@ static VOID _nx_driver_thread_entry(ULONG thread_input)
           local_ip.nxd_ip_version = NX_IP_VERSION_V4;
           local_ip.nxd_ip_address.v4 = interface_ptr -> nx_interface_ip_address;
 
-          _nx_udp_socket_driver_packet_receive(nx_driver_sockets[i].socket_ptr,
+          _nx_udp_socket_driver_packet_receive(socket_ptr -> socket_ptr,
                                                packet_ptr, &local_ip, &remote_ip,
                                                COM_NTOHS(remote_addr.sin_port));
         }
+
+        /* Release the IP internal mutex before the next receive.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
       }
     }
+  }
+}
 
-    /* Release the IP internal mutex before processing the IP event.  */
-    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
-    /* Sleep some ticks to next loop.  */
-    tx_thread_sleep(NX_DRIVER_THREAD_INTERVAL);
+/**
+  * @brief  Check that a driver socket was not released or disconnected since it was polled
+  * @note   Must be called with the IP internal mutex held
+  * @author MCD Application Team - STMicroelectonics.
+  * @param  input: index          - index of the driver socket
+  * @param  input: snapshot_ptr   - copy of the driver socket done before the poll
+  * @retval NX_TRUE if the socket is still the polled one - NX_FALSE otherwise
+  */
+static UINT _nx_driver_socket_is_unchanged(UINT index, const NX_DRIVER_SOCKET *snapshot_ptr)
+{
+  UINT result = NX_FALSE;
+
+  if ((nx_driver_sockets[index].socket_ptr == snapshot_ptr -> socket_ptr) &&
+      (nx_driver_sockets[index].socket_fd == snapshot_ptr -> socket_fd) &&
+      (nx_driver_sockets[index].protocol == snapshot_ptr -> protocol))
+  {
+    if ((nx_driver_sockets[index].protocol != NX_PROTOCOL_TCP) ||
+        (nx_driver_sockets[index].tcp_connected == NX_TRUE))
+    {
+      result = NX_TRUE;
+    }
   }
+
+  return (result);
 }
 
 
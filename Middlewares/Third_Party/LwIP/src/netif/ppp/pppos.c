@@ -93,7 +93,13 @@ static const struct link_callbacks pppos_callbacks = {
  * to select the specific bit for a character. */
 #define ESCAPE_P(accm, c) ((accm)[(c) >> 3] & 1 << (c & 0x07))
 
-#if PPP_FCS_TABLE
+#if defined(PPPOS_FCS_BYTE)
+/*
+ * STMicroelectronics local patch (see st_readme.txt): FCS update provided
+ * by the platform in lwipopts.h, e.g. the table shared with other PPP stacks.
+ */
+#define PPP_FCS(fcs, c) PPPOS_FCS_BYTE(fcs, c)
+#elif PPP_FCS_TABLE
 /*
  * FCS lookup table as calculated by genfcstab.
  */
@@ -147,7 +153,7 @@ ppp_get_fcs(u8_t byte)
   return octet & 0xffff;
 }
 #define PPP_FCS(fcs, c) (((fcs) >> 8) ^ ppp_get_fcs(((fcs) ^ (c)) & 0xff))
-#endif /* PPP_FCS_TABLE */
+#endif /* PPPOS_FCS_BYTE, PPP_FCS_TABLE */
 
 /*
  * Values for FCS calculations.
@@ -48,6 +48,18 @@ extern "C" {
 #define CMD_THREAD_PRIO                    osPriorityBelowNormal
 #endif /* USE_CMD_CONSOLE == 1 */
 
+#if (TRACE_IF_BINARY == 1U)
+#define TRACE_IF_THREAD_PRIO               osPriorityLow
+#endif /* TRACE_IF_BINARY == 1U */
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_RCV_CACHE == 1U)
+#define COM_RCV_CACHE_THREAD_PRIO          osPriorityBelowNormal
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_RCV_CACHE == 1U) */
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_SND_QUEUE == 1U)
+#define COM_SND_QUEUE_THREAD_PRIO          osPriorityBelowNormal
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_SND_QUEUE == 1U) */
+
 /* ========================*/
 /* END - Stack Priority    */
 /* ========================*/
@@ -84,6 +96,30 @@ extern "C" {
 #define CMD_THREAD_NB                       (0U)
 #endif /* USE_CMD_CONSOLE == 1 */
 
+#if (TRACE_IF_BINARY == 1U)
+#define TRACE_IF_THREAD_STACK_SIZE          (384U)
+#define TRACE_IF_THREAD_NB                  (1U)
+#else  /* TRACE_IF_BINARY == 0U */
+#define TRACE_IF_THREAD_STACK_SIZE          (0U)
+#define TRACE_IF_THREAD_NB                  (0U)
+#endif /* TRACE_IF_BINARY == 1U */
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_RCV_CACHE == 1U)
+#define COM_RCV_CACHE_THREAD_STACK_SIZE     (384U)
+#define COM_RCV_CACHE_THREAD_NB             (1U)
+#else  /* (USE_SOCKETS_TYPE != USE_SOCKETS_MODEM) || (COM_SOCKETS_RCV_CACHE == 0U) */
+#define COM_RCV_CACHE_THREAD_STACK_SIZE     (0U)
+#define COM_RCV_CACHE_THREAD_NB             (0U)
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_RCV_CACHE == 1U) */
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_SND_QUEUE == 1U)
+#define COM_SND_QUEUE_THREAD_STACK_SIZE     (384U)
+#define COM_SND_QUEUE_THREAD_NB             (1U)
+#else  /* (USE_SOCKETS_TYPE != USE_SOCKETS_MODEM) || (COM_SOCKETS_SND_QUEUE == 0U) */
+#define COM_SND_QUEUE_THREAD_STACK_SIZE     (0U)
+#define COM_SND_QUEUE_THREAD_NB             (0U)
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (COM_SOCKETS_SND_QUEUE == 1U) */
+
 #if !defined APPLICATION_THREAD_STACK_SIZE
 #define APPLICATION_THREAD_STACK_SIZE       (0U)
 #endif /* !defined APPLICATION_THREAD_STACK_SIZE */
@@ -108,6 +144,9 @@ extern "C" {
   (size_t)( ATCORE_THREAD_STACK_SIZE               \
             +CELLULAR_SERVICE_THREAD_STACK_SIZE    \
             +CMD_THREAD_STACK_SIZE                 \
+            +TRACE_IF_THREAD_STACK_SIZE            \
+            +COM_RCV_CACHE_THREAD_STACK_SIZE       \
+            +COM_SND_QUEUE_THREAD_STACK_SIZE       \
             +TCPIP_THREAD_STACK_SIZE               \
             +PPPOSIF_CLIENT_THREAD_STACK_SIZE      )
 
@@ -115,6 +154,9 @@ extern "C" {
   (uint8_t)( ATCORE_THREAD_NB                      \
              +CELLULAR_SERVICE_THREAD_NB           \
              +CMD_THREAD_NB                        \
+             +TRACE_IF_THREAD_NB                   \
+             +COM_RCV_CACHE_THREAD_NB              \
+             +COM_SND_QUEUE_THREAD_NB              \
              +TCPIP_THREAD_NB                      \
              +PPPOSIF_CLIENT_THREAD_NB             )
 
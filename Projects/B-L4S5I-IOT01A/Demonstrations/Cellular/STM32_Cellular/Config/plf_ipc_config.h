@@ -52,6 +52,16 @@ extern "C" {
 #define IPC_USE_SPI  (0U) /* SPI NOT SUPPORTED YET */
 #define IPC_USE_I2C  (0U) /* I2C NOT SUPPORTED YET */
 
+/* IPC RX mode per device:
+ * - IPC_RX_MODE_IT  : one UART interrupt per received character
+ * - IPC_RX_MODE_DMA : DMA with idle-line detection, received spans are handed to the RX FIFO
+ *                     (modem UART RX DMA channel has to be configured in circular mode)
+ * IPC_RX_MODE_DMA on UART4 requires to add the UART4_RX DMA request (circular mode) in prj_NBIOT_L4S5I.ioc
+ * and to regenerate the project: not validated on this board, otherwise IPC_open fails (no RX DMA channel).
+ */
+#define IPC_RX_MODE_DEVICE_0   IPC_RX_MODE_IT
+#define IPC_RXDMA_BUFFER_SIZE  ((uint16_t) 256U) /* circular RX DMA buffer size (used in IPC_RX_MODE_DMA) */
+
 /* Debug flags */
 #define DBG_IPC_RX_FIFO  (0U)             /* additional debug infos */
 #define DBG_QUEUE_SIZE ((uint16_t) 1000U) /* debug message history depth */
@@ -21,6 +21,7 @@
 
 #include "ipc_uart.h"
 #include "at_modem_api.h"
+#include "trace_interface.h"
 
 #if (USE_CMD_CONSOLE == 1)
 #include "cmd.h"
@@ -90,6 +91,17 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
   {
     IPC_UART_TxCpltCallback(huart);
   }
+#if (TRACE_IF_TX_ASYNC == 1U)
+  else if (huart->Instance == TRACE_INTERFACE_INSTANCE)
+  {
+    traceIF_uartTxCpltCallback(huart);
+  }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
 }
 
 /**
@@ -103,5 +115,32 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
   {
     IPC_UART_ErrorCallback(huart);
   }
+#if (TRACE_IF_TX_ASYNC == 1U)
+  else if (huart->Instance == TRACE_INTERFACE_INSTANCE)
+  {
+    traceIF_uartErrorCallback(huart);
+  }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+}
+
+#if (IPC_USE_RX_DMA == 1U)
+/**
+  * @brief  Callback to treat UART Rx event (DMA half/complete transfer, idle line)
+  * @param  huart - pointer on UART handle
+  * @param  Size - position in reception buffer
+  * @retval -
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  if (huart->Instance == MODEM_UART_INSTANCE)
+  {
+    IPC_UART_RxEventCallback(huart, Size);
+  }
 }
+#endif /* IPC_USE_RX_DMA == 1U */
 
@@ -56,6 +56,26 @@ extern "C" {
 #define COM_SOCKETS_STATISTIC               (1U) /* 0: not activated, 1: activated */
 #endif /* !defined COM_SOCKETS_STATISTIC */
 
+/* If COM_SOCKETS_RCV_CACHE activated then for USE_SOCKETS_TYPE == USE_SOCKETS_MODEM
+   TCP data are read from the modem as soon as the data ready URC is received
+   and stored in a per-socket cache; com_recv is then served from RAM */
+#if !defined COM_SOCKETS_RCV_CACHE
+#define COM_SOCKETS_RCV_CACHE               (0U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_RCV_CACHE */
+
+/* If COM_SOCKETS_SND_QUEUE activated then for USE_SOCKETS_TYPE == USE_SOCKETS_MODEM
+   com_send on a TCP socket copies the data in a per-socket queue and returns;
+   the queues are sent to the modem back-to-back by a dedicated thread */
+#if !defined COM_SOCKETS_SND_QUEUE
+#define COM_SOCKETS_SND_QUEUE               (0U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_SND_QUEUE */
+
+/* If COM_SOCKETS_DNS_CACHE activated then com_gethostbyname results are kept in a cache:
+   a host name already resolved is answered without access to the modem or to the network */
+#if !defined COM_SOCKETS_DNS_CACHE
+#define COM_SOCKETS_DNS_CACHE               (0U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_DNS_CACHE */
+
 /* ======================= */
 /* END - Miscellaneous     */
 /* ======================= */
@@ -74,6 +94,8 @@ extern "C" {
 /* Trace channels: UART or Printf */
 #define TRACE_IF_TRACES_UART                (1U) /* trace_interface module send traces to UART */
 #define USE_PRINTF                          (0U) /* if set to 1, use printf instead of trace_interface module */
+#define TRACE_IF_BINARY                     (0U) /* if set to 1, traces are sent in binary format: use trace_decoder.py */
+#define TRACE_IF_TX_ASYNC                   (0U) /* if set to 1, traces are sent on UART in background */
 
 /* Trace masks allowed */
 /* by default: P0, WARN and ERROR traces only */
@@ -108,6 +130,8 @@ extern "C" {
 /* Trace channels: UART or Printf */
 #define TRACE_IF_TRACES_UART                (1U) /* trace_interface module send traces to UART */
 #define USE_PRINTF                          (0U) /* if set to 1, use printf instead of trace_interface module */
+#define TRACE_IF_BINARY                     (0U) /* if set to 1, traces are sent in binary format: use trace_decoder.py */
+#define TRACE_IF_TX_ASYNC                   (0U) /* if set to 1, traces are sent on UART in background */
 
 /* Trace masks allowed */
 #define TRACE_IF_MASK             (uint16_t)(0U) /* no trace except the one using PRINT_FORCE */
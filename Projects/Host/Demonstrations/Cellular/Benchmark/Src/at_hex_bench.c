@@ -0,0 +1,266 @@
+/**
+  ******************************************************************************
+  * @file    at_hex_bench.c
+  * @author  MCD Application Team
+  * @brief   Cycle count benchmark of the AT_Core hex codec (at_util.c) against
+  *          the byte per byte conversion it replaced in the TYPE1SC driver
+  *          (convertCharToHEX / convertHEXToChar), on a socket payload.
+  *
+  *          at_hex_bench [-n loops] [-s size]
+  *
+  *          Both conversions have to give the same result, else the benchmark
+  *          fails.
+  *
+  * @note    Counts are read from DWT->CYCCNT: CPU cycles on the target,
+  *          nanoseconds of the monotonic clock on the host.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "main.h"
+#include "at_util.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_HEX_SIZE_MAX  (1500U) /* TYPE1SC %SOCKETDATA maximum payload */
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t bench_data[BENCH_HEX_SIZE_MAX];
+static uint8_t bench_str_ref[2U * BENCH_HEX_SIZE_MAX];
+static uint8_t bench_str[2U * BENCH_HEX_SIZE_MAX];
+static uint8_t bench_data_ref[BENCH_HEX_SIZE_MAX];
+static uint8_t bench_data_out[BENCH_HEX_SIZE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t bench_convertToASCII(uint8_t nbr);
+static void bench_convertCharToHEX(uint8_t val, uint8_t *p_msd, uint8_t *p_lsd);
+static uint8_t bench_convertDigitToValue(uint8_t digit, uint8_t *p_res);
+static uint8_t bench_convertHEXToChar(uint8_t msd, uint8_t lsd, uint8_t *p_conv);
+static void bench_encode_bytewise(const uint8_t *p_src, uint16_t src_size, uint8_t *p_dst);
+static uint8_t bench_decode_bytewise(const uint8_t *p_src, uint16_t dst_size, uint8_t *p_dst);
+
+/* Private functions ---------------------------------------------------------*/
+/* Byte per byte conversion of the TYPE1SC driver before the AT_Core codec */
+/**
+  * @brief  Convert a number to its ASCII value.
+  * @param  nbr Number to convert.
+  * @retval corresponding ASCII value.
+  */
+static uint8_t bench_convertToASCII(uint8_t nbr)
+{
+  uint8_t ascii;
+
+  if (nbr <= 9U)
+  {
+    ascii = nbr + 48U;
+  }
+  else
+  {
+    ascii = nbr + 87U; /* 87 = 97 -10 (where 97 correspond to 'a') */
+  }
+  return (ascii);
+}
+
+/**
+  * @brief  Convert a character to its HEX value
+  *         for example 'A' is converted to '65' where msd='6' and lsd='5'
+  * @param  val Character to convert.
+  * @param  p_msd ptr to Most significant Digit of HEX value
+  * @param  p_lsd ptr to Less significant Digit of HEX value
+  * @retval none.
+  */
+static void bench_convertCharToHEX(uint8_t val, uint8_t *p_msd, uint8_t *p_lsd)
+{
+  *p_msd = bench_convertToASCII(val / 16U);
+  *p_lsd = bench_convertToASCII(val % 16U);
+}
+
+/**
+  * @brief  Convert an hexa number (from 0 to F) to its ASCII value
+  * @param  digit Value to convert.
+  * @param  p_res ptr to converted value.
+  * @retval 1 if digit is an hexa digit, 0 else.
+  */
+static uint8_t bench_convertDigitToValue(uint8_t digit, uint8_t *p_res)
+{
+  uint8_t retval = 1U;
+
+  if ((digit >= 48U) && (digit <= 57U))
+  {
+    /* 0 to 9 */
+    *p_res = digit - 48U;
+  }
+  else if ((digit >= 97U) && (digit <= 102U))
+  {
+    /* a to f */
+    *p_res = digit - 87U; /* 87 = -97+10 */
+  }
+  else if ((digit >= 65U) && (digit <= 70U))
+  {
+    /* A to F */
+    *p_res = digit - 55U; /* 55 = -65+10*/
+  }
+  else
+  {
+    *p_res = 0;
+    retval = 0U;
+  }
+  return (retval);
+}
+
+/**
+  * @brief  Convert a HEX to its Char value
+  *         for example '65' (where msd='6' and lsd='5') is converted to 'A'
+  * @param  msd Most significant Digit of HEX value .
+  * @param  lsd Less significant Digit of HEX value.
+  * @param  p_conv ptr to converted Character value.
+  * @retval 1 if both digits are hexa digits, 0 else.
+  */
+static uint8_t bench_convertHEXToChar(uint8_t msd, uint8_t lsd, uint8_t *p_conv)
+{
+  uint8_t retval = 0U;
+  uint8_t convMSD;
+  uint8_t convLSD;
+
+  if ((bench_convertDigitToValue(msd, &convMSD) == 1U) && (bench_convertDigitToValue(lsd, &convLSD) == 1U))
+  {
+    *p_conv = (uint8_t)((convMSD << 4) + convLSD);
+    retval = 1U;
+  }
+  return (retval);
+}
+
+/**
+  * @brief  Encode a buffer as the TYPE1SC driver did: one character and two 1-byte copies at a time.
+  * @param  p_src ptr to the buffer to convert.
+  * @param  src_size size of the buffer to convert.
+  * @param  p_dst ptr to the string (2 * src_size characters).
+  * @retval none.
+  */
+static void bench_encode_bytewise(const uint8_t *p_src, uint16_t src_size, uint8_t *p_dst)
+{
+  uint8_t ms;
+  uint8_t ls;
+
+  for (uint32_t i = 0U; i < src_size; i++)
+  {
+    bench_convertCharToHEX(p_src[i], &ms, &ls);
+    (void) memcpy((void *)&p_dst[2U * i], (const void *)&ms, 1U);
+    (void) memcpy((void *)&p_dst[(2U * i) + 1U], (const void *)&ls, 1U);
+  }
+}
+
+/**
+  * @brief  Decode a string as the TYPE1SC driver did: one character at a time, stop on the first invalid digit.
+  * @param  p_src ptr to the string (2 * dst_size digits).
+  * @param  dst_size size of the converted buffer.
+  * @param  p_dst ptr to the converted buffer.
+  * @retval 1 if all characters are hexadecimal digits, 0 else.
+  */
+static uint8_t bench_decode_bytewise(const uint8_t *p_src, uint16_t dst_size, uint8_t *p_dst)
+{
+  uint8_t retval = 1U;
+
+  for (uint32_t i = 0U; (i < dst_size) && (retval == 1U); i++)
+  {
+    retval = bench_convertHEXToChar(p_src[2U * i], p_src[(2U * i) + 1U], &p_dst[i]);
+  }
+  return (retval);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  uint32_t loops = 1000U;
+  uint16_t size = BENCH_HEX_SIZE_MAX;
+  uint32_t cycles_enc_bytewise = 0U;
+  uint32_t cycles_enc_table = 0U;
+  uint32_t cycles_dec_bytewise = 0U;
+  uint32_t cycles_dec_table = 0U;
+  uint32_t start;
+  volatile uint8_t valid = 1U; /* volatile: keep the decodings in the measured code */
+  int ret = EXIT_SUCCESS;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:s:")) != -1)
+  {
+    switch (option)
+    {
+      case 'n':
+        loops = (uint32_t)strtoul(optarg, NULL, 10);
+        loops = (loops != 0U) ? loops : 1U;
+        break;
+      case 's':
+        size = (uint16_t)strtoul(optarg, NULL, 10);
+        size = ((size != 0U) && (size <= BENCH_HEX_SIZE_MAX)) ? size : BENCH_HEX_SIZE_MAX;
+        break;
+      default:
+        (void)fprintf(stderr, "usage: %s [-n loops] [-s size]\n", argv[0]);
+        ret = EXIT_FAILURE;
+        break;
+    }
+  }
+
+  if (ret == EXIT_SUCCESS)
+  {
+    /* enable cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    srandom(14U);
+    for (uint32_t i = 0U; i < size; i++)
+    {
+      bench_data[i] = (uint8_t)(random() & 0xFFU);
+    }
+
+    for (uint32_t loop = 0U; loop < loops; loop++)
+    {
+      start = DWT->CYCCNT;
+      bench_encode_bytewise(bench_data, size, bench_str_ref);
+      cycles_enc_bytewise += DWT->CYCCNT - start;
+
+      start = DWT->CYCCNT;
+      ATutil_convertBufferToHexaString(bench_data, size, bench_str);
+      cycles_enc_table += DWT->CYCCNT - start;
+
+      start = DWT->CYCCNT;
+      valid &= bench_decode_bytewise(bench_str_ref, size, bench_data_ref);
+      cycles_dec_bytewise += DWT->CYCCNT - start;
+
+      start = DWT->CYCCNT;
+      valid &= ATutil_convertHexaStringToBuffer(bench_str_ref, size, bench_data_out);
+      cycles_dec_table += DWT->CYCCNT - start;
+    }
+
+    if ((valid != 1U)
+        || (memcmp(bench_str, bench_str_ref, 2U * (size_t)size) != 0)
+        || (memcmp(bench_data_out, bench_data_ref, size) != 0)
+        || (memcmp(bench_data_out, bench_data, size) != 0))
+    {
+      (void)printf("at_hex_bench: conversion mismatch\n");
+      ret = EXIT_FAILURE;
+    }
+
+    (void)printf("at_hex_bench: %u loops of %u bytes (counts per loop)\n", loops, size);
+    (void)printf("at_hex_bench: encode bytewise=%u table=%u\n",
+                 cycles_enc_bytewise / loops, cycles_enc_table / loops);
+    (void)printf("at_hex_bench: decode bytewise=%u table=%u\n",
+                 cycles_dec_bytewise / loops, cycles_dec_table / loops);
+  }
+
+  return (ret);
+}
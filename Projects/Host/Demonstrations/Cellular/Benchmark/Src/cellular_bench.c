@@ -0,0 +1,375 @@
+/**
+  ******************************************************************************
+  * @file    cellular_bench.c
+  * @author  MCD Application Team
+  * @brief   Host cellular benchmark: TCP echo round trip latency (percentiles)
+  *          and streaming throughput through com_sockets, the AT core and the
+  *          IPC, on the modem simulator (or on the tty given by HOST_MODEM_TTY).
+  *
+  *          cellular_bench [-n round_trips] [-s size] [-t stream_bytes] [-c contending_threads]
+  *
+  *          With -c, the round trips compete for the modem with threads polling
+  *          the signal quality (AT+CSQ) in a loop: the latency percentiles of
+  *          both show how the cellular service serializes the AT transactions.
+  *
+  * @note    Durations are real (wall clock) times, whatever RTOSAL_POSIX_TIME_SCALE.
+  *          The simulator latency is set by HOST_MODEM_SIM_LATENCY (us).
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host_cellular.h"
+#include "com_sockets.h"
+#include "cellular_service_os.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_DATA_READY_TIMEOUT  (180000U) /* ms */
+#define BENCH_RCV_TIMEOUT         (10000U)  /* ms */
+#define BENCH_ECHO_PORT           (7U)
+#define BENCH_BUFFER_SIZE         (4096U)
+#define BENCH_ROUND_TRIPS_MAX     (10000U)
+#define BENCH_CONTENDERS_MAX      (8U)
+
+/* Private variables ---------------------------------------------------------*/
+static com_char_t bench_snd_buf[BENCH_BUFFER_SIZE];
+static com_char_t bench_rcv_buf[BENCH_BUFFER_SIZE];
+static uint32_t bench_latency_us[BENCH_ROUND_TRIPS_MAX];
+
+/* Contending threads: signal quality polling */
+static pthread_mutex_t bench_contention_lock = PTHREAD_MUTEX_INITIALIZER;
+static volatile bool bench_contention_stop;
+static uint32_t bench_contention_us[BENCH_ROUND_TRIPS_MAX];
+static uint32_t bench_contention_nb;
+static uint32_t bench_contention_errors;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t bench_now_us(void);
+static int bench_compare(const void *p_a, const void *p_b);
+static void bench_print_percentiles(const char *p_label, uint32_t *p_latency_us, uint32_t nb);
+static void *bench_contention_thread(void *p_arg);
+static int32_t bench_connect(void);
+static int32_t bench_receive(int32_t sock, int32_t size);
+static int32_t bench_round_trips(int32_t sock, uint32_t round_trips, int32_t size);
+static int32_t bench_stream(int32_t sock, uint32_t total);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Monotonic real time.
+  * @retval uint64_t - time in us.
+  */
+static uint64_t bench_now_us(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (((uint64_t)now.tv_sec * 1000000U) + ((uint64_t)now.tv_nsec / 1000U));
+}
+
+/**
+  * @brief  qsort comparison of two latencies.
+  */
+static int bench_compare(const void *p_a, const void *p_b)
+{
+  uint32_t a = *(const uint32_t *)p_a;
+  uint32_t b = *(const uint32_t *)p_b;
+
+  return ((a > b) ? 1 : ((a < b) ? -1 : 0));
+}
+
+/**
+  * @brief  Sort latencies and print their percentiles.
+  * @param  p_label      - label of the measure.
+  * @param  p_latency_us - latencies in us (sorted on return).
+  * @param  nb           - number of latencies.
+  * @retval -
+  */
+static void bench_print_percentiles(const char *p_label, uint32_t *p_latency_us, uint32_t nb)
+{
+  uint64_t total_us = 0U;
+
+  if (nb != 0U)
+  {
+    qsort(p_latency_us, nb, sizeof(p_latency_us[0]), bench_compare);
+    for (uint32_t i = 0U; i < nb; i++)
+    {
+      total_us += p_latency_us[i];
+    }
+    (void)printf("bench: %s x %u: avg %u us, p50 %u us, p90 %u us, p99 %u us, max %u us\n",
+                 p_label, nb, (uint32_t)(total_us / nb), p_latency_us[(nb * 50U) / 100U],
+                 p_latency_us[(nb * 90U) / 100U], p_latency_us[(nb * 99U) / 100U], p_latency_us[nb - 1U]);
+  }
+}
+
+/**
+  * @brief  Contending thread: poll the signal quality (one AT transaction each) until stopped.
+  * @retval NULL.
+  */
+static void *bench_contention_thread(void *p_arg)
+{
+  CS_SignalQuality_t sig_qual;
+
+  (void)p_arg;
+  while (bench_contention_stop == false)
+  {
+    uint64_t start = bench_now_us();
+    CS_Status_t status = osCS_get_signal_quality(&sig_qual);
+    uint32_t latency_us = (uint32_t)(bench_now_us() - start);
+
+    (void)pthread_mutex_lock(&bench_contention_lock);
+    if (status != CELLULAR_OK)
+    {
+      bench_contention_errors++;
+    }
+    else if (bench_contention_nb < BENCH_ROUND_TRIPS_MAX)
+    {
+      bench_contention_us[bench_contention_nb] = latency_us;
+      bench_contention_nb++;
+    }
+    else
+    {
+      /* enough samples */
+    }
+    (void)pthread_mutex_unlock(&bench_contention_lock);
+  }
+
+  return (NULL);
+}
+
+/**
+  * @brief  Open a TCP socket to the echo server.
+  * @retval int32_t - socket, -1 on error.
+  */
+static int32_t bench_connect(void)
+{
+  com_sockaddr_in_t address;
+  uint32_t timeout = BENCH_RCV_TIMEOUT;
+  int32_t sock = com_socket(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+
+  if (sock >= 0)
+  {
+    (void)com_setsockopt(sock, COM_SOL_SOCKET, COM_SO_RCVTIMEO, &timeout, (int32_t)sizeof(timeout));
+    (void)memset(&address, 0, sizeof(address));
+    address.sin_family = (uint8_t)COM_AF_INET;
+    address.sin_port = COM_HTONS(BENCH_ECHO_PORT);
+    address.sin_addr.s_addr = COM_HTONL(0x0A000001U); /* 10.0.0.1 */
+    if (com_connect(sock, (com_sockaddr_t const *)&address, (int32_t)sizeof(com_sockaddr_in_t))
+        != COM_SOCKETS_ERR_OK)
+    {
+      (void)com_closesocket(sock);
+      sock = -1;
+    }
+  }
+
+  return (sock);
+}
+
+/**
+  * @brief  Receive exactly size bytes.
+  * @retval int32_t - 0 if received, -1 otherwise.
+  */
+static int32_t bench_receive(int32_t sock, int32_t size)
+{
+  int32_t received = 0;
+  int32_t ret = 0;
+
+  while ((ret == 0) && (received < size))
+  {
+    int32_t len = com_recv(sock, &bench_rcv_buf[received], size - received, COM_MSG_WAIT);
+    if (len > 0)
+    {
+      received += len;
+    }
+    else
+    {
+      ret = -1;
+    }
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  Round trip latency: send size bytes, wait for their echo, round_trips times.
+  * @retval int32_t - 0 if all the echoes match, -1 otherwise.
+  */
+static int32_t bench_round_trips(int32_t sock, uint32_t round_trips, int32_t size)
+{
+  char label[48];
+  uint32_t done = 0U;
+  int32_t ret = 0;
+
+  for (uint32_t i = 0U; (i < round_trips) && (ret == 0); i++)
+  {
+    uint64_t start;
+    for (int32_t j = 0; j < size; j++)
+    {
+      bench_snd_buf[j] = (com_char_t)(i + (uint32_t)j);
+    }
+    start = bench_now_us();
+    if ((com_send(sock, bench_snd_buf, size, COM_MSG_WAIT) != size)
+        || (bench_receive(sock, size) != 0)
+        || (memcmp(bench_snd_buf, bench_rcv_buf, (size_t)size) != 0))
+    {
+      ret = -1;
+    }
+    else
+    {
+      bench_latency_us[i] = (uint32_t)(bench_now_us() - start);
+      done++;
+    }
+  }
+
+  (void)snprintf(label, sizeof(label), "round trip %ld bytes", (long)size);
+  bench_print_percentiles(label, bench_latency_us, done);
+
+  return (ret);
+}
+
+/**
+  * @brief  Streaming throughput: send total bytes by buffers, the echo being read after each buffer.
+  * @retval int32_t - 0 if all the data are echoed, -1 otherwise.
+  */
+static int32_t bench_stream(int32_t sock, uint32_t total)
+{
+  uint64_t start = bench_now_us();
+  uint64_t duration_us;
+  uint32_t done = 0U;
+  int32_t ret = 0;
+
+  while ((done < total) && (ret == 0))
+  {
+    int32_t size = (int32_t)(((total - done) < BENCH_BUFFER_SIZE) ? (total - done) : BENCH_BUFFER_SIZE);
+    if ((com_send(sock, bench_snd_buf, size, COM_MSG_WAIT) != size) || (bench_receive(sock, size) != 0))
+    {
+      ret = -1;
+    }
+    else
+    {
+      done += (uint32_t)size;
+    }
+  }
+
+  duration_us = bench_now_us() - start;
+  duration_us = (duration_us != 0U) ? duration_us : 1U;
+  (void)printf("bench: stream %u bytes in %u ms: %u bytes/s (each way)\n", done, (uint32_t)(duration_us / 1000U),
+               (uint32_t)(((uint64_t)done * 1000000U) / duration_us));
+
+  return (ret);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  uint32_t round_trips = 100U;
+  int32_t size = 64;
+  uint32_t stream_bytes = 65536U;
+  uint32_t contenders = 0U;
+  pthread_t contention_threads[BENCH_CONTENDERS_MAX];
+  int ret = EXIT_SUCCESS;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:s:t:c:")) != -1)
+  {
+    switch (option)
+    {
+      case 'n':
+        round_trips = (uint32_t)strtoul(optarg, NULL, 10);
+        round_trips = (round_trips < BENCH_ROUND_TRIPS_MAX) ? round_trips : BENCH_ROUND_TRIPS_MAX;
+        break;
+      case 's':
+        size = (int32_t)strtol(optarg, NULL, 10);
+        size = ((size > 0) && (size <= (int32_t)BENCH_BUFFER_SIZE)) ? size : 64;
+        break;
+      case 't':
+        stream_bytes = (uint32_t)strtoul(optarg, NULL, 10);
+        break;
+      case 'c':
+        contenders = (uint32_t)strtoul(optarg, NULL, 10);
+        contenders = (contenders < BENCH_CONTENDERS_MAX) ? contenders : BENCH_CONTENDERS_MAX;
+        break;
+      default:
+        (void)fprintf(stderr, "usage: %s [-n round_trips] [-s size] [-t stream_bytes] [-c contending_threads]\n",
+                      argv[0]);
+        ret = EXIT_FAILURE;
+        break;
+    }
+  }
+
+  if (ret != EXIT_SUCCESS)
+  {
+    /* usage error */
+  }
+  else if (HOST_Cellular_Start() != 0)
+  {
+    (void)printf("bench: cellular start failed\n");
+    ret = EXIT_FAILURE;
+  }
+  else if (HOST_Cellular_WaitDataReady(BENCH_DATA_READY_TIMEOUT) == false)
+  {
+    (void)printf("bench: network not ready\n");
+    ret = EXIT_FAILURE;
+  }
+  else
+  {
+    int32_t sock = bench_connect();
+    uint32_t started = 0U;
+
+    bench_contention_stop = false;
+    while ((sock >= 0) && (started < contenders)
+           && (pthread_create(&contention_threads[started], NULL, bench_contention_thread, NULL) == 0))
+    {
+      started++;
+    }
+    if ((sock < 0) || (started != contenders) || (bench_round_trips(sock, round_trips, size) != 0))
+    {
+      (void)printf("bench: echo failed\n");
+      ret = EXIT_FAILURE;
+    }
+    bench_contention_stop = true;
+    for (uint32_t i = 0U; i < started; i++)
+    {
+      (void)pthread_join(contention_threads[i], NULL);
+    }
+    if (started != 0U)
+    {
+      char label[48];
+      (void)snprintf(label, sizeof(label), "signal quality (%u threads)", started);
+      bench_print_percentiles(label, bench_contention_us, bench_contention_nb);
+      if (bench_contention_errors != 0U)
+      {
+        (void)printf("bench: signal quality failed %u times\n", bench_contention_errors);
+        ret = EXIT_FAILURE;
+      }
+    }
+    if ((ret == EXIT_SUCCESS) && (stream_bytes != 0U) && (bench_stream(sock, stream_bytes) != 0))
+    {
+      (void)printf("bench: echo failed\n");
+      ret = EXIT_FAILURE;
+    }
+    if (sock >= 0)
+    {
+      (void)com_closesocket(sock);
+    }
+  }
+
+  return (ret);
+}
@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * @file    host_board.h
+  * @author  MCD Application Team
+  * @brief   Host board services: board init and connection of the emulated
+  *          UARTs / GPIOs to file descriptors, terminals and simulators.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_BOARD_H
+#define HOST_BOARD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Environment variable: path of the tty (e.g a PTY of modem_sim or a real modem) of the modem UART */
+#define HOST_MODEM_TTY_ENV   "HOST_MODEM_TTY"
+
+/* Exported types ------------------------------------------------------------*/
+typedef void (*HOST_GPIO_WriteHook_t)(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState, void *p_arg);
+
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Initialize the host board: HAL, UARTs (trace UART on standard output, modem UART) and RNG.
+  * @retval -
+  */
+void HOST_Board_Init(void);
+
+/**
+  * @brief  Connect the modem UART to a tty (raw mode) given by path.
+  * @param  p_path - tty path, e.g /dev/ttyUSB0 or the PTY printed by modem_sim.
+  * @retval int - 0 if connected, -1 otherwise.
+  */
+int HOST_Board_ConnectModemTty(const char *p_path);
+
+/**
+  * @brief  Connect the emulated UART to file descriptors.
+  * @note   An "ISR" thread reads fd_rx and raises the HAL UART callbacks under emulated IT.
+  *         When the reception is not armed (or DMA paused) data are held back, as with RTS/CTS.
+  * @param  huart - UART handle (HAL_UART_Init may be called before or after).
+  * @param  fd_rx - file descriptor to receive from, -1 if none.
+  * @param  fd_tx - file descriptor to transmit to, -1 to discard the transmitted data.
+  * @retval -
+  */
+void HOST_UART_Attach(UART_HandleTypeDef *huart, int fd_rx, int fd_tx);
+
+/**
+  * @brief  Register the hook called on each GPIO write (e.g modem power key).
+  * @param  hook  - hook, NULL to remove it.
+  * @param  p_arg - argument passed to the hook.
+  * @retval -
+  */
+void HOST_GPIO_SetWriteHook(HOST_GPIO_WriteHook_t hook, void *p_arg);
+
+/**
+  * @brief  Drive an input pin, raising its EXTI callback (under emulated IT) on a change.
+  * @param  GPIOx    - GPIO port.
+  * @param  GPIO_Pin - pin.
+  * @param  PinState - new state.
+  * @retval -
+  */
+void HOST_GPIO_SetInput(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_BOARD_H */
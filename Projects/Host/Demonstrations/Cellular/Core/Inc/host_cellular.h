@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * @file    host_cellular.h
+  * @author  MCD Application Team
+  * @brief   Header for host_cellular.c: start of the cellular middleware on the
+  *          host, on a real modem (tty) or on the modem simulator.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_CELLULAR_H
+#define HOST_CELLULAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "modem_sim.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Environment variables */
+#define HOST_MODEM_SIM_SCRIPT_ENV   "HOST_MODEM_SIM_SCRIPT"   /* simulator script path            */
+#define HOST_MODEM_SIM_LATENCY_ENV  "HOST_MODEM_SIM_LATENCY"  /* simulator answer latency in us   */
+
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Initialize the host board and start the cellular middleware.
+  * @note   Without HOST_MODEM_TTY_ENV, the modem UART is connected to an in-process simulator
+  *         of the modem the program is built for (socketpair).
+  * @retval int32_t - 0 if started, -1 otherwise.
+  */
+int32_t HOST_Cellular_Start(void);
+
+/**
+  * @brief  Wait until the network interface is up (IP address received).
+  * @param  timeout_ms - timeout in ms (rtosal time base).
+  * @retval bool - true if data are ready.
+  */
+bool HOST_Cellular_WaitDataReady(uint32_t timeout_ms);
+
+/**
+  * @brief  Get the in-process simulator.
+  * @retval modem_sim_t * - simulator, NULL if a tty is used.
+  */
+modem_sim_t *HOST_Cellular_GetSimulator(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_CELLULAR_H */
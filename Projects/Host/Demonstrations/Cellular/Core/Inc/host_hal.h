@@ -0,0 +1,408 @@
+/**
+  ******************************************************************************
+  * @file    host_hal.h
+  * @author  MCD Application Team
+  * @brief   Host emulation of the STM32 HAL and CMSIS-Core services used by
+  *          X-Cube-Cellular, to build and run the middleware on a POSIX host.
+  * @note    Only the subset referenced by the middleware, the modem drivers
+  *          and the board glue is provided. Behaviors that matter for the
+  *          middleware are emulated:
+  *          - interrupts: UART callbacks run in one "ISR" thread per UART and
+  *            __disable_irq() / PRIMASK hold them off (global lock),
+  *          - UART: see host_uart.c (IT and DMA receive-to-idle, flow control),
+  *          - CRC: bit level model of the configurable polynomial CRC unit,
+  *          - DWT->CYCCNT counts nanoseconds of the monotonic clock.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define __IO    volatile
+
+#define HAL_MAX_DELAY      0xFFFFFFFFU
+
+/* GPIO */
+#define GPIO_PIN_0                 ((uint16_t)0x0001)
+#define GPIO_PIN_1                 ((uint16_t)0x0002)
+#define GPIO_PIN_2                 ((uint16_t)0x0004)
+#define GPIO_PIN_3                 ((uint16_t)0x0008)
+#define GPIO_PIN_4                 ((uint16_t)0x0010)
+#define GPIO_PIN_5                 ((uint16_t)0x0020)
+#define GPIO_PIN_6                 ((uint16_t)0x0040)
+#define GPIO_PIN_7                 ((uint16_t)0x0080)
+#define GPIO_PIN_8                 ((uint16_t)0x0100)
+#define GPIO_PIN_9                 ((uint16_t)0x0200)
+#define GPIO_PIN_10                ((uint16_t)0x0400)
+#define GPIO_PIN_11                ((uint16_t)0x0800)
+#define GPIO_PIN_12                ((uint16_t)0x1000)
+#define GPIO_PIN_13                ((uint16_t)0x2000)
+#define GPIO_PIN_14                ((uint16_t)0x4000)
+#define GPIO_PIN_15                ((uint16_t)0x8000)
+
+#define GPIO_MODE_INPUT            (0x00000000U)
+#define GPIO_MODE_OUTPUT_PP        (0x00000001U)
+#define GPIO_MODE_OUTPUT_OD        (0x00000011U)
+#define GPIO_MODE_AF_PP            (0x00000002U)
+#define GPIO_MODE_ANALOG           (0x00000003U)
+#define GPIO_MODE_IT_RISING        (0x10110000U)
+#define GPIO_MODE_IT_FALLING       (0x10210000U)
+#define GPIO_MODE_IT_RISING_FALLING (0x10310000U)
+
+#define GPIO_NOPULL                (0x00000000U)
+#define GPIO_PULLUP                (0x00000001U)
+#define GPIO_PULLDOWN              (0x00000002U)
+
+#define GPIO_SPEED_FREQ_LOW        (0x00000000U)
+#define GPIO_SPEED_FREQ_MEDIUM     (0x00000001U)
+#define GPIO_SPEED_FREQ_HIGH       (0x00000002U)
+#define GPIO_SPEED_FREQ_VERY_HIGH  (0x00000003U)
+
+/* UART */
+#define UART_WORDLENGTH_8B         (0x00000000U)
+#define UART_STOPBITS_1            (0x00000000U)
+#define UART_PARITY_NONE           (0x00000000U)
+#define UART_MODE_TX_RX            (0x0000000CU)
+#define UART_HWCONTROL_NONE        (0x00000000U)
+#define UART_HWCONTROL_RTS_CTS     (0x00000300U)
+#define UART_OVERSAMPLING_16       (0x00000000U)
+#define UART_ONE_BIT_SAMPLE_DISABLE (0x00000000U)
+#define UART_ADVFEATURE_NO_INIT    (0x00000000U)
+#define UART_PRESCALER_DIV1        (0x00000000U)
+
+#define HAL_UART_RECEPTION_STANDARD   (0x00000000U)
+#define HAL_UART_RECEPTION_TOIDLE     (0x00000001U)
+
+/* DMA */
+#define DMA_NORMAL                 (0x00000000U)
+#define DMA_CIRCULAR               (0x00000020U)
+
+/* CRC */
+#define DEFAULT_POLYNOMIAL_ENABLE  ((uint8_t)0x00U)
+#define DEFAULT_POLYNOMIAL_DISABLE ((uint8_t)0x01U)
+#define DEFAULT_INIT_VALUE_ENABLE  ((uint8_t)0x00U)
+#define DEFAULT_INIT_VALUE_DISABLE ((uint8_t)0x01U)
+#define CRC_POLYLENGTH_32B         (0x00000000U)
+#define CRC_POLYLENGTH_16B         (0x00000008U)
+#define CRC_POLYLENGTH_8B          (0x00000010U)
+#define CRC_POLYLENGTH_7B          (0x00000018U)
+#define CRC_INPUTDATA_INVERSION_NONE    (0x00000000U)
+#define CRC_INPUTDATA_INVERSION_BYTE    (0x00000020U)
+#define CRC_OUTPUTDATA_INVERSION_DISABLE (0x00000000U)
+#define CRC_OUTPUTDATA_INVERSION_ENABLE (0x00000080U)
+#define CRC_INPUTDATA_FORMAT_BYTES (0x00000001U)
+
+/* DWT */
+#define DWT_CTRL_CYCCNTENA_Msk     (0x00000001U)
+#define CoreDebug_DEMCR_TRCENA_Msk (0x01000000U)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  USART1_IRQn              = 37,
+  USART2_IRQn              = 38,
+  USART3_IRQn              = 39,
+  EXTI15_10_IRQn           = 40,
+  DMA1_Channel3_IRQn       = 13
+} IRQn_Type;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+  __IO uint32_t ODR;
+  __IO uint32_t IDR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef struct
+{
+  uint32_t id;
+} USART_TypeDef;
+
+typedef struct
+{
+  uint32_t id;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  uint32_t Request;
+  uint32_t Direction;
+  uint32_t Mode;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+  DMA_Channel_TypeDef *Instance;
+  DMA_InitTypeDef      Init;
+  void                *Parent;
+} DMA_HandleTypeDef;
+
+typedef enum
+{
+  HAL_UART_STATE_RESET      = 0x00U,
+  HAL_UART_STATE_READY      = 0x20U,
+  HAL_UART_STATE_BUSY       = 0x24U,
+  HAL_UART_STATE_BUSY_TX    = 0x21U,
+  HAL_UART_STATE_BUSY_RX    = 0x22U,
+  HAL_UART_STATE_BUSY_TX_RX = 0x23U,
+  HAL_UART_STATE_ERROR      = 0xE0U
+} HAL_UART_StateTypeDef;
+
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+  uint32_t OverSampling;
+  uint32_t OneBitSampling;
+  uint32_t ClockPrescaler;
+} UART_InitTypeDef;
+
+typedef struct
+{
+  uint32_t AdvFeatureInit;
+} UART_AdvFeatureInitTypeDef;
+
+struct host_uart_port;
+
+typedef struct __UART_HandleTypeDef
+{
+  USART_TypeDef              *Instance;
+  UART_InitTypeDef            Init;
+  UART_AdvFeatureInitTypeDef  AdvancedInit;
+  uint8_t                    *pTxBuffPtr;
+  uint16_t                    TxXferSize;
+  uint8_t                    *pRxBuffPtr;
+  uint16_t                    RxXferSize;
+  __IO uint16_t               RxXferCount;
+  __IO uint32_t               ReceptionType;
+  DMA_HandleTypeDef          *hdmatx;
+  DMA_HandleTypeDef          *hdmarx;
+  __IO HAL_UART_StateTypeDef  gState;
+  __IO HAL_UART_StateTypeDef  RxState;
+  __IO uint32_t               ErrorCode;
+  struct host_uart_port      *p_port;  /* host emulation, see host_uart.c */
+} UART_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t id;
+} RNG_TypeDef;
+
+typedef struct
+{
+  RNG_TypeDef *Instance;
+} RNG_HandleTypeDef;
+
+typedef struct
+{
+  __IO uint32_t DR;
+  __IO uint32_t INIT;
+  __IO uint32_t POL;
+  __IO uint32_t CR;
+} CRC_TypeDef;
+
+typedef struct
+{
+  uint8_t  DefaultPolynomialUse;
+  uint8_t  DefaultInitValueUse;
+  uint32_t GeneratingPolynomial;
+  uint32_t CRCLength;
+  uint32_t InitValue;
+  uint32_t InputDataInversionMode;
+  uint32_t OutputDataInversionMode;
+} CRC_InitTypeDef;
+
+typedef struct
+{
+  CRC_TypeDef     *Instance;
+  CRC_InitTypeDef  Init;
+  uint32_t         InputDataFormat;
+} CRC_HandleTypeDef;
+
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+/* External variables --------------------------------------------------------*/
+extern GPIO_TypeDef host_gpio_ports[8];
+extern USART_TypeDef host_usart_instances[3];
+extern DMA_Channel_TypeDef host_dma_channels[1];
+extern RNG_TypeDef host_rng_instance;
+extern CRC_TypeDef host_crc_instance;
+extern CoreDebug_Type host_core_debug;
+extern uint32_t SystemCoreClock;
+
+/* Exported macros -----------------------------------------------------------*/
+#define UNUSED(X) (void)(X)
+
+#define GPIOA   (&host_gpio_ports[0])
+#define GPIOB   (&host_gpio_ports[1])
+#define GPIOC   (&host_gpio_ports[2])
+#define GPIOD   (&host_gpio_ports[3])
+#define GPIOE   (&host_gpio_ports[4])
+#define GPIOF   (&host_gpio_ports[5])
+#define GPIOG   (&host_gpio_ports[6])
+#define GPIOH   (&host_gpio_ports[7])
+
+#define USART1  (&host_usart_instances[0])
+#define USART2  (&host_usart_instances[1])
+#define USART3  (&host_usart_instances[2])
+
+#define DMA1_Channel3 (&host_dma_channels[0])
+
+#define RNG     (&host_rng_instance)
+
+#define CRC     (&host_crc_instance)
+#define __HAL_CRC_INITIALCRCVALUE_CONFIG(__HANDLE__, __INIT__) ((__HANDLE__)->Instance->INIT = (__INIT__))
+
+/* DWT->CYCCNT is refreshed from the monotonic clock (1 count = 1 ns) on each access */
+#define DWT        (host_dwt_update())
+#define CoreDebug  (&host_core_debug)
+
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) \
+  do{                                                                \
+    (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__);             \
+    (__DMA_HANDLE__).Parent = (__HANDLE__);                          \
+  } while(0U)
+
+/* CMSIS-Core intrinsics */
+#define __NOP()     __asm__ volatile ("" ::: "memory")
+#define __DMB()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __CLZ(x)    (((x) == 0U) ? 32U : (uint8_t)__builtin_clz(x))
+
+/* Exported functions ------------------------------------------------------- */
+/* Interrupt masking: global "interrupt" lock shared with the emulated ISRs */
+void     __disable_irq(void);
+void     __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t priMask);
+void     NVIC_SystemReset(void);
+
+/* Exclusive access emulation: __STREXW succeeds only if *addr still holds the value read by __LDREXW */
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+void     __CLREX(void);
+
+/**
+  * @brief  Quad 8-bit unsigned saturating subtraction (DSP extension), for tests of the DSP code paths.
+  * @param  op1 - first operand.
+  * @param  op2 - second operand.
+  * @retval uint32_t - per byte max(op1 - op2, 0).
+  */
+static inline uint32_t __UQSUB8(uint32_t op1, uint32_t op2)
+{
+  uint32_t result = 0U;
+  for (uint32_t shift = 0U; shift < 32U; shift += 8U)
+  {
+    uint32_t a = (op1 >> shift) & 0xFFU;
+    uint32_t b = (op2 >> shift) & 0xFFU;
+    result |= ((a > b) ? (a - b) : 0U) << shift;
+  }
+  return result;
+}
+
+DWT_Type *host_dwt_update(void);
+
+/* Emulated ISR context: used by the UART and EXTI emulations */
+void host_irq_enter(void);
+void host_irq_exit(void);
+
+HAL_StatusTypeDef HAL_Init(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(const GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+HAL_StatusTypeDef HAL_RNG_GenerateRandomNumber(RNG_HandleTypeDef *hrng, uint32_t *random32bit);
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                    uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart);
+void HAL_UART_MspInit(UART_HandleTypeDef *huart);
+void HAL_UART_MspDeInit(UART_HandleTypeDef *huart);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_HAL_H */
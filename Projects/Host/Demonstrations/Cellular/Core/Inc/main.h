@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @file           : main.h
+  * @brief          : Header for main.c file.
+  *                   This file contains the common defines of the host application.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+void Error_Handler(void);
+
+/* Private defines -----------------------------------------------------------*/
+/* Same modem pin mapping as B-L462E-CELL1: drivers only write/read them */
+#define MDM_PWR_EN_OUT_Pin GPIO_PIN_7
+#define MDM_PWR_EN_OUT_GPIO_Port GPIOB
+#define MDM_RST_OUT_Pin GPIO_PIN_0
+#define MDM_RST_OUT_GPIO_Port GPIOC
+#define MDM_DTR_OUT_Pin GPIO_PIN_8
+#define MDM_DTR_OUT_GPIO_Port GPIOC
+#define MDM_SIM_SELECT_0_OUT_Pin GPIO_PIN_1
+#define MDM_SIM_SELECT_0_OUT_GPIO_Port GPIOC
+#define MDM_SIM_SELECT_1_OUT_Pin GPIO_PIN_2
+#define MDM_SIM_SELECT_1_OUT_GPIO_Port GPIOC
+#define MDM_UART_RTS_Pin GPIO_PIN_2
+#define MDM_UART_RTS_GPIO_Port GPIOD
+#define MDM_UART_CTS_Pin GPIO_PIN_13
+#define MDM_UART_CTS_GPIO_Port GPIOB
+#define MDM_UART_TX_Pin GPIO_PIN_4
+#define MDM_UART_TX_GPIO_Port GPIOC
+#define MDM_UART_RX_Pin GPIO_PIN_5
+#define MDM_UART_RX_GPIO_Port GPIOC
+#define MDM_RING_Pin GPIO_PIN_12
+#define MDM_RING_GPIO_Port GPIOB
+#define MDM_RING_EXTI_IRQn EXTI15_10_IRQn
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file    host_board.c
+  * @author  MCD Application Team
+  * @brief   Host board: initialization of the emulated peripherals and
+  *          connection of the modem UART to a tty.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "host_board.h"
+#include "main.h"
+#include "usart.h"
+#include "rng.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private defines -----------------------------------------------------------*/
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Initialize the host board: HAL, UARTs (trace UART on standard output, modem UART) and RNG.
+  * @note   The modem UART is connected to the tty given by HOST_MODEM_TTY_ENV if defined.
+  * @retval -
+  */
+void HOST_Board_Init(void)
+{
+  const char *p_tty;
+
+  (void)HAL_Init();
+  MX_USART1_UART_Init();
+  MX_USART3_UART_Init();
+  MX_RNG_Init();
+
+  /* an idle UART line is high: some modems are detected ready on their RX line */
+  HOST_GPIO_SetInput(MDM_UART_RX_GPIO_Port, MDM_UART_RX_Pin, GPIO_PIN_SET);
+
+  p_tty = getenv(HOST_MODEM_TTY_ENV);
+  if (p_tty != NULL)
+  {
+    if (HOST_Board_ConnectModemTty(p_tty) != 0)
+    {
+      (void)fprintf(stderr, "host board: cannot open modem tty %s\n", p_tty);
+    }
+  }
+}
+
+/**
+  * @brief  Connect the modem UART to a tty (raw mode) given by path.
+  * @param  p_path - tty path, e.g /dev/ttyUSB0 or the PTY printed by modem_sim.
+  * @retval int - 0 if connected, -1 otherwise.
+  */
+int HOST_Board_ConnectModemTty(const char *p_path)
+{
+  int ret = -1;
+  int fd = open(p_path, O_RDWR | O_NOCTTY);
+
+  if (fd >= 0)
+  {
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0)
+    {
+      cfmakeraw(&tio);
+      (void)cfsetspeed(&tio, B115200);
+      (void)tcsetattr(fd, TCSANOW, &tio);
+    }
+    HOST_UART_Attach(&huart3, fd, fd);
+    ret = 0;
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval -
+  */
+void Error_Handler(void)
+{
+  (void)fprintf(stderr, "\n\rError_Handler: host program stopped\n\r");
+  exit(EXIT_FAILURE);
+}
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    host_cellular.c
+  * @author  MCD Application Team
+  * @brief   Start of the cellular middleware on the host, on a real modem (tty)
+  *          or on the modem simulator.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+
+#include "host_cellular.h"
+#include "host_board.h"
+#include "usart.h"
+#include "rtosal.h"
+#include "cellular_control_api.h"
+
+/* Private defines -----------------------------------------------------------*/
+/* Modem simulated when no tty is given: the modem the program is built for */
+#if !defined(HOST_MODEM_SIM_MODEL)
+#define HOST_MODEM_SIM_MODEL   MODEM_SIM_BG96
+#endif /* !defined(HOST_MODEM_SIM_MODEL) */
+
+#define HOST_CELLULAR_POLL_PERIOD  (100U) /* data ready polling period in ms */
+
+/* Private variables ---------------------------------------------------------*/
+static modem_sim_t *p_host_modem_sim;
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Initialize the host board and start the cellular middleware.
+  * @retval int32_t - 0 if started, -1 otherwise.
+  */
+int32_t HOST_Cellular_Start(void)
+{
+  int32_t ret = 0;
+
+  HOST_Board_Init();
+
+  if (getenv(HOST_MODEM_TTY_ENV) == NULL)
+  {
+    int fds[2];
+    const char *p_script = getenv(HOST_MODEM_SIM_SCRIPT_ENV);
+    const char *p_latency = getenv(HOST_MODEM_SIM_LATENCY_ENV);
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    {
+      ret = -1;
+    }
+    else
+    {
+      p_host_modem_sim = modem_sim_create(HOST_MODEM_SIM_MODEL, fds[1]);
+      if ((p_host_modem_sim == NULL)
+          || ((p_script != NULL) && (modem_sim_load_script(p_host_modem_sim, p_script) != 0)))
+      {
+        ret = -1;
+      }
+      else
+      {
+        if (p_latency != NULL)
+        {
+          modem_sim_set_latency(p_host_modem_sim, (uint32_t)strtoul(p_latency, NULL, 10));
+        }
+        ret = modem_sim_start(p_host_modem_sim);
+        HOST_UART_Attach(&huart3, fds[0], fds[0]);
+      }
+    }
+  }
+
+  if (ret == 0)
+  {
+    cellular_init();
+    cellular_start();
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  Wait until the network interface is up (IP address received).
+  * @param  timeout_ms - timeout in ms (rtosal time base).
+  * @retval bool - true if data are ready.
+  */
+bool HOST_Cellular_WaitDataReady(uint32_t timeout_ms)
+{
+  cellular_ip_info_t ip_info;
+  uint32_t start = rtosalGetSysTimerCount();
+  bool ready = false;
+
+  while ((ready == false) && ((rtosalGetSysTimerCount() - start) < timeout_ms))
+  {
+    cellular_get_ip_info(&ip_info);
+    if (ip_info.ip_addr.addr != 0U)
+    {
+      ready = true;
+    }
+    else
+    {
+      (void)rtosalDelay(HOST_CELLULAR_POLL_PERIOD);
+    }
+  }
+
+  return (ready);
+}
+
+/**
+  * @brief  Get the in-process simulator.
+  * @retval modem_sim_t * - simulator, NULL if a tty is used.
+  */
+modem_sim_t *HOST_Cellular_GetSimulator(void)
+{
+  return (p_host_modem_sim);
+}
@@ -0,0 +1,521 @@
+/**
+  ******************************************************************************
+  * @file    host_hal.c
+  * @author  MCD Application Team
+  * @brief   Host emulation of the STM32 HAL and CMSIS-Core services:
+  *          interrupt masking, tick, GPIO, NVIC, RNG and DWT.
+  *          UART emulation is in host_uart.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "host_hal.h"
+#include "host_board.h"
+#include "rtosal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private defines -----------------------------------------------------------*/
+#define HOST_GPIO_PORT_NB   (sizeof(host_gpio_ports) / sizeof(host_gpio_ports[0]))
+
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Global "interrupt" lock: held by a thread with PRIMASK set and by the emulated ISRs */
+static pthread_mutex_t host_irq_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread bool host_irq_masked;
+static __thread bool host_irq_in_isr;
+
+/* Exclusive monitor emulation */
+static __thread volatile uint32_t *p_host_excl_addr;
+static __thread uint32_t host_excl_value;
+
+/* Pins configured in EXTI mode, per port */
+static uint16_t host_gpio_exti_mask[8];
+static HOST_GPIO_WriteHook_t host_gpio_write_hook;
+static void *p_host_gpio_write_hook_arg;
+
+static DWT_Type host_dwt;
+static bool host_rng_seeded;
+
+/* Global variables ----------------------------------------------------------*/
+GPIO_TypeDef host_gpio_ports[8];
+USART_TypeDef host_usart_instances[3] = {{1U}, {2U}, {3U}};
+DMA_Channel_TypeDef host_dma_channels[1] = {{3U}};
+RNG_TypeDef host_rng_instance = {1U};
+CRC_TypeDef host_crc_instance;
+CoreDebug_Type host_core_debug;
+uint32_t SystemCoreClock = 1000000000U; /* DWT->CYCCNT counts ns: 1 GHz core clock */
+
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+/******************************** CMSIS-Core **********************************/
+/**
+  * @brief  Mask interrupts: emulated ISRs are held off until __enable_irq().
+  * @retval -
+  */
+void __disable_irq(void)
+{
+  if ((host_irq_in_isr == false) && (host_irq_masked == false))
+  {
+    (void)pthread_mutex_lock(&host_irq_lock);
+    host_irq_masked = true;
+  }
+}
+
+/**
+  * @brief  Unmask interrupts.
+  * @retval -
+  */
+void __enable_irq(void)
+{
+  if ((host_irq_in_isr == false) && (host_irq_masked == true))
+  {
+    host_irq_masked = false;
+    (void)pthread_mutex_unlock(&host_irq_lock);
+  }
+}
+
+/**
+  * @brief  Get PRIMASK of the calling thread.
+  * @retval uint32_t - 1 if interrupts are masked (or in an emulated ISR), 0 otherwise.
+  */
+uint32_t __get_PRIMASK(void)
+{
+  return (((host_irq_masked == true) || (host_irq_in_isr == true)) ? 1U : 0U);
+}
+
+/**
+  * @brief  Set PRIMASK of the calling thread.
+  * @param  priMask - 1 to mask interrupts, 0 to unmask them.
+  * @retval -
+  */
+void __set_PRIMASK(uint32_t priMask)
+{
+  if (priMask != 0U)
+  {
+    __disable_irq();
+  }
+  else
+  {
+    __enable_irq();
+  }
+}
+
+/**
+  * @brief  Exclusive load.
+  * @param  addr - address to load.
+  * @retval uint32_t - loaded value.
+  */
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  uint32_t value = __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+
+  p_host_excl_addr = addr;
+  host_excl_value = value;
+
+  return (value);
+}
+
+/**
+  * @brief  Exclusive store.
+  * @param  value - value to store.
+  * @param  addr  - address to store to.
+  * @retval uint32_t - 0 if stored, 1 if the location has been modified since __LDREXW.
+  */
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  uint32_t ret = 1U;
+  uint32_t expected = host_excl_value;
+
+  if ((p_host_excl_addr == addr)
+      && (__atomic_compare_exchange_n(addr, &expected, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)))
+  {
+    ret = 0U;
+  }
+  p_host_excl_addr = NULL;
+
+  return (ret);
+}
+
+/**
+  * @brief  Clear the exclusive monitor.
+  * @retval -
+  */
+void __CLREX(void)
+{
+  p_host_excl_addr = NULL;
+}
+
+/**
+  * @brief  System reset: the host program exits.
+  * @retval -
+  */
+void NVIC_SystemReset(void)
+{
+  (void)fprintf(stderr, "\n\rNVIC_SystemReset: host program stopped\n\r");
+  exit(EXIT_FAILURE);
+}
+
+/**
+  * @brief  Refresh and get the DWT registers.
+  * @retval DWT_Type * - DWT registers, CYCCNT in ns of the monotonic clock.
+  */
+DWT_Type *host_dwt_update(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  host_dwt.CYCCNT = (uint32_t)(((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+
+  return (&host_dwt);
+}
+
+/**
+  * @brief  Enter an emulated interrupt service routine.
+  * @retval -
+  */
+void host_irq_enter(void)
+{
+  (void)pthread_mutex_lock(&host_irq_lock);
+  host_irq_in_isr = true;
+}
+
+/**
+  * @brief  Exit an emulated interrupt service routine.
+  * @retval -
+  */
+void host_irq_exit(void)
+{
+  host_irq_in_isr = false;
+  (void)pthread_mutex_unlock(&host_irq_lock);
+}
+
+/**
+  * @brief  Check if the caller runs in an emulated interrupt service routine (rtosal POSIX port).
+  * @retval int32_t - 1 in an emulated ISR, 0 otherwise.
+  */
+int32_t osPosixInHandlerMode(void)
+{
+  return ((host_irq_in_isr == true) ? 1 : 0);
+}
+
+/*********************************** HAL **************************************/
+/**
+  * @brief  HAL initialization.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_Init(void)
+{
+  (void)rtosalKernelInitialize();
+  return (HAL_OK);
+}
+
+/**
+  * @brief  Get the tick, on the same (possibly accelerated) time base as rtosal.
+  * @retval uint32_t - tick in ms.
+  */
+uint32_t HAL_GetTick(void)
+{
+  return (rtosalGetSysTimerCount());
+}
+
+/**
+  * @brief  Delay.
+  * @param  Delay - delay in ms.
+  * @retval -
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  (void)rtosalDelay(Delay);
+}
+
+/**
+  * @brief  Enable an interrupt (emulated interrupts are always enabled).
+  * @param  IRQn - interrupt number.
+  * @retval -
+  */
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
+
+/**
+  * @brief  Disable an interrupt (emulated interrupts are always enabled).
+  * @param  IRQn - interrupt number.
+  * @retval -
+  */
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
+
+/**
+  * @brief  Set an interrupt priority (not emulated).
+  * @param  IRQn            - interrupt number.
+  * @param  PreemptPriority - preemption priority.
+  * @param  SubPriority     - sub priority.
+  * @retval -
+  */
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  UNUSED(IRQn);
+  UNUSED(PreemptPriority);
+  UNUSED(SubPriority);
+}
+
+/**
+  * @brief  Configure GPIO pins: only EXTI modes are recorded.
+  * @param  GPIOx     - GPIO port.
+  * @param  GPIO_Init - configuration.
+  * @retval -
+  */
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *GPIO_Init)
+{
+  size_t port = (size_t)(GPIOx - &host_gpio_ports[0]);
+
+  if (port < HOST_GPIO_PORT_NB)
+  {
+    if ((GPIO_Init->Mode & 0x10000000U) != 0U)
+    {
+      host_gpio_exti_mask[port] |= (uint16_t)GPIO_Init->Pin;
+    }
+    else
+    {
+      host_gpio_exti_mask[port] &= (uint16_t)~GPIO_Init->Pin;
+    }
+  }
+}
+
+/**
+  * @brief  De-configure GPIO pins.
+  * @param  GPIOx    - GPIO port.
+  * @param  GPIO_Pin - pins.
+  * @retval -
+  */
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+  size_t port = (size_t)(GPIOx - &host_gpio_ports[0]);
+
+  if (port < HOST_GPIO_PORT_NB)
+  {
+    host_gpio_exti_mask[port] &= (uint16_t)~GPIO_Pin;
+  }
+}
+
+/**
+  * @brief  Write output pins; the board hook (e.g modem simulator power key) is notified.
+  * @param  GPIOx    - GPIO port.
+  * @param  GPIO_Pin - pins.
+  * @param  PinState - state to write.
+  * @retval -
+  */
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if (PinState == GPIO_PIN_SET)
+  {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+  }
+  if (host_gpio_write_hook != NULL)
+  {
+    host_gpio_write_hook(GPIOx, GPIO_Pin, PinState, p_host_gpio_write_hook_arg);
+  }
+}
+
+/**
+  * @brief  Read input pins.
+  * @param  GPIOx    - GPIO port.
+  * @param  GPIO_Pin - pin.
+  * @retval GPIO_PinState
+  */
+GPIO_PinState HAL_GPIO_ReadPin(const GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  return (((GPIOx->IDR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+}
+
+/**
+  * @brief  Toggle output pins.
+  * @param  GPIOx    - GPIO port.
+  * @param  GPIO_Pin - pins.
+  * @retval -
+  */
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  HAL_GPIO_WritePin(GPIOx, GPIO_Pin, ((GPIOx->ODR & GPIO_Pin) != 0U) ? GPIO_PIN_RESET : GPIO_PIN_SET);
+}
+
+/**
+  * @brief  EXTI callback, overridden by the board (board_interrupts.c).
+  * @param  GPIO_Pin - pin.
+  * @retval -
+  */
+__attribute__((weak)) void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  UNUSED(GPIO_Pin);
+}
+
+/**
+  * @brief  Generate a random number.
+  * @param  hrng        - RNG handle.
+  * @param  random32bit - generated number.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_RNG_GenerateRandomNumber(RNG_HandleTypeDef *hrng, uint32_t *random32bit)
+{
+  UNUSED(hrng);
+  if (host_rng_seeded == false)
+  {
+    struct timespec now;
+    (void)clock_gettime(CLOCK_REALTIME, &now);
+    srandom((unsigned int)now.tv_nsec ^ (unsigned int)now.tv_sec);
+    host_rng_seeded = true;
+  }
+  *random32bit = ((uint32_t)random() << 16) ^ (uint32_t)random();
+
+  return (HAL_OK);
+}
+
+/*********************************** CRC **************************************/
+/**
+  * @brief  Initialize the CRC unit.
+  * @note   Only byte input and 7/8/16/32-bit polynomials are emulated, as the hardware does:
+  *         polynomial in normal representation, data processed MSB first, input reversed by byte
+  *         and output reversed on the polynomial size when configured.
+  * @param  hcrc - CRC handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hcrc == NULL) || (hcrc->InputDataFormat != CRC_INPUTDATA_FORMAT_BYTES))
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    hcrc->Instance->POL = (hcrc->Init.DefaultPolynomialUse == DEFAULT_POLYNOMIAL_ENABLE) ?
+                          0x04C11DB7U : hcrc->Init.GeneratingPolynomial;
+    hcrc->Instance->INIT = (hcrc->Init.DefaultInitValueUse == DEFAULT_INIT_VALUE_ENABLE) ?
+                           0xFFFFFFFFU : hcrc->Init.InitValue;
+    hcrc->Instance->CR = ((hcrc->Init.DefaultPolynomialUse == DEFAULT_POLYNOMIAL_ENABLE) ?
+                          CRC_POLYLENGTH_32B : hcrc->Init.CRCLength)
+                         | hcrc->Init.InputDataInversionMode | hcrc->Init.OutputDataInversionMode;
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Compute the CRC of a buffer of bytes, starting from the initial value (INIT register).
+  * @param  hcrc         - CRC handle.
+  * @param  pBuffer      - data (bytes, see InputDataFormat).
+  * @param  BufferLength - number of bytes.
+  * @retval uint32_t - CRC, on the polynomial size.
+  */
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  static const uint8_t poly_size[4] = {32U, 16U, 8U, 7U};
+  CRC_TypeDef *p_crc = hcrc->Instance;
+  const uint8_t *p_data = (const uint8_t *)pBuffer;
+  uint32_t size = poly_size[(p_crc->CR >> 3) & 3U];
+  uint32_t mask = (size == 32U) ? 0xFFFFFFFFU : ((1UL << size) - 1U);
+  uint32_t crc = p_crc->INIT & mask;
+
+  for (uint32_t i = 0U; i < BufferLength; i++)
+  {
+    uint32_t byte = p_data[i];
+    if ((p_crc->CR & CRC_INPUTDATA_INVERSION_BYTE) != 0U)
+    {
+      uint32_t reversed = 0U;
+      for (uint32_t bit = 0U; bit < 8U; bit++)
+      {
+        reversed |= ((byte >> bit) & 1U) << (7U - bit);
+      }
+      byte = reversed;
+    }
+    for (uint32_t bit = 0U; bit < 8U; bit++)
+    {
+      uint32_t msb = ((crc >> (size - 1U)) ^ (byte >> (7U - bit))) & 1U;
+      crc = (crc << 1) & mask;
+      if (msb != 0U)
+      {
+        crc ^= p_crc->POL & mask;
+      }
+    }
+  }
+
+  if ((p_crc->CR & CRC_OUTPUTDATA_INVERSION_ENABLE) != 0U)
+  {
+    uint32_t reversed = 0U;
+    for (uint32_t bit = 0U; bit < size; bit++)
+    {
+      reversed |= ((crc >> bit) & 1U) << (size - 1U - bit);
+    }
+    crc = reversed;
+  }
+  p_crc->DR = crc;
+
+  return (crc);
+}
+
+/****************************** Host board ************************************/
+/**
+  * @brief  Register the hook called on each GPIO write.
+  * @param  hook  - hook, NULL to remove it.
+  * @param  p_arg - argument passed to the hook.
+  * @retval -
+  */
+void HOST_GPIO_SetWriteHook(HOST_GPIO_WriteHook_t hook, void *p_arg)
+{
+  p_host_gpio_write_hook_arg = p_arg;
+  host_gpio_write_hook = hook;
+}
+
+/**
+  * @brief  Drive an input pin, raising its EXTI callback (under emulated IT) on a change.
+  * @param  GPIOx    - GPIO port.
+  * @param  GPIO_Pin - pin.
+  * @param  PinState - new state.
+  * @retval -
+  */
+void HOST_GPIO_SetInput(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  size_t port = (size_t)(GPIOx - &host_gpio_ports[0]);
+  uint32_t previous = GPIOx->IDR;
+
+  if (PinState == GPIO_PIN_SET)
+  {
+    GPIOx->IDR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->IDR &= ~(uint32_t)GPIO_Pin;
+  }
+
+  if ((port < HOST_GPIO_PORT_NB) && ((host_gpio_exti_mask[port] & GPIO_Pin) != 0U)
+      && ((previous & GPIO_Pin) != (GPIOx->IDR & GPIO_Pin)))
+  {
+    host_irq_enter();
+    HAL_GPIO_EXTI_Callback(GPIO_Pin);
+    host_irq_exit();
+  }
+}
@@ -0,0 +1,638 @@
+/**
+  ******************************************************************************
+  * @file    host_uart.c
+  * @author  MCD Application Team
+  * @brief   Host emulation of the STM32 HAL UART driver on file descriptors
+  *          (socketpair loopback to a simulator, PTY, tty or standard output).
+  * @note    Emulated behaviors:
+  *          - one "ISR" thread per UART raises the callbacks under emulated IT
+  *            (host_irq_enter/exit, see host_hal.c),
+  *          - HAL_UART_Receive_IT: byte per byte reception into the user buffer,
+  *          - HAL_UARTEx_ReceiveToIdle_DMA: half / complete transfer and idle
+  *            events, circular or normal mode according to the linked hdmarx,
+  *          - reception not armed or DMA paused: data are held back in the
+  *            file descriptor, as a modem held by RTS/CTS flow control,
+  *          - HAL_UART_Transmit_IT/DMA: data are written, then TxCplt is raised.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "host_hal.h"
+#include "host_board.h"
+
+/* Private defines -----------------------------------------------------------*/
+/* Maximum number of bytes read at once from the file descriptor (a FIFO / DMA burst) */
+#define HOST_UART_RX_CHUNK_SIZE  (256U)
+#define HOST_UART_PORT_NB        (sizeof(host_usart_instances) / sizeof(host_usart_instances[0]))
+
+/* Private typedef -----------------------------------------------------------*/
+struct host_uart_port
+{
+  UART_HandleTypeDef *huart;
+  int                 fd_rx;
+  int                 fd_tx;
+  int                 wake[2];        /* self-pipe to wake up the ISR thread */
+  bool                started;
+  pthread_t           isr_thread;
+  bool                tx_cplt_pending;
+  bool                rx_dma_paused;
+  uint16_t            rx_dma_pos;     /* DMA write position in the reception buffer */
+  uint16_t            rx_event_pos;   /* position of the last reported event */
+  uint8_t             rx_chunk[HOST_UART_RX_CHUNK_SIZE];
+  size_t              rx_chunk_len;
+  size_t              rx_chunk_off;
+};
+
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static struct host_uart_port host_uart_ports[3] =
+{
+  {.fd_rx = -1, .fd_tx = -1, .wake = {-1, -1}},
+  {.fd_rx = -1, .fd_tx = -1, .wake = {-1, -1}},
+  {.fd_rx = -1, .fd_tx = -1, .wake = {-1, -1}},
+};
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static struct host_uart_port *host_uart_port(UART_HandleTypeDef *huart);
+static void host_uart_wake(const struct host_uart_port *p_port);
+static bool host_uart_write(int fd, const uint8_t *p_data, size_t size);
+static void host_uart_rx_it(struct host_uart_port *p_port);
+static void host_uart_rx_dma(struct host_uart_port *p_port);
+static void *host_uart_isr_thread(void *p_arg);
+
+/* Private functions definition -----------------------------------------------*/
+/**
+  * @brief  Get the emulation port of an UART handle.
+  * @param  huart - UART handle.
+  * @retval struct host_uart_port * - port, NULL if the instance is unknown.
+  */
+static struct host_uart_port *host_uart_port(UART_HandleTypeDef *huart)
+{
+  if (huart->p_port == NULL)
+  {
+    size_t index = (size_t)(huart->Instance - &host_usart_instances[0]);
+    if (index < HOST_UART_PORT_NB)
+    {
+      huart->p_port = &host_uart_ports[index];
+      host_uart_ports[index].huart = huart;
+    }
+  }
+
+  return (huart->p_port);
+}
+
+/**
+  * @brief  Wake up the ISR thread of a port.
+  * @param  p_port - port.
+  * @retval -
+  */
+static void host_uart_wake(const struct host_uart_port *p_port)
+{
+  if (p_port->wake[1] >= 0)
+  {
+    uint8_t event = 0U;
+    (void)write(p_port->wake[1], &event, 1U);
+  }
+}
+
+/**
+  * @brief  Write all data to a file descriptor.
+  * @param  fd     - file descriptor, data are discarded if negative.
+  * @param  p_data - data.
+  * @param  size   - data size.
+  * @retval bool - false on write error.
+  */
+static bool host_uart_write(int fd, const uint8_t *p_data, size_t size)
+{
+  bool ret = true;
+  size_t done = 0U;
+
+  while ((fd >= 0) && (done < size) && (ret == true))
+  {
+    ssize_t written = write(fd, &p_data[done], size - done);
+    if (written > 0)
+    {
+      done += (size_t)written;
+    }
+    else if ((written < 0) && (errno == EINTR))
+    {
+      /* retry */
+    }
+    else
+    {
+      ret = false;
+    }
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  Deliver received data to an interrupt mode reception (emulated IT held).
+  * @param  p_port - port.
+  * @retval -
+  */
+static void host_uart_rx_it(struct host_uart_port *p_port)
+{
+  UART_HandleTypeDef *huart = p_port->huart;
+
+  while ((p_port->rx_chunk_off < p_port->rx_chunk_len) && (huart->RxState == HAL_UART_STATE_BUSY_RX))
+  {
+    huart->pRxBuffPtr[huart->RxXferSize - huart->RxXferCount] = p_port->rx_chunk[p_port->rx_chunk_off];
+    p_port->rx_chunk_off++;
+    huart->RxXferCount--;
+    if (huart->RxXferCount == 0U)
+    {
+      huart->RxState = HAL_UART_STATE_READY;
+      /* callback usually rearms the reception */
+      HAL_UART_RxCpltCallback(huart);
+    }
+  }
+}
+
+/**
+  * @brief  Deliver received data to a DMA reception to idle (emulated IT held).
+  * @note   The end of the received chunk is handled as an idle line.
+  * @param  p_port - port.
+  * @retval -
+  */
+static void host_uart_rx_dma(struct host_uart_port *p_port)
+{
+  UART_HandleTypeDef *huart = p_port->huart;
+  bool circular = ((huart->hdmarx != NULL) && (huart->hdmarx->Init.Mode == DMA_CIRCULAR)) ? true : false;
+  uint16_t half = huart->RxXferSize / 2U;
+
+  while ((p_port->rx_chunk_off < p_port->rx_chunk_len) && (huart->RxState == HAL_UART_STATE_BUSY_RX)
+         && (p_port->rx_dma_paused == false))
+  {
+    huart->pRxBuffPtr[p_port->rx_dma_pos] = p_port->rx_chunk[p_port->rx_chunk_off];
+    p_port->rx_chunk_off++;
+    p_port->rx_dma_pos++;
+
+    if (p_port->rx_dma_pos == half)
+    {
+      /* half transfer event */
+      p_port->rx_event_pos = half;
+      HAL_UARTEx_RxEventCallback(huart, half);
+    }
+    else if (p_port->rx_dma_pos == huart->RxXferSize)
+    {
+      /* transfer complete event */
+      p_port->rx_dma_pos = 0U;
+      p_port->rx_event_pos = 0U;
+      if (circular == false)
+      {
+        huart->RxState = HAL_UART_STATE_READY;
+      }
+      HAL_UARTEx_RxEventCallback(huart, huart->RxXferSize);
+    }
+    else
+    {
+      /* DMA transfer on-going */
+    }
+  }
+
+  if ((p_port->rx_chunk_off == p_port->rx_chunk_len) && (huart->RxState == HAL_UART_STATE_BUSY_RX)
+      && (p_port->rx_dma_pos != p_port->rx_event_pos))
+  {
+    /* idle line event */
+    p_port->rx_event_pos = p_port->rx_dma_pos;
+    if (circular == false)
+    {
+      huart->RxState = HAL_UART_STATE_READY;
+    }
+    HAL_UARTEx_RxEventCallback(huart, p_port->rx_event_pos);
+  }
+}
+
+/**
+  * @brief  ISR thread of a port: reception and transmission complete events.
+  * @param  p_arg - port.
+  * @retval void * - unused.
+  */
+static void *host_uart_isr_thread(void *p_arg)
+{
+  struct host_uart_port *p_port = (struct host_uart_port *)p_arg;
+  bool running = true;
+
+  while (running == true)
+  {
+    struct pollfd fds[2];
+    nfds_t nfds = 1U;
+
+    fds[0].fd = p_port->wake[0];
+    fds[0].events = POLLIN;
+    /* read new data only once the previous ones have been delivered (flow control) */
+    if ((p_port->fd_rx >= 0) && (p_port->rx_chunk_off == p_port->rx_chunk_len))
+    {
+      fds[1].fd = p_port->fd_rx;
+      fds[1].events = POLLIN;
+      nfds = 2U;
+    }
+
+    if (poll(fds, nfds, -1) < 0)
+    {
+      continue;
+    }
+
+    if ((fds[0].revents & POLLIN) != 0)
+    {
+      uint8_t events[16];
+      (void)read(p_port->wake[0], events, sizeof(events));
+    }
+
+    if ((nfds == 2U) && ((fds[1].revents & (POLLIN | POLLHUP | POLLERR)) != 0))
+    {
+      ssize_t len = read(p_port->fd_rx, p_port->rx_chunk, sizeof(p_port->rx_chunk));
+      if (len > 0)
+      {
+        p_port->rx_chunk_len = (size_t)len;
+        p_port->rx_chunk_off = 0U;
+      }
+      else if ((len < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+      {
+        /* retry */
+      }
+      else
+      {
+        /* peer closed: stop receiving */
+        p_port->fd_rx = -1;
+      }
+    }
+
+    host_irq_enter();
+    if (p_port->tx_cplt_pending == true)
+    {
+      p_port->tx_cplt_pending = false;
+      p_port->huart->gState = HAL_UART_STATE_READY;
+      HAL_UART_TxCpltCallback(p_port->huart);
+    }
+    if (p_port->rx_chunk_off < p_port->rx_chunk_len)
+    {
+      if (p_port->huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+      {
+        host_uart_rx_dma(p_port);
+      }
+      else
+      {
+        host_uart_rx_it(p_port);
+      }
+    }
+    host_irq_exit();
+  }
+
+  return (NULL);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Connect the emulated UART to file descriptors.
+  * @param  huart - UART handle.
+  * @param  fd_rx - file descriptor to receive from, -1 if none.
+  * @param  fd_tx - file descriptor to transmit to, -1 to discard the transmitted data.
+  * @retval -
+  */
+void HOST_UART_Attach(UART_HandleTypeDef *huart, int fd_rx, int fd_tx)
+{
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if (p_port != NULL)
+  {
+    p_port->fd_rx = fd_rx;
+    p_port->fd_tx = fd_tx;
+    if (p_port->started == false)
+    {
+      if (pipe(p_port->wake) == 0)
+      {
+        if (pthread_create(&p_port->isr_thread, NULL, host_uart_isr_thread, p_port) == 0)
+        {
+          (void)pthread_detach(p_port->isr_thread);
+          p_port->started = true;
+        }
+      }
+    }
+    else
+    {
+      host_uart_wake(p_port);
+    }
+  }
+}
+
+/**
+  * @brief  Initialize an UART.
+  * @param  huart - UART handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if ((huart != NULL) && (host_uart_port(huart) != NULL))
+  {
+    if (huart->gState == HAL_UART_STATE_RESET)
+    {
+      HAL_UART_MspInit(huart);
+    }
+    huart->ErrorCode = 0U;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->gState = HAL_UART_STATE_READY;
+    huart->RxState = HAL_UART_STATE_READY;
+    status = HAL_OK;
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  De-initialize an UART.
+  * @param  huart - UART handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if (huart != NULL)
+  {
+    HAL_UART_MspDeInit(huart);
+    huart->gState = HAL_UART_STATE_RESET;
+    huart->RxState = HAL_UART_STATE_RESET;
+    status = HAL_OK;
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Blocking transmission.
+  * @param  huart   - UART handle.
+  * @param  pData   - data.
+  * @param  Size    - data size.
+  * @param  Timeout - unused, the write blocks until done.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                    uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  UNUSED(Timeout);
+  if (p_port != NULL)
+  {
+    status = (host_uart_write(p_port->fd_tx, pData, Size) == true) ? HAL_OK : HAL_ERROR;
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Transmission under IT: data are written then TxCplt is raised by the ISR thread.
+  * @param  huart - UART handle.
+  * @param  pData - data.
+  * @param  Size  - data size.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if ((p_port != NULL) && (p_port->started == true))
+  {
+    if (huart->gState != HAL_UART_STATE_READY)
+    {
+      status = HAL_BUSY;
+    }
+    else
+    {
+      huart->gState = HAL_UART_STATE_BUSY_TX;
+      huart->pTxBuffPtr = (uint8_t *)pData;
+      huart->TxXferSize = Size;
+      if (host_uart_write(p_port->fd_tx, pData, Size) == true)
+      {
+        p_port->tx_cplt_pending = true;
+        host_uart_wake(p_port);
+        status = HAL_OK;
+      }
+      else
+      {
+        huart->gState = HAL_UART_STATE_READY;
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Transmission under DMA: same emulation as under IT.
+  * @param  huart - UART handle.
+  * @param  pData - data.
+  * @param  Size  - data size.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+  return (HAL_UART_Transmit_IT(huart, pData, Size));
+}
+
+/**
+  * @brief  Reception under IT.
+  * @param  huart - UART handle.
+  * @param  pData - reception buffer.
+  * @param  Size  - number of bytes to receive.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if ((p_port != NULL) && (pData != NULL) && (Size != 0U))
+  {
+    if (huart->RxState != HAL_UART_STATE_READY)
+    {
+      status = HAL_BUSY;
+    }
+    else
+    {
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      huart->pRxBuffPtr = pData;
+      huart->RxXferSize = Size;
+      huart->RxXferCount = Size;
+      huart->RxState = HAL_UART_STATE_BUSY_RX;
+      host_uart_wake(p_port);
+      status = HAL_OK;
+    }
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Reception under DMA until idle line.
+  * @note   As the HAL, no DMA transfer happens without a linked hdmarx: HAL_ERROR is returned.
+  * @param  huart - UART handle.
+  * @param  pData - reception buffer.
+  * @param  Size  - reception buffer size.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if ((p_port != NULL) && (pData != NULL) && (Size != 0U) && (huart->hdmarx != NULL))
+  {
+    if (huart->RxState != HAL_UART_STATE_READY)
+    {
+      status = HAL_BUSY;
+    }
+    else
+    {
+      huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+      huart->pRxBuffPtr = pData;
+      huart->RxXferSize = Size;
+      huart->RxXferCount = Size;
+      p_port->rx_dma_pos = 0U;
+      p_port->rx_event_pos = 0U;
+      p_port->rx_dma_paused = false;
+      huart->RxState = HAL_UART_STATE_BUSY_RX;
+      host_uart_wake(p_port);
+      status = HAL_OK;
+    }
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Pause the DMA reception.
+  * @param  huart - UART handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart)
+{
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if (p_port != NULL)
+  {
+    p_port->rx_dma_paused = true;
+  }
+
+  return ((p_port != NULL) ? HAL_OK : HAL_ERROR);
+}
+
+/**
+  * @brief  Resume the DMA reception.
+  * @param  huart - UART handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart)
+{
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if (p_port != NULL)
+  {
+    p_port->rx_dma_paused = false;
+    host_uart_wake(p_port);
+  }
+
+  return ((p_port != NULL) ? HAL_OK : HAL_ERROR);
+}
+
+/**
+  * @brief  Abort the reception.
+  * @param  huart - UART handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
+{
+  huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+
+  return (HAL_OK);
+}
+
+/**
+  * @brief  Abort the transmission: the emulated transmission is already done.
+  * @param  huart - UART handle.
+  * @retval HAL_StatusTypeDef
+  */
+HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
+{
+  struct host_uart_port *p_port = host_uart_port(huart);
+
+  if (p_port != NULL)
+  {
+    p_port->tx_cplt_pending = false;
+  }
+  huart->gState = HAL_UART_STATE_READY;
+
+  return (HAL_OK);
+}
+
+/**
+  * @brief  UART MSP initialization, overridden by usart.c.
+  * @param  huart - UART handle.
+  * @retval -
+  */
+__attribute__((weak)) void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+/**
+  * @brief  UART MSP de-initialization, overridden by usart.c.
+  * @param  huart - UART handle.
+  * @retval -
+  */
+__attribute__((weak)) void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+/**
+  * @brief  Weak callbacks, overridden by the board (board_interrupts.c).
+  * @param  huart - UART handle.
+  * @retval -
+  */
+__attribute__((weak)) void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__attribute__((weak)) void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__attribute__((weak)) void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__attribute__((weak)) void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  UNUSED(huart);
+  UNUSED(Size);
+}
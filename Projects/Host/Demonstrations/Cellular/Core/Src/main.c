@@ -0,0 +1,141 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MCD Application Team
+  * @brief   Host cellular program: starts the cellular middleware on the modem
+  *          simulator (or on the tty given by HOST_MODEM_TTY), waits for the
+  *          network and checks a TCP echo through com_sockets.
+  * @note    Exit status 0 when the echo check succeeds: used as smoke test.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_cellular.h"
+#include "com_sockets.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_DATA_READY_TIMEOUT  (180000U) /* ms */
+#define HOST_ECHO_RCV_TIMEOUT    (10000U)  /* ms */
+#define HOST_ECHO_PORT           (7U)
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t host_echo_check(void);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Send buffers of several sizes to the echo server and check the answers.
+  * @retval int32_t - 0 if all the answers match, -1 otherwise.
+  */
+static int32_t host_echo_check(void)
+{
+  static const int32_t sizes[] = {16, 700, 1500, 3000};
+  static com_char_t snd_buf[3000];
+  static com_char_t rcv_buf[3000];
+  com_sockaddr_in_t address;
+  uint32_t timeout = HOST_ECHO_RCV_TIMEOUT;
+  int32_t ret = 0;
+  int32_t sock = com_socket(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+
+  if (sock < 0)
+  {
+    ret = -1;
+  }
+  else
+  {
+    (void)com_setsockopt(sock, COM_SOL_SOCKET, COM_SO_RCVTIMEO, &timeout, (int32_t)sizeof(timeout));
+    (void)memset(&address, 0, sizeof(address));
+    address.sin_family = (uint8_t)COM_AF_INET;
+    address.sin_port = COM_HTONS(HOST_ECHO_PORT);
+    address.sin_addr.s_addr = COM_HTONL(0x0A000001U); /* 10.0.0.1 */
+    if (com_connect(sock, (com_sockaddr_t const *)&address, (int32_t)sizeof(com_sockaddr_in_t))
+        != COM_SOCKETS_ERR_OK)
+    {
+      ret = -1;
+    }
+  }
+
+  for (size_t i = 0U; (i < (sizeof(sizes) / sizeof(sizes[0]))) && (ret == 0); i++)
+  {
+    int32_t received = 0;
+    for (int32_t j = 0; j < sizes[i]; j++)
+    {
+      snd_buf[j] = (com_char_t)(j + (int32_t)i);
+    }
+    if (com_send(sock, snd_buf, sizes[i], COM_MSG_WAIT) != sizes[i])
+    {
+      ret = -1;
+    }
+    while ((ret == 0) && (received < sizes[i]))
+    {
+      int32_t len = com_recv(sock, &rcv_buf[received], sizes[i] - received, COM_MSG_WAIT);
+      if (len > 0)
+      {
+        received += len;
+      }
+      else
+      {
+        ret = -1;
+      }
+    }
+    if ((ret == 0) && (memcmp(snd_buf, rcv_buf, (size_t)sizes[i]) != 0))
+    {
+      ret = -1;
+    }
+    (void)printf("host: echo %4ld bytes %s\n", (long)sizes[i], (ret == 0) ? "OK" : "FAILED");
+  }
+
+  if (sock >= 0)
+  {
+    (void)com_closesocket(sock);
+  }
+
+  return (ret);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  int ret = EXIT_FAILURE;
+
+  if (HOST_Cellular_Start() != 0)
+  {
+    (void)printf("host: cellular start failed\n");
+  }
+  else if (HOST_Cellular_WaitDataReady(HOST_DATA_READY_TIMEOUT) == false)
+  {
+    (void)printf("host: network not ready\n");
+  }
+  else if (host_echo_check() == 0)
+  {
+    modem_sim_t *p_sim = HOST_Cellular_GetSimulator();
+    if ((p_sim != NULL) && (modem_sim_replay_done(p_sim) == false))
+    {
+      (void)printf("host: simulator script not fully replayed\n");
+    }
+    else
+    {
+      (void)printf("host: data ready and TCP echo OK\n");
+      ret = EXIT_SUCCESS;
+    }
+  }
+  else
+  {
+    (void)printf("host: TCP echo failed\n");
+  }
+
+  return (ret);
+}
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    plf_hw_config.h
+  * @author  MCD Application Team
+  * @brief   This file contains the hardware configuration of the platform
+  * @note    Host platform: UARTs are emulated by host_uart.c, the modem UART is
+  *          connected to a modem simulator (in-process loopback) or to a tty/PTY.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_HW_CONFIG_H
+#define PLF_HW_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+
+#include "main.h"
+#include "plf_modem_config.h"
+#include "usart.h" /* for huartX */
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Platform defines ----------------------------------------------------------*/
+
+/* MODEM configuration */
+#define MODEM_UART_HANDLE       huart3
+#define MODEM_UART_INSTANCE     USART3
+#define MODEM_UART_AUTOBAUD     (0)
+#define MODEM_UART_IRQN         USART3_IRQn
+
+#define MODEM_UART_BAUDRATE     (CONFIG_MODEM_UART_BAUDRATE)
+#define MODEM_UART_WORDLENGTH   UART_WORDLENGTH_8B
+#define MODEM_UART_STOPBITS     UART_STOPBITS_1
+#define MODEM_UART_PARITY       UART_PARITY_NONE
+#define MODEM_UART_MODE         UART_MODE_TX_RX
+
+#if (CONFIG_MODEM_UART_RTS_CTS == 1)
+#define MODEM_UART_HWFLOWCTRL   UART_HWCONTROL_RTS_CTS
+#else
+#define MODEM_UART_HWFLOWCTRL   UART_HWCONTROL_NONE
+#endif /* (CONFIG_MODEM_UART_RTS_CTS == 1) */
+
+#define MODEM_TX_GPIO_PORT      ((GPIO_TypeDef *)MDM_UART_TX_GPIO_Port)
+#define MODEM_TX_PIN            MDM_UART_TX_Pin
+#define MODEM_RX_GPIO_PORT      ((GPIO_TypeDef *)MDM_UART_RX_GPIO_Port)
+#define MODEM_RX_PIN            MDM_UART_RX_Pin
+#define MODEM_CTS_GPIO_PORT     ((GPIO_TypeDef *)MDM_UART_CTS_GPIO_Port)
+#define MODEM_CTS_PIN           MDM_UART_CTS_Pin
+#define MODEM_RTS_GPIO_PORT     ((GPIO_TypeDef *)MDM_UART_RTS_GPIO_Port)
+#define MODEM_RTS_PIN           MDM_UART_RTS_Pin
+
+/* ---- MODEM other pins configuration ---- */
+/* output */
+#define MODEM_RST_GPIO_PORT             MDM_RST_OUT_GPIO_Port
+#define MODEM_RST_PIN                   MDM_RST_OUT_Pin
+#define MODEM_PWR_EN_GPIO_PORT          MDM_PWR_EN_OUT_GPIO_Port
+#define MODEM_PWR_EN_PIN                MDM_PWR_EN_OUT_Pin
+#define MODEM_DTR_GPIO_PORT             MDM_DTR_OUT_GPIO_Port
+#define MODEM_DTR_PIN                   MDM_DTR_OUT_Pin
+/* input */
+#define MODEM_RING_GPIO_PORT    ((GPIO_TypeDef *)MDM_RING_GPIO_Port)
+#define MODEM_RING_PIN          MDM_RING_Pin
+#define MODEM_RING_IRQN         MDM_RING_EXTI_IRQn
+
+/* ---- MODEM SIM SELECTION pins ---- */
+#define MODEM_SIM_SELECT_0_GPIO_PORT     MDM_SIM_SELECT_0_OUT_GPIO_Port
+#define MODEM_SIM_SELECT_0_PIN           MDM_SIM_SELECT_0_OUT_Pin
+#define MODEM_SIM_SELECT_1_GPIO_PORT     MDM_SIM_SELECT_1_OUT_GPIO_Port
+#define MODEM_SIM_SELECT_1_PIN           MDM_SIM_SELECT_1_OUT_Pin
+
+#define PPPOS_LINK_UART_HANDLE   NULL
+#define PPPOS_LINK_UART_INSTANCE NULL
+
+/* DEBUG INTERFACE CONFIGURATION */
+/* trace UART is emulated on the standard output */
+#define TRACE_INTERFACE_UART_HANDLE     huart1
+#define TRACE_INTERFACE_INSTANCE        USART1
+
+#define COM_INTERFACE_UART_HANDLE      huart2
+#define COM_INTERFACE_INSTANCE        ((USART_TypeDef *)USART2)
+#define COM_INTERFACE_UART_IRQ         USART2_IRQn
+#define COM_INTERFACE_UART_INIT        MX_USART2_UART_Init(); \
+  HAL_NVIC_EnableIRQ(COM_INTERFACE_UART_IRQ);
+
+/* Exported types ------------------------------------------------------------*/
+
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_HW_CONFIG_H */
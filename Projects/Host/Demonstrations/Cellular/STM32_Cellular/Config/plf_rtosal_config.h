@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file    plf_rtosal_config.h
+  * @author  MCD Application Team
+  * @brief   This file contains RTOS abstarction layer configuration.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018-2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_RTOSAL_CONFIG_H
+#define PLF_RTOSAL_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+/*cstat -MISRAC2012-* */
+#include "cmsis_os.h"
+/*cstat +MISRAC2012-* */
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Configure RTOSAL memory allocation service */
+#if !defined RTOSAL_MALLOC
+#define RTOSAL_MALLOC                  malloc
+#endif /* !defined RTOSAL_MALLOC */
+
+/* Configure RTOSAL memory deallocation service */
+#if !defined RTOSAL_FREE
+#define RTOSAL_FREE                    free
+#endif /* !defined RTOSAL_FREE */
+
+/* Configure RTOSAL stack type size value */
+/* Cellular thread stack sizes in plf_thread_config.h are expressed in dwords.
+ * rtosal_posix.c allocates thread stacks in bytes (with a host minimum size).
+ */
+#if !defined RTOSAL_STACK_TYPE_SIZE
+#define RTOSAL_STACK_TYPE_SIZE         4
+#endif /* !defined RTOSAL_STACK_TYPE_SIZE */
+
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_RTOSAL_CONFIG_H */
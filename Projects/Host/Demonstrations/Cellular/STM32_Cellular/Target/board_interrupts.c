@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    board_interrupts.c
+  * @author  MCD Application Team
+  * @brief   Implements HAL weak functions for Interrupts
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018-2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#include "ipc_uart.h"
+#include "at_modem_api.h"
+#include "trace_interface.h"
+#if (USE_CMD_CONSOLE == 1)
+#include "cmd.h"
+#endif  /* (USE_CMD_CONSOLE == 1) */
+
+/* NOTE : on the host, these callbacks are raised by the emulated ISR threads (host_uart.c, host_hal.c) */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private defines -----------------------------------------------------------*/
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Callback to treat EXTI
+  * @param  GPIO_Pin - GPIO Pin value
+  * @retval -
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == MODEM_RING_PIN)
+  {
+    GPIO_PinState gstate = HAL_GPIO_ReadPin(MODEM_RING_GPIO_PORT, MODEM_RING_PIN);
+    atcc_hw_event(DEVTYPE_MODEM_CELLULAR, HWEVT_MODEM_RING, gstate);
+  }
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+}
+
+/**
+  * @brief  Callback to treat UART Rx complete
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == MODEM_UART_INSTANCE)
+  {
+    IPC_UART_RxCpltCallback(huart);
+  }
+#if (USE_CMD_CONSOLE == 1)
+  else if (huart->Instance == TRACE_INTERFACE_INSTANCE)
+  {
+    CMD_RxCpltCallback(huart);
+  }
+#endif  /* USE_CMD_CONSOLE */
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+}
+
+/**
+  * @brief  Callback to treat UART Tx complete
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == MODEM_UART_INSTANCE)
+  {
+    IPC_UART_TxCpltCallback(huart);
+  }
+#if (TRACE_IF_TX_ASYNC == 1U)
+  else if (huart->Instance == TRACE_INTERFACE_INSTANCE)
+  {
+    traceIF_uartTxCpltCallback(huart);
+  }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+}
+
+/**
+  * @brief  Callback to treat Error
+  * @param  huart - pointer on UART handle
+  * @retval -
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == MODEM_UART_INSTANCE)
+  {
+    IPC_UART_ErrorCallback(huart);
+  }
+#if (TRACE_IF_TX_ASYNC == 1U)
+  else if (huart->Instance == TRACE_INTERFACE_INSTANCE)
+  {
+    traceIF_uartErrorCallback(huart);
+  }
+#endif /* TRACE_IF_TX_ASYNC == 1U */
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+}
+
+#if (IPC_USE_RX_DMA == 1U)
+/**
+  * @brief  Callback to treat UART Rx event (DMA half/complete transfer, idle line)
+  * @param  huart - pointer on UART handle
+  * @param  Size - position in reception buffer
+  * @retval -
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  if (huart->Instance == MODEM_UART_INSTANCE)
+  {
+    IPC_UART_RxEventCallback(huart, Size);
+  }
+}
+#endif /* IPC_USE_RX_DMA == 1U */
+
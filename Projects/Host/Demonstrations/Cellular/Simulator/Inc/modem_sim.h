@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    modem_sim.h
+  * @author  MCD Application Team
+  * @brief   Header for modem_sim.c: scriptable AT modem simulator (BG96, TYPE1SC)
+  *          used by the host build to run the cellular middleware without modem.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MODEM_SIM_H
+#define MODEM_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+  * @brief Script syntax (one statement per line, '#' starts a comment):
+  *
+  *        urc <text>       unsolicited line "\r\n<text>\r\n", sent at start (top level)
+  *                         or as part of the answer of a block
+  *        send <text>      answer line "\r\n<text>\r\n"
+  *        raw <text>       answer bytes, without framing
+  *        delay <ms>       delay before the next answer statement
+  *        expect <prefix>  replay block: the next command must start with <prefix>,
+  *                         blocks are consumed in the script order
+  *        on <prefix>      rule block: used for each command starting with <prefix>
+  *
+  *        Text escapes: \r \n \t \\ \" and \xHH.
+  *        A command matching neither the next expect block nor an on block is handled
+  *        by the built-in model (boot, network, sockets echo server), "OK" by default.
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  MODEM_SIM_BG96    = 0,
+  MODEM_SIM_TYPE1SC = 1
+} modem_sim_model_t;
+
+typedef struct
+{
+  uint32_t commands;        /* AT commands received                             */
+  uint32_t replayed;        /* commands answered by an expect block             */
+  uint32_t unexpected;      /* commands not matching the next expect block      */
+  uint32_t tx_bytes;        /* socket data bytes received from the host         */
+  uint32_t rx_bytes;        /* socket data bytes sent to the host               */
+} modem_sim_stats_t;
+
+typedef struct modem_sim_s modem_sim_t;
+
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Create a simulator.
+  * @param  model - modem model.
+  * @param  fd    - file descriptor of the modem side of the UART (PTY master, socket...).
+  * @retval modem_sim_t * - simulator, NULL on allocation error.
+  */
+modem_sim_t *modem_sim_create(modem_sim_model_t model, int fd);
+
+/**
+  * @brief  Load a script (see syntax above). Can be called several times before start.
+  * @param  p_sim  - simulator.
+  * @param  p_path - script path.
+  * @retval int32_t - 0 if loaded, -1 otherwise (error printed on stderr).
+  */
+int32_t modem_sim_load_script(modem_sim_t *p_sim, const char *p_path);
+
+/**
+  * @brief  Set the one-way latency added before each answer.
+  * @param  p_sim      - simulator.
+  * @param  latency_us - latency in us.
+  * @retval -
+  */
+void modem_sim_set_latency(modem_sim_t *p_sim, uint32_t latency_us);
+
+/**
+  * @brief  Start the simulator thread.
+  * @param  p_sim - simulator.
+  * @retval int32_t - 0 if started, -1 otherwise.
+  */
+int32_t modem_sim_start(modem_sim_t *p_sim);
+
+/**
+  * @brief  Run the simulator in the calling thread until the peer closes the file descriptor.
+  * @param  p_sim - simulator.
+  * @retval -
+  */
+void modem_sim_run(modem_sim_t *p_sim);
+
+/**
+  * @brief  Get the simulator statistics.
+  * @param  p_sim   - simulator.
+  * @param  p_stats - statistics.
+  * @retval -
+  */
+void modem_sim_get_stats(modem_sim_t *p_sim, modem_sim_stats_t *p_stats);
+
+/**
+  * @brief  Check that every expect block of the scripts has been replayed.
+  * @param  p_sim - simulator.
+  * @retval bool - true if the replay is complete.
+  */
+bool modem_sim_replay_done(modem_sim_t *p_sim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MODEM_SIM_H */
@@ -0,0 +1,1065 @@
+/**
+  ******************************************************************************
+  * @file    modem_sim.c
+  * @author  MCD Application Team
+  * @brief   Scriptable AT modem simulator (BG96, TYPE1SC) for the host build.
+  * @note    The simulator answers on the modem side of the UART:
+  *          - scripts (see modem_sim.h) replay recorded exchanges in order
+  *            ("expect" blocks) or override answers ("on" blocks),
+  *          - the built-in model answers the boot / network commands of the
+  *            drivers and implements the modem sockets as an echo server:
+  *            data sent on a socket are notified back as received data.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "modem_sim.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define MODEM_SIM_LINE_SIZE      (4096U)  /* TYPE1SC sends the data in hexadecimal in the command */
+#define MODEM_SIM_DATA_SIZE      (1600U)  /* maximum BG96 AT+QISEND data size                   */
+#define MODEM_SIM_SOCKET_NB      (12U)
+#define MODEM_SIM_SOCKET_BUFSIZE (16384U) /* echo buffer per socket                             */
+
+#define MODEM_SIM_IP_ADDR        "10.0.0.2"
+#define MODEM_SIM_DNS_ADDR       "10.0.0.1"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  SIM_ACTION_SEND,
+  SIM_ACTION_RAW,
+  SIM_ACTION_DELAY
+} sim_action_type_t;
+
+typedef struct sim_action_s
+{
+  sim_action_type_t    type;
+  char                *p_data;
+  size_t               len;
+  uint32_t             delay_ms;
+  struct sim_action_s *p_next;
+} sim_action_t;
+
+typedef struct sim_block_s
+{
+  char                *p_prefix;
+  sim_action_t        *p_actions;
+  struct sim_block_s  *p_next;
+} sim_block_t;
+
+typedef struct
+{
+  bool     open;
+  size_t   len;
+  uint32_t total_len;               /* bytes received since the socket opening */
+  uint32_t read_len;                /* bytes read by the host since the socket opening */
+  uint8_t  buf[MODEM_SIM_SOCKET_BUFSIZE];
+} sim_socket_t;
+
+struct modem_sim_s
+{
+  modem_sim_model_t  model;
+  int                fd;
+  uint32_t           latency_us;
+  pthread_t          thread;
+
+  sim_action_t      *p_boot;       /* top level statements of the scripts */
+  sim_block_t       *p_expect;     /* replay blocks, in order             */
+  sim_block_t       *p_rules;      /* rule blocks                         */
+
+  char               line[MODEM_SIM_LINE_SIZE];
+  size_t             line_len;
+  bool               line_overflow;
+
+  /* BG96 AT+QISEND / TYPE1SC AT%SOCKETDATA="SEND" binary data phase */
+  size_t             data_expected;
+  size_t             data_len;
+  uint32_t           data_socket;
+  uint8_t            data[MODEM_SIM_DATA_SIZE];
+
+  sim_socket_t       sockets[MODEM_SIM_SOCKET_NB];
+
+  pthread_mutex_t    stats_lock;
+  modem_sim_stats_t  stats;
+};
+
+typedef struct
+{
+  const char *p_prefix;
+  const char *p_answer;
+} sim_query_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Queries answered by an information line then OK */
+static const sim_query_t sim_common_queries[] =
+{
+  {"+CPIN?",    "+CPIN: READY"},
+  {"+CFUN?",    "+CFUN: 1"},
+  {"+COPS?",    "+COPS: 0,0,\"STM SIMULATOR\",8"},
+  {"+CEREG?",   "+CEREG: 0,1"},
+  {"+CREG?",    "+CREG: 0,1"},
+  {"+CGREG?",   "+CGREG: 0,1"},
+  {"+CGATT?",   "+CGATT: 1"},
+  {"+CSQ",      "+CSQ: 20,99"},
+  {"+CIMI",     "208011234567890"},
+  {"+CGSN",     "866425030000000"},
+  {"+GSN",      "866425030000000"},
+  {"+CGPADDR",  "+CGPADDR: 1,\"" MODEM_SIM_IP_ADDR "\""},
+  {"+IPR?",     "+IPR: 115200"},
+  {NULL,        NULL}
+};
+
+static const sim_query_t sim_bg96_queries[] =
+{
+  {"+CGMI",     "Quectel"},
+  {"+CGMM",     "BG96"},
+  {"+CGMR",     "BG96MAR02A07M1G"},
+  {"+QGMR",     "BG96MAR02A07M1G_01.016.01.016"},
+  {"+QCCID",    "+QCCID: 89330123456789012345"},
+  {"+QINISTAT", "+QINISTAT: 7"},
+  {"+QCSQ",     "+QCSQ: \"eMTC\",-70,-90,150,-10"},
+  {"+QIACT?",   "+QIACT: 1,1,1,\"" MODEM_SIM_IP_ADDR "\""},
+  {NULL,        NULL}
+};
+
+static const sim_query_t sim_type1sc_queries[] =
+{
+  {"+CGMI",     "Murata"},
+  {"+CGMM",     "LBAD0XX1SC-DM"},
+  {"+CGMR",     "RKSS_1SC_SIM"},
+  {"%CCID",     "%CCID: 89330123456789012345"},
+  {"%SOCKETDATA=?", "%SOCKETDATA:(\"SEND\",\"RECEIVE\"),(1-11),(1-1500),(\"HEX\",\"BIN\")"},
+  {NULL,        NULL}
+};
+
+static const char sim_hex_digits[] = "0123456789ABCDEF";
+
+/* Private function prototypes -----------------------------------------------*/
+static void sim_write(modem_sim_t *p_sim, const void *p_data, size_t len);
+static void sim_line(modem_sim_t *p_sim, const char *p_format, ...) __attribute__((format(printf, 2, 3)));
+static void sim_delay_us(uint32_t delay_us);
+static size_t sim_unescape(const char *p_in, char *p_out);
+static sim_action_t *sim_action_new(sim_action_type_t type, const char *p_text);
+static void sim_actions_append(sim_action_t **pp_list, sim_action_t *p_action);
+static void sim_actions_play(modem_sim_t *p_sim, const sim_action_t *p_action);
+static bool sim_is_prefix(const char *p_line, const char *p_prefix);
+static int32_t sim_param_int(const char *p_params, uint32_t index);
+static bool sim_param_str(const char *p_params, uint32_t index, char *p_out, size_t out_size);
+static sim_socket_t *sim_socket(modem_sim_t *p_sim, int32_t socket_id);
+static void sim_socket_echo(modem_sim_t *p_sim, uint32_t socket_id, const uint8_t *p_data, size_t len);
+static size_t sim_socket_read(modem_sim_t *p_sim, uint32_t socket_id, uint8_t *p_data, size_t len);
+static const char *sim_query(const modem_sim_t *p_sim, const char *p_cmd);
+static void sim_compound_command(modem_sim_t *p_sim, const char *p_line);
+static void sim_bg96_command(modem_sim_t *p_sim, const char *p_cmd);
+static void sim_type1sc_command(modem_sim_t *p_sim, const char *p_cmd);
+static void sim_command(modem_sim_t *p_sim, const char *p_line);
+static void sim_data(modem_sim_t *p_sim);
+static void *sim_thread(void *p_arg);
+
+/* Private functions definition ----------------------------------------------*/
+static void sim_write(modem_sim_t *p_sim, const void *p_data, size_t len)
+{
+  const uint8_t *p_byte = (const uint8_t *)p_data;
+  size_t done = 0U;
+
+  while (done < len)
+  {
+    ssize_t written = write(p_sim->fd, &p_byte[done], len - done);
+    if (written > 0)
+    {
+      done += (size_t)written;
+    }
+    else if ((written < 0) && (errno == EINTR))
+    {
+      /* retry */
+    }
+    else
+    {
+      /* peer closed */
+      done = len;
+    }
+  }
+}
+
+static void sim_line(modem_sim_t *p_sim, const char *p_format, ...)
+{
+  char buffer[MODEM_SIM_LINE_SIZE + 64U];
+  va_list args;
+  int len;
+
+  buffer[0] = '\r';
+  buffer[1] = '\n';
+  va_start(args, p_format);
+  len = vsnprintf(&buffer[2], sizeof(buffer) - 4U, p_format, args);
+  va_end(args);
+  if (len > 0)
+  {
+    size_t size = 2U + (((size_t)len < (sizeof(buffer) - 4U)) ? (size_t)len : (sizeof(buffer) - 5U));
+    buffer[size] = '\r';
+    buffer[size + 1U] = '\n';
+    sim_write(p_sim, buffer, size + 2U);
+  }
+}
+
+static void sim_delay_us(uint32_t delay_us)
+{
+  if (delay_us != 0U)
+  {
+    struct timespec ts;
+    ts.tv_sec = (time_t)(delay_us / 1000000U);
+    ts.tv_nsec = (long)(delay_us % 1000000U) * 1000L;
+    while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+    {
+      /* remaining time in ts */
+    }
+  }
+}
+
+/**
+  * @brief  Unescape a script text: \r \n \t \\ \" and \xHH.
+  * @param  p_in  - text.
+  * @param  p_out - unescaped bytes (size >= strlen(p_in)).
+  * @retval size_t - number of unescaped bytes.
+  */
+static size_t sim_unescape(const char *p_in, char *p_out)
+{
+  size_t len = 0U;
+
+  while (*p_in != '\0')
+  {
+    if ((p_in[0] == '\\') && (p_in[1] != '\0'))
+    {
+      p_in++;
+      switch (*p_in)
+      {
+        case 'r':
+          p_out[len] = '\r';
+          break;
+        case 'n':
+          p_out[len] = '\n';
+          break;
+        case 't':
+          p_out[len] = '\t';
+          break;
+        case 'x':
+          if ((p_in[1] != '\0') && (p_in[2] != '\0'))
+          {
+            char hex[3] = {p_in[1], p_in[2], '\0'};
+            p_out[len] = (char)strtoul(hex, NULL, 16);
+            p_in += 2;
+          }
+          break;
+        default:
+          p_out[len] = *p_in;
+          break;
+      }
+    }
+    else
+    {
+      p_out[len] = *p_in;
+    }
+    len++;
+    p_in++;
+  }
+  p_out[len] = '\0';
+
+  return (len);
+}
+
+static sim_action_t *sim_action_new(sim_action_type_t type, const char *p_text)
+{
+  sim_action_t *p_action = calloc(1U, sizeof(sim_action_t));
+
+  if (p_action != NULL)
+  {
+    p_action->type = type;
+    if (type == SIM_ACTION_DELAY)
+    {
+      p_action->delay_ms = (uint32_t)strtoul(p_text, NULL, 10);
+    }
+    else
+    {
+      p_action->p_data = malloc(strlen(p_text) + 1U);
+      if (p_action->p_data != NULL)
+      {
+        p_action->len = sim_unescape(p_text, p_action->p_data);
+      }
+    }
+  }
+
+  return (p_action);
+}
+
+static void sim_actions_append(sim_action_t **pp_list, sim_action_t *p_action)
+{
+  while (*pp_list != NULL)
+  {
+    pp_list = &(*pp_list)->p_next;
+  }
+  *pp_list = p_action;
+}
+
+static void sim_actions_play(modem_sim_t *p_sim, const sim_action_t *p_action)
+{
+  while (p_action != NULL)
+  {
+    switch (p_action->type)
+    {
+      case SIM_ACTION_SEND:
+        sim_write(p_sim, "\r\n", 2U);
+        sim_write(p_sim, p_action->p_data, p_action->len);
+        sim_write(p_sim, "\r\n", 2U);
+        break;
+      case SIM_ACTION_RAW:
+        sim_write(p_sim, p_action->p_data, p_action->len);
+        break;
+      default:
+        sim_delay_us(p_action->delay_ms * 1000U);
+        break;
+    }
+    p_action = p_action->p_next;
+  }
+}
+
+static bool sim_is_prefix(const char *p_line, const char *p_prefix)
+{
+  return ((strncmp(p_line, p_prefix, strlen(p_prefix)) == 0) ? true : false);
+}
+
+/**
+  * @brief  Get an integer parameter of a comma separated list (quoted strings skipped).
+  * @param  p_params - parameters.
+  * @param  index    - parameter index, from 0.
+  * @retval int32_t - value, -1 if absent.
+  */
+static int32_t sim_param_int(const char *p_params, uint32_t index)
+{
+  char value[32];
+  int32_t ret = -1;
+
+  if ((sim_param_str(p_params, index, value, sizeof(value)) == true) && (value[0] != '\0'))
+  {
+    ret = (int32_t)strtol(value, NULL, 10);
+  }
+
+  return (ret);
+}
+
+/**
+  * @brief  Get a parameter of a comma separated list, without its quotes.
+  * @param  p_params - parameters.
+  * @param  index    - parameter index, from 0.
+  * @param  p_out    - parameter.
+  * @param  out_size - parameter buffer size.
+  * @retval bool - false if absent.
+  */
+static bool sim_param_str(const char *p_params, uint32_t index, char *p_out, size_t out_size)
+{
+  uint32_t current = 0U;
+  bool quoted = false;
+  size_t len = 0U;
+
+  while ((*p_params != '\0') && (current <= index))
+  {
+    if (*p_params == '"')
+    {
+      quoted = !quoted;
+    }
+    else if ((*p_params == ',') && (quoted == false))
+    {
+      current++;
+    }
+    else if ((current == index) && (len < (out_size - 1U)))
+    {
+      p_out[len] = *p_params;
+      len++;
+    }
+    else
+    {
+      /* other parameter */
+    }
+    p_params++;
+  }
+  p_out[len] = '\0';
+
+  return ((current >= index) ? true : false);
+}
+
+static sim_socket_t *sim_socket(modem_sim_t *p_sim, int32_t socket_id)
+{
+  return (((socket_id >= 0) && ((uint32_t)socket_id < MODEM_SIM_SOCKET_NB)) ? &p_sim->sockets[socket_id] : NULL);
+}
+
+/**
+  * @brief  Echo server: data sent on a socket are received back, then notified by an URC.
+  */
+static void sim_socket_echo(modem_sim_t *p_sim, uint32_t socket_id, const uint8_t *p_data, size_t len)
+{
+  sim_socket_t *p_socket = sim_socket(p_sim, (int32_t)socket_id);
+
+  if ((p_socket != NULL) && (p_socket->open == true))
+  {
+    bool notify = (p_socket->len == 0U) ? true : false;
+    size_t copy = MODEM_SIM_SOCKET_BUFSIZE - p_socket->len;
+    copy = (len < copy) ? len : copy;
+    (void)memcpy(&p_socket->buf[p_socket->len], p_data, copy);
+    p_socket->len += copy;
+    p_socket->total_len += (uint32_t)copy;
+
+    (void)pthread_mutex_lock(&p_sim->stats_lock);
+    p_sim->stats.tx_bytes += (uint32_t)len;
+    (void)pthread_mutex_unlock(&p_sim->stats_lock);
+
+    /* as the modems, notify only when the receive buffer was empty */
+    if (notify == true)
+    {
+      if (p_sim->model == MODEM_SIM_BG96)
+      {
+        sim_line(p_sim, "+QIURC: \"recv\",%u", socket_id);
+      }
+      else
+      {
+        sim_line(p_sim, "%%SOCKETEV:1,%u", socket_id);
+      }
+    }
+  }
+}
+
+static size_t sim_socket_read(modem_sim_t *p_sim, uint32_t socket_id, uint8_t *p_data, size_t len)
+{
+  sim_socket_t *p_socket = sim_socket(p_sim, (int32_t)socket_id);
+  size_t read_len = 0U;
+
+  if (p_socket != NULL)
+  {
+    read_len = (len < p_socket->len) ? len : p_socket->len;
+    (void)memcpy(p_data, p_socket->buf, read_len);
+    (void)memmove(p_socket->buf, &p_socket->buf[read_len], p_socket->len - read_len);
+    p_socket->len -= read_len;
+    p_socket->read_len += (uint32_t)read_len;
+
+    (void)pthread_mutex_lock(&p_sim->stats_lock);
+    p_sim->stats.rx_bytes += (uint32_t)read_len;
+    (void)pthread_mutex_unlock(&p_sim->stats_lock);
+  }
+
+  return (read_len);
+}
+
+/**
+  * @brief  Information line answering a query of the model or a common (3GPP 27.007) query.
+  * @param  p_sim - simulator.
+  * @param  p_cmd - command without "AT".
+  * @retval const char * - information line, NULL if the command is not a known query.
+  */
+static const char *sim_query(const modem_sim_t *p_sim, const char *p_cmd)
+{
+  const sim_query_t *p_tables[2];
+  const char *p_answer = NULL;
+
+  p_tables[0] = (p_sim->model == MODEM_SIM_BG96) ? sim_bg96_queries : sim_type1sc_queries;
+  p_tables[1] = sim_common_queries;
+  for (uint32_t t = 0U; (t < 2U) && (p_answer == NULL); t++)
+  {
+    for (const sim_query_t *p_query = p_tables[t]; (p_query->p_prefix != NULL) && (p_answer == NULL); p_query++)
+    {
+      if (sim_is_prefix(p_cmd, p_query->p_prefix) == true)
+      {
+        p_answer = p_query->p_answer;
+      }
+    }
+  }
+
+  return (p_answer);
+}
+
+/**
+  * @brief  Compound command (e.g AT+CEREG?;+CREG?;+CGREG?): the information lines of each query then OK.
+  * @param  p_sim  - simulator.
+  * @param  p_line - command line.
+  */
+static void sim_compound_command(modem_sim_t *p_sim, const char *p_line)
+{
+  char command[64];
+  const char *p_cmd = &p_line[2];
+
+  while (*p_cmd != '\0')
+  {
+    const char *p_end = strchr(p_cmd, ';');
+    size_t len = (p_end != NULL) ? (size_t)(p_end - p_cmd) : strlen(p_cmd);
+    const char *p_answer;
+
+    len = (len < (sizeof(command) - 1U)) ? len : (sizeof(command) - 1U);
+    (void)memcpy(command, p_cmd, len);
+    command[len] = '\0';
+    p_answer = sim_query(p_sim, command);
+    if (p_answer != NULL)
+    {
+      sim_line(p_sim, "%s", p_answer);
+    }
+    p_cmd = (p_end != NULL) ? &p_end[1] : &p_cmd[strlen(p_cmd)];
+  }
+  sim_line(p_sim, "OK");
+}
+
+static void sim_bg96_command(modem_sim_t *p_sim, const char *p_cmd)
+{
+  const char *p_answer = sim_query(p_sim, p_cmd);
+
+  if (p_answer != NULL)
+  {
+    sim_line(p_sim, "%s", p_answer);
+    sim_line(p_sim, "OK");
+  }
+  else if (sim_is_prefix(p_cmd, "+QIOPEN=") == true)
+  {
+    /* AT+QIOPEN=<contextID>,<connectID>,"TCP","<addr>",<port>,<local_port>,<access_mode> */
+    int32_t socket_id = sim_param_int(&p_cmd[8], 1U);
+    sim_socket_t *p_socket = sim_socket(p_sim, socket_id);
+    sim_line(p_sim, "OK");
+    if (p_socket != NULL)
+    {
+      p_socket->open = true;
+      p_socket->len = 0U;
+      p_socket->total_len = 0U;
+      p_socket->read_len = 0U;
+    }
+    sim_line(p_sim, "+QIOPEN: %d,%d", socket_id, (p_socket != NULL) ? 0 : 565);
+  }
+  else if (sim_is_prefix(p_cmd, "+QICLOSE=") == true)
+  {
+    sim_socket_t *p_socket = sim_socket(p_sim, sim_param_int(&p_cmd[9], 0U));
+    if (p_socket != NULL)
+    {
+      p_socket->open = false;
+      p_socket->len = 0U;
+    }
+    sim_line(p_sim, "OK");
+  }
+  else if (sim_is_prefix(p_cmd, "+QISEND=") == true)
+  {
+    /* AT+QISEND=<connectID>,<send_length>: prompt then data phase */
+    int32_t socket_id = sim_param_int(&p_cmd[8], 0U);
+    int32_t length = sim_param_int(&p_cmd[8], 1U);
+    if ((sim_socket(p_sim, socket_id) != NULL) && (length > 0) && ((uint32_t)length <= MODEM_SIM_DATA_SIZE))
+    {
+      p_sim->data_socket = (uint32_t)socket_id;
+      p_sim->data_expected = (size_t)length;
+      p_sim->data_len = 0U;
+      sim_write(p_sim, "\r\n> ", 4U);
+    }
+    else
+    {
+      sim_line(p_sim, "ERROR");
+    }
+  }
+  else if ((sim_is_prefix(p_cmd, "+QIRD=") == true) && (sim_param_int(&p_cmd[6], 1U) == 0))
+  {
+    /* AT+QIRD=<connectID>,0: query of the received data lengths */
+    sim_socket_t *p_socket = sim_socket(p_sim, sim_param_int(&p_cmd[6], 0U));
+    if (p_socket != NULL)
+    {
+      sim_line(p_sim, "+QIRD: %u,%u,%u", p_socket->total_len, p_socket->read_len, (uint32_t)p_socket->len);
+      sim_line(p_sim, "OK");
+    }
+    else
+    {
+      sim_line(p_sim, "ERROR");
+    }
+  }
+  else if (sim_is_prefix(p_cmd, "+QIRD=") == true)
+  {
+    /* AT+QIRD=<connectID>,<read_length> */
+    static uint8_t data[MODEM_SIM_DATA_SIZE];
+    int32_t socket_id = sim_param_int(&p_cmd[6], 0U);
+    int32_t length = sim_param_int(&p_cmd[6], 1U);
+    size_t read_len = sim_socket_read(p_sim, (uint32_t)socket_id, data,
+                                      ((length > 0) && ((uint32_t)length < MODEM_SIM_DATA_SIZE)) ?
+                                      (size_t)length : MODEM_SIM_DATA_SIZE);
+    char header[32];
+    int header_len = snprintf(header, sizeof(header), "\r\n+QIRD: %u\r\n", (uint32_t)read_len);
+    sim_write(p_sim, header, (size_t)header_len);
+    sim_write(p_sim, data, read_len);
+    sim_write(p_sim, "\r\n\r\nOK\r\n", 8U);
+  }
+  else if (sim_is_prefix(p_cmd, "+QIDNSGIP=") == true)
+  {
+    sim_line(p_sim, "OK");
+    sim_line(p_sim, "+QIURC: \"dnsgip\",0,1,600");
+    sim_line(p_sim, "+QIURC: \"dnsgip\",\"%s\"", MODEM_SIM_DNS_ADDR);
+  }
+  else if (sim_is_prefix(p_cmd, "+QPING=") == true)
+  {
+    /* AT+QPING=<contextID>,"<host>"[,<timeout>[,<pingnum>]] */
+    char host[64];
+    int32_t count = sim_param_int(&p_cmd[7], 3U);
+    count = (count > 0) ? count : 4;
+    (void)sim_param_str(&p_cmd[7], 1U, host, sizeof(host));
+    sim_line(p_sim, "OK");
+    for (int32_t i = 0; i < count; i++)
+    {
+      sim_line(p_sim, "+QPING: 0,\"%s\",32,1,255", host);
+    }
+    sim_line(p_sim, "+QPING: 0,%d,%d,0,1,1,1", count, count);
+  }
+  else
+  {
+    /* settings and unknown commands */
+    sim_line(p_sim, "OK");
+  }
+}
+
+static void sim_type1sc_command(modem_sim_t *p_sim, const char *p_cmd)
+{
+  const char *p_answer = sim_query(p_sim, p_cmd);
+
+  if (p_answer != NULL)
+  {
+    sim_line(p_sim, "%s", p_answer);
+    sim_line(p_sim, "OK");
+  }
+  else if (sim_is_prefix(p_cmd, "%SOCKETCMD=") == true)
+  {
+    const char *p_params = &p_cmd[11];
+    char action[16];
+    (void)sim_param_str(p_params, 0U, action, sizeof(action));
+    if (strcmp(action, "ALLOCATE") == 0)
+    {
+      /* socket id allocated by the modem: first free one, from 1 */
+      uint32_t socket_id = 1U;
+      while ((socket_id < MODEM_SIM_SOCKET_NB) && (p_sim->sockets[socket_id].open == true))
+      {
+        socket_id++;
+      }
+      if (socket_id < MODEM_SIM_SOCKET_NB)
+      {
+        p_sim->sockets[socket_id].open = true;
+        p_sim->sockets[socket_id].len = 0U;
+        p_sim->sockets[socket_id].total_len = 0U;
+        p_sim->sockets[socket_id].read_len = 0U;
+        sim_line(p_sim, "%%SOCKETCMD:%u", socket_id);
+        sim_line(p_sim, "OK");
+      }
+      else
+      {
+        sim_line(p_sim, "ERROR");
+      }
+    }
+    else if (strcmp(action, "INFO") == 0)
+    {
+      sim_line(p_sim, "%%SOCKETCMD:\"CONNECTED\",\"TCP\",\"%s\",\"%s\",49152,7,0,0", MODEM_SIM_IP_ADDR,
+               MODEM_SIM_DNS_ADDR);
+      sim_line(p_sim, "OK");
+    }
+    else if (strcmp(action, "DELETE") == 0)
+    {
+      sim_socket_t *p_socket = sim_socket(p_sim, sim_param_int(p_params, 1U));
+      if (p_socket != NULL)
+      {
+        p_socket->open = false;
+        p_socket->len = 0U;
+      }
+      sim_line(p_sim, "OK");
+    }
+    else
+    {
+      /* ACTIVATE, DEACTIVATE, SSLALLOC... */
+      sim_line(p_sim, "OK");
+    }
+  }
+  else if (sim_is_prefix(p_cmd, "%SOCKETDATA=") == true)
+  {
+    const char *p_params = &p_cmd[12];
+    char action[16];
+    int32_t socket_id = sim_param_int(p_params, 1U);
+    int32_t length = sim_param_int(p_params, 2U);
+    char format[8] = "";
+    (void)sim_param_str(p_params, 0U, action, sizeof(action));
+    (void)sim_param_str(p_params, 3U, format, sizeof(format));
+    if ((strcmp(action, "SEND") == 0) && (strcmp(format, "BIN") == 0))
+    {
+      /* AT%SOCKETDATA="SEND",<socket_id>,<length>,"BIN": prompt then data phase */
+      if ((sim_socket(p_sim, socket_id) != NULL) && (length > 0) && ((uint32_t)length <= MODEM_SIM_DATA_SIZE))
+      {
+        p_sim->data_socket = (uint32_t)socket_id;
+        p_sim->data_expected = (size_t)length;
+        p_sim->data_len = 0U;
+        sim_write(p_sim, "\r\n> ", 4U);
+      }
+      else
+      {
+        sim_line(p_sim, "ERROR");
+      }
+    }
+    else if ((strcmp(action, "SEND") == 0) && (length >= 0))
+    {
+      /* AT%SOCKETDATA="SEND",<socket_id>,<length>,"<hexadecimal data>" */
+      static char hex[MODEM_SIM_LINE_SIZE];
+      static uint8_t data[MODEM_SIM_LINE_SIZE / 2U];
+      size_t size;
+      (void)sim_param_str(p_params, 3U, hex, sizeof(hex));
+      size = strlen(hex) / 2U;
+      for (size_t i = 0U; i < size; i++)
+      {
+        char byte[3] = {hex[2U * i], hex[(2U * i) + 1U], '\0'};
+        data[i] = (uint8_t)strtoul(byte, NULL, 16);
+      }
+      sim_line(p_sim, "%%SOCKETDATA:%d,%u", socket_id, (uint32_t)size);
+      sim_line(p_sim, "OK");
+      sim_socket_echo(p_sim, (uint32_t)socket_id, data, size);
+    }
+    else if ((strcmp(action, "RECEIVE") == 0) && (strcmp(format, "BIN") == 0))
+    {
+      /* AT%SOCKETDATA="RECEIVE",<socket_id>,<max_length>,"BIN": header line then <rlength> raw bytes */
+      static uint8_t data[MODEM_SIM_DATA_SIZE];
+      size_t read_len = sim_socket_read(p_sim, (uint32_t)socket_id, data,
+                                        ((length > 0) && ((uint32_t)length < MODEM_SIM_DATA_SIZE)) ?
+                                        (size_t)length : MODEM_SIM_DATA_SIZE);
+      sim_socket_t *p_socket = sim_socket(p_sim, socket_id);
+      sim_line(p_sim, "%%SOCKETDATA:%d,%u,%u,\"BIN\"", socket_id, (uint32_t)read_len,
+               ((p_socket != NULL) && (p_socket->len != 0U)) ? 1U : 0U);
+      if (read_len != 0U)
+      {
+        sim_write(p_sim, data, read_len);
+        sim_write(p_sim, "\r\n", 2U);
+      }
+      sim_line(p_sim, "OK");
+    }
+    else if (strcmp(action, "RECEIVE") == 0)
+    {
+      /* AT%SOCKETDATA="RECEIVE",<socket_id>,<max_length> */
+      static uint8_t data[MODEM_SIM_DATA_SIZE];
+      static char answer[(2U * MODEM_SIM_DATA_SIZE) + 64U];
+      size_t read_len = sim_socket_read(p_sim, (uint32_t)socket_id, data,
+                                        ((length > 0) && ((uint32_t)length < MODEM_SIM_DATA_SIZE)) ?
+                                        (size_t)length : MODEM_SIM_DATA_SIZE);
+      sim_socket_t *p_socket = sim_socket(p_sim, socket_id);
+      int len = snprintf(answer, sizeof(answer), "%%SOCKETDATA:%d,%u,%u,\"", socket_id, (uint32_t)read_len,
+                         ((p_socket != NULL) && (p_socket->len != 0U)) ? 1U : 0U);
+      for (size_t i = 0U; i < read_len; i++)
+      {
+        answer[len] = sim_hex_digits[data[i] >> 4];
+        answer[len + 1] = sim_hex_digits[data[i] & 0x0FU];
+        len += 2;
+      }
+      answer[len] = '"';
+      answer[len + 1] = '\0';
+      sim_line(p_sim, "%s", answer);
+      sim_line(p_sim, "OK");
+    }
+    else
+    {
+      sim_line(p_sim, "ERROR");
+    }
+  }
+  else if (sim_is_prefix(p_cmd, "%DNSRSLV=") == true)
+  {
+    sim_line(p_sim, "%%DNSRSLV:0,\"%s\"", MODEM_SIM_DNS_ADDR);
+    sim_line(p_sim, "OK");
+  }
+  else
+  {
+    /* settings and unknown commands */
+    sim_line(p_sim, "OK");
+  }
+}
+
+/**
+  * @brief  Handle a command line: replay, rules then built-in model.
+  */
+static void sim_command(modem_sim_t *p_sim, const char *p_line)
+{
+  const sim_block_t *p_block = NULL;
+  bool replayed = false;
+
+  (void)pthread_mutex_lock(&p_sim->stats_lock);
+  p_sim->stats.commands++;
+  if (p_sim->p_expect != NULL)
+  {
+    if (sim_is_prefix(p_line, p_sim->p_expect->p_prefix) == true)
+    {
+      p_block = p_sim->p_expect;
+      p_sim->p_expect = p_sim->p_expect->p_next;
+      p_sim->stats.replayed++;
+      replayed = true;
+    }
+    else
+    {
+      p_sim->stats.unexpected++;
+    }
+  }
+  (void)pthread_mutex_unlock(&p_sim->stats_lock);
+
+  if (replayed == false)
+  {
+    for (p_block = p_sim->p_rules; p_block != NULL; p_block = p_block->p_next)
+    {
+      if (sim_is_prefix(p_line, p_block->p_prefix) == true)
+      {
+        break;
+      }
+    }
+  }
+
+  sim_delay_us(p_sim->latency_us);
+  if (p_block != NULL)
+  {
+    sim_actions_play(p_sim, p_block->p_actions);
+  }
+  else if ((p_line[0] != 'A') || (p_line[1] != 'T'))
+  {
+    /* not a command */
+    sim_line(p_sim, "ERROR");
+  }
+  else if (strchr(p_line, ';') != NULL)
+  {
+    sim_compound_command(p_sim, p_line);
+  }
+  else if (p_sim->model == MODEM_SIM_BG96)
+  {
+    sim_bg96_command(p_sim, &p_line[2]);
+  }
+  else
+  {
+    sim_type1sc_command(p_sim, &p_line[2]);
+  }
+}
+
+/**
+  * @brief  End of the BG96 AT+QISEND / TYPE1SC AT%SOCKETDATA="SEND" binary data phase.
+  */
+static void sim_data(modem_sim_t *p_sim)
+{
+  sim_delay_us(p_sim->latency_us);
+  if (p_sim->model == MODEM_SIM_BG96)
+  {
+    sim_line(p_sim, "SEND OK");
+  }
+  else
+  {
+    sim_line(p_sim, "%%SOCKETDATA:%u,%u", p_sim->data_socket, (uint32_t)p_sim->data_len);
+    sim_line(p_sim, "OK");
+  }
+  sim_socket_echo(p_sim, p_sim->data_socket, p_sim->data, p_sim->data_len);
+  p_sim->data_expected = 0U;
+  p_sim->data_len = 0U;
+}
+
+static void *sim_thread(void *p_arg)
+{
+  modem_sim_run((modem_sim_t *)p_arg);
+  return (NULL);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+modem_sim_t *modem_sim_create(modem_sim_model_t model, int fd)
+{
+  modem_sim_t *p_sim = calloc(1U, sizeof(modem_sim_t));
+
+  if (p_sim != NULL)
+  {
+    p_sim->model = model;
+    p_sim->fd = fd;
+    (void)pthread_mutex_init(&p_sim->stats_lock, NULL);
+  }
+
+  return (p_sim);
+}
+
+int32_t modem_sim_load_script(modem_sim_t *p_sim, const char *p_path)
+{
+  int32_t ret = 0;
+  FILE *p_file = fopen(p_path, "r");
+  sim_block_t *p_block = NULL;
+  char line[MODEM_SIM_LINE_SIZE];
+  uint32_t line_nb = 0U;
+
+  if (p_file == NULL)
+  {
+    (void)fprintf(stderr, "modem_sim: cannot open script %s\n", p_path);
+    ret = -1;
+  }
+
+  while ((ret == 0) && (fgets(line, (int)sizeof(line), p_file) != NULL))
+  {
+    char *p_text = line;
+    char *p_arg;
+    size_t len = strlen(line);
+
+    line_nb++;
+    while ((len != 0U) && ((line[len - 1U] == '\n') || (line[len - 1U] == '\r')))
+    {
+      len--;
+      line[len] = '\0';
+    }
+    while ((*p_text == ' ') || (*p_text == '\t'))
+    {
+      p_text++;
+    }
+    if ((*p_text == '\0') || (*p_text == '#'))
+    {
+      continue;
+    }
+
+    p_arg = strchr(p_text, ' ');
+    if (p_arg != NULL)
+    {
+      *p_arg = '\0';
+      p_arg++;
+    }
+    else
+    {
+      p_arg = &p_text[strlen(p_text)];
+    }
+
+    if ((strcmp(p_text, "expect") == 0) || (strcmp(p_text, "on") == 0))
+    {
+      p_block = calloc(1U, sizeof(sim_block_t));
+      if (p_block != NULL)
+      {
+        p_block->p_prefix = malloc(strlen(p_arg) + 1U);
+        if (p_block->p_prefix != NULL)
+        {
+          (void)sim_unescape(p_arg, p_block->p_prefix);
+        }
+        sim_block_t **pp_list = (p_text[0] == 'e') ? &p_sim->p_expect : &p_sim->p_rules;
+        while (*pp_list != NULL)
+        {
+          pp_list = &(*pp_list)->p_next;
+        }
+        *pp_list = p_block;
+      }
+    }
+    else if ((strcmp(p_text, "send") == 0) || (strcmp(p_text, "urc") == 0) || (strcmp(p_text, "raw") == 0)
+             || (strcmp(p_text, "delay") == 0))
+    {
+      sim_action_type_t type = (p_text[0] == 'r') ? SIM_ACTION_RAW :
+                               ((p_text[0] == 'd') ? SIM_ACTION_DELAY : SIM_ACTION_SEND);
+      sim_action_t *p_action = sim_action_new(type, p_arg);
+      sim_actions_append((p_block != NULL) ? &p_block->p_actions : &p_sim->p_boot, p_action);
+    }
+    else
+    {
+      (void)fprintf(stderr, "modem_sim: %s:%u: unknown statement '%s'\n", p_path, line_nb, p_text);
+      ret = -1;
+    }
+  }
+
+  if (p_file != NULL)
+  {
+    (void)fclose(p_file);
+  }
+
+  return (ret);
+}
+
+void modem_sim_set_latency(modem_sim_t *p_sim, uint32_t latency_us)
+{
+  p_sim->latency_us = latency_us;
+}
+
+int32_t modem_sim_start(modem_sim_t *p_sim)
+{
+  int32_t ret = -1;
+
+  if (pthread_create(&p_sim->thread, NULL, sim_thread, p_sim) == 0)
+  {
+    (void)pthread_detach(p_sim->thread);
+    ret = 0;
+  }
+
+  return (ret);
+}
+
+void modem_sim_run(modem_sim_t *p_sim)
+{
+  uint8_t buffer[1024];
+  bool running = true;
+
+  sim_actions_play(p_sim, p_sim->p_boot);
+
+  while (running == true)
+  {
+    ssize_t len = read(p_sim->fd, buffer, sizeof(buffer));
+    if (len <= 0)
+    {
+      running = ((len < 0) && (errno == EINTR)) ? true : false;
+      continue;
+    }
+
+    for (ssize_t i = 0; i < len; i++)
+    {
+      uint8_t byte = buffer[i];
+      if (p_sim->data_expected != 0U)
+      {
+        p_sim->data[p_sim->data_len] = byte;
+        p_sim->data_len++;
+        if (p_sim->data_len == p_sim->data_expected)
+        {
+          sim_data(p_sim);
+        }
+      }
+      else if (byte == (uint8_t)'\r')
+      {
+        if ((p_sim->line_len != 0U) && (p_sim->line_overflow == false))
+        {
+          p_sim->line[p_sim->line_len] = '\0';
+          sim_command(p_sim, p_sim->line);
+        }
+        p_sim->line_len = 0U;
+        p_sim->line_overflow = false;
+      }
+      else if (byte == (uint8_t)'\n')
+      {
+        /* ignored */
+      }
+      else if (p_sim->line_len < (MODEM_SIM_LINE_SIZE - 1U))
+      {
+        p_sim->line[p_sim->line_len] = (char)byte;
+        p_sim->line_len++;
+      }
+      else
+      {
+        p_sim->line_overflow = true;
+      }
+    }
+  }
+}
+
+void modem_sim_get_stats(modem_sim_t *p_sim, modem_sim_stats_t *p_stats)
+{
+  (void)pthread_mutex_lock(&p_sim->stats_lock);
+  *p_stats = p_sim->stats;
+  (void)pthread_mutex_unlock(&p_sim->stats_lock);
+}
+
+bool modem_sim_replay_done(modem_sim_t *p_sim)
+{
+  bool done;
+
+  (void)pthread_mutex_lock(&p_sim->stats_lock);
+  done = (p_sim->p_expect == NULL) ? true : false;
+  (void)pthread_mutex_unlock(&p_sim->stats_lock);
+
+  return (done);
+}
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file    modem_sim_main.c
+  * @author  MCD Application Team
+  * @brief   Stand-alone modem simulator on a pseudo terminal: the slave path
+  *          is printed, to be given to the host programs (HOST_MODEM_TTY) or to
+  *          any terminal / UART bridge.
+  *
+  *          modem_sim [-m bg96|type1sc] [-l latency_us] [script...]
+  *
+  *          The simulator runs until SIGINT / SIGTERM, then prints its statistics.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* posix_openpt, ptsname */
+#endif /* !defined(_GNU_SOURCE) */
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "modem_sim.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the usage.
+  * @param  p_name - program name.
+  * @retval -
+  */
+static void usage(const char *p_name)
+{
+  (void)fprintf(stderr, "usage: %s [-m bg96|type1sc] [-l latency_us] [script...]\n", p_name);
+}
+
+/**
+  * @brief  Open a pseudo terminal in raw mode.
+  * @note   The slave side is kept open: the master does not see a hang-up when a
+  *         program closes the terminal, the next one can connect.
+  * @retval int - master file descriptor, -1 on error.
+  */
+static int open_pty(void)
+{
+  int fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+  if ((fd >= 0) && ((grantpt(fd) != 0) || (unlockpt(fd) != 0)))
+  {
+    (void)close(fd);
+    fd = -1;
+  }
+  if (fd >= 0)
+  {
+    struct termios tio;
+    int fd_slave = open(ptsname(fd), O_RDWR | O_NOCTTY);
+    if ((fd_slave >= 0) && (tcgetattr(fd_slave, &tio) == 0))
+    {
+      cfmakeraw(&tio);
+      (void)tcsetattr(fd_slave, TCSANOW, &tio);
+    }
+  }
+
+  return (fd);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  modem_sim_model_t model = MODEM_SIM_BG96;
+  uint32_t latency_us = 0U;
+  modem_sim_t *p_sim;
+  int ret = EXIT_SUCCESS;
+  int option;
+  int fd;
+
+  while ((option = getopt(argc, argv, "m:l:h")) != -1)
+  {
+    switch (option)
+    {
+      case 'm':
+        if (strcmp(optarg, "type1sc") == 0)
+        {
+          model = MODEM_SIM_TYPE1SC;
+        }
+        else if (strcmp(optarg, "bg96") != 0)
+        {
+          usage(argv[0]);
+          ret = EXIT_FAILURE;
+        }
+        else
+        {
+          model = MODEM_SIM_BG96;
+        }
+        break;
+      case 'l':
+        latency_us = (uint32_t)strtoul(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        ret = EXIT_FAILURE;
+        break;
+    }
+  }
+
+  fd = (ret == EXIT_SUCCESS) ? open_pty() : -1;
+  if ((ret == EXIT_SUCCESS) && (fd < 0))
+  {
+    perror("modem_sim: posix_openpt");
+    ret = EXIT_FAILURE;
+  }
+
+  p_sim = (ret == EXIT_SUCCESS) ? modem_sim_create(model, fd) : NULL;
+  if ((ret == EXIT_SUCCESS) && (p_sim == NULL))
+  {
+    ret = EXIT_FAILURE;
+  }
+
+  for (int i = optind; (i < argc) && (ret == EXIT_SUCCESS); i++)
+  {
+    if (modem_sim_load_script(p_sim, argv[i]) != 0)
+    {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  if (ret == EXIT_SUCCESS)
+  {
+    modem_sim_stats_t stats;
+    sigset_t signals;
+    int signal_nb;
+
+    /* signals are handled by this thread only */
+    (void)sigemptyset(&signals);
+    (void)sigaddset(&signals, SIGINT);
+    (void)sigaddset(&signals, SIGTERM);
+    (void)pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    modem_sim_set_latency(p_sim, latency_us);
+    if (modem_sim_start(p_sim) != 0)
+    {
+      ret = EXIT_FAILURE;
+    }
+    else
+    {
+      (void)printf("%s\n", ptsname(fd));
+      (void)fflush(stdout);
+      (void)sigwait(&signals, &signal_nb);
+    }
+
+    modem_sim_get_stats(p_sim, &stats);
+    (void)fprintf(stderr, "modem_sim: %u commands (%u replayed, %u unexpected), socket data: %u bytes from host,"
+                  " %u bytes to host\n",
+                  stats.commands, stats.replayed, stats.unexpected, stats.tx_bytes, stats.rx_bytes);
+    if (modem_sim_replay_done(p_sim) == false)
+    {
+      (void)fprintf(stderr, "modem_sim: replay not complete\n");
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  return (ret);
+}
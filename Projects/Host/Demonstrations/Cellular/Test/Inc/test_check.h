@@ -0,0 +1,67 @@
+/**
+  ******************************************************************************
+  * @file    test_check.h
+  * @author  MCD Application Team
+  * @brief   Checks of the host tests (Test/Src): TEST_CHECK counts the checks
+  *          and prints the failed ones, test_result prints the tally and gives
+  *          the exit code of the test program.
+  *          Each test program is one translation unit including this header.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Exported macros -----------------------------------------------------------*/
+#define TEST_CHECK(cond, format, args...)                       \
+  do {                                                          \
+    test_checks++;                                              \
+    if (!(cond))                                                \
+    {                                                           \
+      test_failures++;                                          \
+      (void)printf("FAIL %s:%d: " format "\n", __func__, __LINE__, ## args); \
+    }                                                           \
+  } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_checks;
+static uint32_t test_failures;
+
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Print the tally of the checks.
+  * @param  p_name - test name.
+  * @retval int - exit code of the test program: EXIT_SUCCESS if no check failed.
+  */
+static inline int test_result(const char *p_name)
+{
+  (void)printf("%s: %u checks, %u failures\n", p_name, test_checks, test_failures);
+
+  return ((test_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEST_CHECK_H */
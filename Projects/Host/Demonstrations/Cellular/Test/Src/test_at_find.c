@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    test_at_find.c
+  * @author  MCD Application Team
+  * @brief   Host test of the word at a time searches of at_util.c against
+  *          byte loops: ATutil_findChar and ATutil_isPrefix.
+  *
+  *          Built with at_util.c twice: SWAR zero byte test, and __UQSUB8
+  *          (__ARM_FEATURE_DSP set, instruction of the host HAL emulation).
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "at_util.h"
+#include "test_check.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_FIND_SIZE_MAX     (70U)   /* sizes 0 to TEST_FIND_SIZE_MAX - 1 */
+#define TEST_FIND_RANDOM       (20000U)
+
+/* Private variables ---------------------------------------------------------*/
+/* +3: unaligned buffers */
+static uint8_t test_buf[TEST_FIND_SIZE_MAX + 3U];
+
+/* searched characters: null, <CR>, and the characters where a borrow or a high bit can fool a zero byte test */
+static const uint8_t test_characters[] = {0x00U, 0x01U, (uint8_t)'\r', 0x7FU, 0x80U, 0x81U, 0xFEU, 0xFFU};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t test_find_bytewise(const uint8_t *p_buf, uint16_t size, uint8_t character);
+static void test_find(const uint8_t *p_buf, uint16_t size, uint8_t character);
+static void test_find_all(void);
+static void test_prefix(void);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Reference search, byte per byte.
+  * @param  p_buf     - buffer.
+  * @param  size      - buffer size.
+  * @param  character - character to search.
+  * @retval uint16_t - index of the first occurrence, size if not found.
+  */
+static uint16_t test_find_bytewise(const uint8_t *p_buf, uint16_t size, uint8_t character)
+{
+  uint16_t idx = 0U;
+
+  while ((idx < size) && (p_buf[idx] != character))
+  {
+    idx++;
+  }
+
+  return (idx);
+}
+
+/**
+  * @brief  Compare ATutil_findChar to the byte per byte search.
+  * @param  p_buf     - buffer.
+  * @param  size      - buffer size.
+  * @param  character - character to search.
+  * @retval -
+  */
+static void test_find(const uint8_t *p_buf, uint16_t size, uint8_t character)
+{
+  uint16_t expected = test_find_bytewise(p_buf, size, character);
+  uint16_t idx = ATutil_findChar(p_buf, size, character);
+
+  TEST_CHECK(idx == expected, "0x%02x in %u bytes: %u, expected %u", character, size, idx, expected);
+}
+
+/**
+  * @brief  Every size, alignment and position of the character, with neighbours close to the character.
+  * @retval -
+  */
+static void test_find_all(void)
+{
+  for (uint32_t c = 0U; c < sizeof(test_characters); c++)
+  {
+    uint8_t character = test_characters[c];
+
+    for (uint32_t offset = 0U; offset < 4U; offset++)
+    {
+      uint8_t *p_buf = &test_buf[offset];
+
+      for (uint16_t size = 0U; size < TEST_FIND_SIZE_MAX; size++)
+      {
+        /* not found: buffer of character + 1, then character - 1 (borrow and high bit cases) */
+        (void)memset(p_buf, (uint8_t)(character + 1U), size);
+        test_find(p_buf, size, character);
+        (void)memset(p_buf, (uint8_t)(character - 1U), size);
+        test_find(p_buf, size, character);
+
+        for (uint16_t pos = 0U; pos < size; pos++)
+        {
+          /* found at pos, followed by a second occurrence and preceded by character ^ 0x80 */
+          (void)memset(p_buf, (uint8_t)(character ^ 0x80U), size);
+          p_buf[pos] = character;
+          if ((pos + 2U) < size)
+          {
+            p_buf[pos + 1U] = (uint8_t)(character + 1U);
+            p_buf[pos + 2U] = character;
+          }
+          test_find(p_buf, size, character);
+        }
+      }
+    }
+  }
+
+  /* random buffers, characters from a small set to get several occurrences */
+  for (uint32_t n = 0U; n < TEST_FIND_RANDOM; n++)
+  {
+    uint16_t size = (uint16_t)((uint32_t)random() % TEST_FIND_SIZE_MAX);
+    uint32_t offset = (uint32_t)random() % 4U;
+    uint8_t character = test_characters[(uint32_t)random() % sizeof(test_characters)];
+
+    for (uint16_t i = 0U; i < size; i++)
+    {
+      test_buf[offset + i] = ((random() % 8) == 0) ? character : (uint8_t)(character + (random() % 3) - 1);
+    }
+    test_find(&test_buf[offset], size, character);
+  }
+}
+
+/**
+  * @brief  Compare ATutil_isPrefix to memcmp, on every prefix size and position of a difference.
+  * @retval -
+  */
+static void test_prefix(void)
+{
+  static uint8_t prefix[TEST_FIND_SIZE_MAX];
+  uint8_t ret;
+  uint8_t expected;
+
+  for (uint16_t i = 0U; i < TEST_FIND_SIZE_MAX; i++)
+  {
+    prefix[i] = (uint8_t)(random() & 0xFF);
+  }
+
+  for (uint32_t offset = 0U; offset < 4U; offset++)
+  {
+    uint8_t *p_buf = &test_buf[offset];
+
+    for (uint16_t prefix_size = 0U; prefix_size < 12U; prefix_size++)
+    {
+      for (uint16_t size = 0U; size < 16U; size++)
+      {
+        /* buffer starting with the prefix (truncated when the buffer is smaller) */
+        (void)memcpy(p_buf, prefix, size);
+        expected = (size >= prefix_size) ? 1U : 0U;
+        ret = ATutil_isPrefix(p_buf, size, prefix, prefix_size);
+        TEST_CHECK(ret == expected, "prefix %u in %u bytes: %u, expected %u", prefix_size, size, ret, expected);
+
+        /* one difference at each position */
+        for (uint16_t pos = 0U; pos < size; pos++)
+        {
+          p_buf[pos] ^= 0x20U;
+          expected = ((size >= prefix_size) && (memcmp(p_buf, prefix, prefix_size) == 0)) ? 1U : 0U;
+          ret = ATutil_isPrefix(p_buf, size, prefix, prefix_size);
+          TEST_CHECK(ret == expected, "prefix %u in %u bytes, difference at %u: %u, expected %u",
+                     prefix_size, size, pos, ret, expected);
+          p_buf[pos] ^= 0x20U;
+        }
+      }
+    }
+  }
+
+  /* header prefix of the BG96 socket data */
+  ret = ATutil_isPrefix((const uint8_t *)"+QIRD: 12\r\n", 11U, (const uint8_t *)"+QIRD", 5U);
+  TEST_CHECK(ret == 1U, "+QIRD header not detected");
+  ret = ATutil_isPrefix((const uint8_t *)"+QIRD", 4U, (const uint8_t *)"+QIRD", 5U);
+  TEST_CHECK(ret == 0U, "+QIR detected as +QIRD");
+  ret = ATutil_isPrefix((const uint8_t *)"+QIURC: \"recv\"", 14U, (const uint8_t *)"+QIRD", 5U);
+  TEST_CHECK(ret == 0U, "+QIURC detected as +QIRD");
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  srandom(8U);
+
+  test_find_all();
+  test_prefix();
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+  return (test_result("test_at_find (__UQSUB8)"));
+#else
+  return (test_result("test_at_find (SWAR)"));
+#endif /* __ARM_FEATURE_DSP */
+}
@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file    test_at_hex.c
+  * @author  MCD Application Team
+  * @brief   Host test of the AT_Core hex codec (at_util.c):
+  *          ATutil_convertBufferToHexaString against sprintf("%02x"), and
+  *          ATutil_convertHexaStringToBuffer on lower, upper and mixed case
+  *          digits and on strings with one invalid digit at each position,
+  *          for even and odd sizes and unaligned buffers.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "at_util.h"
+#include "test_check.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_HEX_SIZE_MAX   (130U)  /* sizes 0 to TEST_HEX_SIZE_MAX - 1 */
+#define TEST_HEX_GUARD      (0xA5U) /* byte after the converted data, must not be written */
+
+/* Private variables ---------------------------------------------------------*/
+/* +1: unaligned accesses, +1: guard */
+static uint8_t test_buf[TEST_HEX_SIZE_MAX + 2U];
+static uint8_t test_str[(2U * TEST_HEX_SIZE_MAX) + 2U];
+static uint8_t test_ref[(2U * TEST_HEX_SIZE_MAX) + 1U];
+static uint8_t test_out[TEST_HEX_SIZE_MAX + 2U];
+
+/* characters which are not hexadecimal digits, next to the digit ranges and at the table bounds */
+static const uint8_t test_invalid_digits[] =
+{
+  0x00U, (uint8_t)' ', (uint8_t)'/', (uint8_t)':', (uint8_t)'@', (uint8_t)'G', (uint8_t)'`', (uint8_t)'g',
+  (uint8_t)'x', 0x80U, 0xB0U, 0xC1U, 0xE6U, 0xFFU
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_encode(uint16_t size, uint32_t offset);
+static void test_decode(uint16_t size, uint32_t offset);
+static void test_decode_invalid(uint16_t size);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Encode random data and compare to sprintf("%02x").
+  * @param  size   - data size.
+  * @param  offset - offset of the data and of the string (0 or 1, for unaligned accesses).
+  * @retval -
+  */
+static void test_encode(uint16_t size, uint32_t offset)
+{
+  uint8_t *p_str = &test_str[offset];
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    test_buf[offset + i] = (uint8_t)(random() & 0xFFU);
+    (void)sprintf((char *)&test_ref[2U * i], "%02x", test_buf[offset + i]);
+  }
+  p_str[2U * size] = TEST_HEX_GUARD;
+
+  ATutil_convertBufferToHexaString(&test_buf[offset], size, p_str);
+
+  TEST_CHECK(memcmp(p_str, test_ref, 2U * (size_t)size) == 0, "size %u offset %u: \"%.*s\", expected \"%.*s\"",
+             size, offset, 2 * size, p_str, 2 * size, test_ref);
+  TEST_CHECK(p_str[2U * size] == TEST_HEX_GUARD, "size %u offset %u: written after the string", size, offset);
+}
+
+/**
+  * @brief  Decode the string of random data in lower, upper then mixed case.
+  * @param  size   - data size.
+  * @param  offset - offset of the string and of the data (0 or 1, for unaligned accesses).
+  * @retval -
+  */
+static void test_decode(uint16_t size, uint32_t offset)
+{
+  uint8_t *p_str = &test_str[offset];
+  uint8_t *p_out = &test_out[offset];
+  uint8_t ret;
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    test_buf[i] = (uint8_t)(random() & 0xFFU);
+    (void)sprintf((char *)&p_str[2U * i], "%02x", test_buf[i]);
+  }
+
+  for (uint32_t letter_case = 0U; letter_case < 3U; letter_case++)
+  {
+    for (uint32_t i = 0U; (i < (2U * size)) && (letter_case != 0U); i++)
+    {
+      /* 1: upper case, 2: alternate case */
+      if ((letter_case == 1U) || ((i & 1U) != 0U))
+      {
+        p_str[i] = (uint8_t)toupper(p_str[i]);
+      }
+      else
+      {
+        p_str[i] = (uint8_t)tolower(p_str[i]);
+      }
+    }
+    p_out[size] = TEST_HEX_GUARD;
+
+    ret = ATutil_convertHexaStringToBuffer(p_str, size, p_out);
+
+    TEST_CHECK(ret == 1U, "size %u offset %u case %u: \"%.*s\" rejected", size, offset, letter_case,
+               2 * size, p_str);
+    TEST_CHECK(memcmp(p_out, test_buf, size) == 0, "size %u offset %u case %u: wrong data", size, offset,
+               letter_case);
+    TEST_CHECK(p_out[size] == TEST_HEX_GUARD, "size %u offset %u case %u: written after the data", size, offset,
+               letter_case);
+  }
+}
+
+/**
+  * @brief  Every invalid character at every position of a valid string is detected
+  *         (last digit of an odd size string included).
+  * @param  size - data size.
+  * @retval -
+  */
+static void test_decode_invalid(uint16_t size)
+{
+  uint8_t ret;
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    (void)sprintf((char *)&test_str[2U * i], "%02X", (uint8_t)(random() & 0xFFU));
+  }
+
+  for (uint32_t pos = 0U; pos < (2U * size); pos++)
+  {
+    uint8_t digit = test_str[pos];
+
+    for (uint32_t c = 0U; c < sizeof(test_invalid_digits); c++)
+    {
+      test_str[pos] = test_invalid_digits[c];
+      ret = ATutil_convertHexaStringToBuffer(test_str, size, test_out);
+      TEST_CHECK(ret == 0U, "size %u: 0x%02x at position %u accepted", size, test_invalid_digits[c], pos);
+    }
+    test_str[pos] = digit;
+  }
+
+  ret = ATutil_convertHexaStringToBuffer(test_str, size, test_out);
+  TEST_CHECK(ret == 1U, "size %u: valid string rejected", size);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  srandom(16U);
+
+  for (uint16_t size = 0U; size < TEST_HEX_SIZE_MAX; size++)
+  {
+    for (uint32_t offset = 0U; offset < 2U; offset++)
+    {
+      test_encode(size, offset);
+      test_decode(size, offset);
+    }
+    test_decode_invalid(size);
+  }
+
+  return (test_result("test_at_hex"));
+}
@@ -0,0 +1,371 @@
+/**
+  ******************************************************************************
+  * @file    test_at_span.c
+  * @author  MCD Application Team
+  * @brief   Host test of the end of message search on received spans
+  *          (ATCustom_<modem>_checkEndOfMsgSpanCallback) against the character
+  *          by character search (ATCustom_<modem>_checkEndOfMsgCallback).
+  *
+  *          Modem answers, socket prompt, socket data (header, data containing
+  *          <CR><LF> and header prefixes) and random traffic are cut in spans
+  *          as IPC_RXFIFO_writeCharacterSpan does: whole stream, every cut in
+  *          two spans (so every split of a "+QIRD" / "+SQNSRECV" / "%SOCKETDATA:"
+  *          header) and random cuts. The ends of message and the automaton
+  *          state after each span have to be the ones of the character search.
+  *
+  *          Built once per modem: the automaton context is private to
+  *          at_custom_modem_specific.c, which is included below.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* modem automaton and its private context */
+#include "at_custom_modem_specific.c"
+
+#include "test_check.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_SPAN_STREAM_SIZE   (4096U)
+#define TEST_SPAN_MSG_MAX       (512U)
+#define TEST_SPAN_RANDOM_CUTS   (300U)
+#define TEST_SPAN_CUT_MAX       (64U)   /* maximum span size of the random cuts */
+#define TEST_SPAN_FUZZ_STREAMS  (200U)
+
+#if defined(USE_MODEM_BG96)
+#define TEST_SPAN_MODEM         "BG96"
+#define TEST_SPAN_CTXT          BG96_ctxt
+#define TEST_SPAN_EOM_CHAR      ATCustom_BG96_checkEndOfMsgCallback
+#define TEST_SPAN_EOM_SPAN      ATCustom_BG96_checkEndOfMsgSpanCallback
+#define TEST_SPAN_URC           "\r\n+QIURC: \"recv\",1\r\n"
+#define TEST_SPAN_HEADER        "\r\n+QIRD: %u\r\n"
+#elif defined(USE_MODEM_GM01Q)
+#define TEST_SPAN_MODEM         "MONARCH"
+#define TEST_SPAN_CTXT          SEQMONARCH_ctxt
+#define TEST_SPAN_EOM_CHAR      ATCustom_MONARCH_checkEndOfMsgCallback
+#define TEST_SPAN_EOM_SPAN      ATCustom_MONARCH_checkEndOfMsgSpanCallback
+#define TEST_SPAN_URC           "\r\n+SQNSRING: 1,12\r\n"
+#define TEST_SPAN_HEADER        "\r\n+SQNSRECV: 1,%u\r\n"
+#elif defined(USE_MODEM_TYPE1SC)
+#define TEST_SPAN_MODEM         "TYPE1SC"
+#define TEST_SPAN_CTXT          TYPE1SC_ctxt
+#define TEST_SPAN_EOM_CHAR      ATCustom_TYPE1SC_checkEndOfMsgCallback
+#define TEST_SPAN_EOM_SPAN      ATCustom_TYPE1SC_checkEndOfMsgSpanCallback
+#define TEST_SPAN_URC           "\r\n%%SOCKETEV:1,1\r\n"
+#define TEST_SPAN_HEADER        "\r\n%%SOCKETDATA:1,%u,0,\"BIN\"\r\n"
+#else
+#error test_at_span: modem not supported
+#endif /* USE_MODEM_BG96 */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Automaton state after a character */
+typedef struct
+{
+  atcustom_modem_SyntaxAutomatonState_t syntax;
+  atcustom_socket_RxData_state_t        rx_data;
+  atcustom_socket_send_state_t          send;
+  uint32_t                              expected;
+  uint32_t                              received;
+  uint32_t                              header[3];  /* modem specific header analysis */
+} test_span_state_t;
+
+/* Initial automaton state of a stream */
+typedef struct
+{
+  atcustom_modem_SyntaxAutomatonState_t syntax;
+  atcustom_socket_RxData_state_t        rx_data;
+  atcustom_socket_send_state_t          send;
+  uint32_t                              expected;
+} test_span_init_t;
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t test_stream[TEST_SPAN_STREAM_SIZE];
+static uint16_t test_stream_size;
+
+/* character search: state after each character and ends of message */
+static test_span_state_t test_ref_state[TEST_SPAN_STREAM_SIZE];
+static uint16_t test_ref_end[TEST_SPAN_MSG_MAX];
+static uint16_t test_ref_end_nb;
+
+/* characters which drive the automatons, the socket data are built with them */
+static const uint8_t test_alphabet[] = "\r\n\r\n+QIRD: 12,SQNSRECV%SOCKETDATA:> 0123456789\"BIN\"OK";
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_span_set(const test_span_init_t *p_init);
+static void test_span_get(test_span_state_t *p_state);
+static void test_span_append(const char *p_format, uint32_t value);
+static void test_span_append_data(uint32_t size);
+static void test_span_reference(const test_span_init_t *p_init);
+static void test_span_run(const test_span_init_t *p_init, const uint16_t *p_cut, uint16_t cut_nb, const char *p_name);
+static void test_span_stream(const test_span_init_t *p_init, const char *p_name);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Set the automaton state (and reset the header analysis).
+  * @param  p_init - state to set.
+  * @retval -
+  */
+static void test_span_set(const test_span_init_t *p_init)
+{
+  TEST_SPAN_CTXT.state_SyntaxAutomaton = p_init->syntax;
+  TEST_SPAN_CTXT.socket_ctxt.socket_RxData_state = p_init->rx_data;
+  TEST_SPAN_CTXT.socket_ctxt.socket_send_state = p_init->send;
+  TEST_SPAN_CTXT.socket_ctxt.socket_rx_expected_buf_size = p_init->expected;
+  TEST_SPAN_CTXT.socket_ctxt.socket_rx_count_bytes_received = 0U;
+#if defined(USE_MODEM_BG96)
+  QIRD_Counter = 0U;
+  socketHeaderRX_reset();
+#elif defined(USE_MODEM_GM01Q)
+  socketHeaderRX_reset();
+#else
+  SOCKETDATA_Counter = 0U;
+  SocketHeaderRx_Field = 0U;
+#endif /* USE_MODEM_BG96 */
+}
+
+/**
+  * @brief  Get the automaton state.
+  * @param  p_state - state.
+  * @retval -
+  */
+static void test_span_get(test_span_state_t *p_state)
+{
+  (void)memset(p_state, 0, sizeof(test_span_state_t));
+  p_state->syntax = TEST_SPAN_CTXT.state_SyntaxAutomaton;
+  p_state->rx_data = TEST_SPAN_CTXT.socket_ctxt.socket_RxData_state;
+  p_state->send = TEST_SPAN_CTXT.socket_ctxt.socket_send_state;
+  p_state->expected = TEST_SPAN_CTXT.socket_ctxt.socket_rx_expected_buf_size;
+  p_state->received = TEST_SPAN_CTXT.socket_ctxt.socket_rx_count_bytes_received;
+#if defined(USE_MODEM_BG96)
+  p_state->header[0] = QIRD_Counter;
+  p_state->header[1] = SocketHeaderDataRx_Cpt;
+  p_state->header[2] = SocketHeaderDataRx_Cpt_Complete;
+#elif defined(USE_MODEM_GM01Q)
+  p_state->header[0] = (uint32_t)monarch_shared.RxSQNSRECV_header_info.analyze_state;
+  p_state->header[1] = monarch_shared.RxSQNSRECV_header_info.counter_header;
+  p_state->header[2] = monarch_shared.RxSQNSRECV_header_info.counter_maxByte;
+#else
+  p_state->header[0] = SOCKETDATA_Counter;
+  p_state->header[1] = SocketHeaderRx_Field;
+#endif /* USE_MODEM_BG96 */
+}
+
+/**
+  * @brief  Append a formatted string to the stream.
+  * @param  p_format - format, with at most one %u.
+  * @param  value    - value of %u.
+  * @retval -
+  */
+static void test_span_append(const char *p_format, uint32_t value)
+{
+  int size = snprintf((char *)&test_stream[test_stream_size], TEST_SPAN_STREAM_SIZE - test_stream_size,
+                      p_format, value);
+
+  if (size > 0)
+  {
+    test_stream_size += (uint16_t)size;
+  }
+}
+
+/**
+  * @brief  Append socket data to the stream: <CR>, <LF>, header prefixes, prompt and random characters.
+  * @param  size - data size.
+  * @retval -
+  */
+static void test_span_append_data(uint32_t size)
+{
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    test_stream[test_stream_size] = ((random() & 1) == 0) ?
+                                    test_alphabet[(uint32_t)random() % (sizeof(test_alphabet) - 1U)] :
+                                    (uint8_t)(random() & 0xFF);
+    test_stream_size++;
+  }
+}
+
+/**
+  * @brief  Character search on the stream: state after each character and ends of message.
+  * @param  p_init - initial state.
+  * @retval -
+  */
+static void test_span_reference(const test_span_init_t *p_init)
+{
+  test_span_set(p_init);
+  test_ref_end_nb = 0U;
+
+  for (uint16_t idx = 0U; idx < test_stream_size; idx++)
+  {
+    if ((TEST_SPAN_EOM_CHAR(test_stream[idx]) == 1U) && (test_ref_end_nb < TEST_SPAN_MSG_MAX))
+    {
+      test_ref_end[test_ref_end_nb] = idx + 1U;
+      test_ref_end_nb++;
+    }
+    test_span_get(&test_ref_state[idx]);
+  }
+}
+
+/**
+  * @brief  Span search on the stream cut in spans, as IPC_RXFIFO_writeCharacterSpan,
+  *         compared to the character search.
+  * @param  p_init - initial state.
+  * @param  p_cut  - span sizes.
+  * @param  cut_nb - number of spans.
+  * @param  p_name - stream name.
+  * @retval -
+  */
+static void test_span_run(const test_span_init_t *p_init, const uint16_t *p_cut, uint16_t cut_nb, const char *p_name)
+{
+  test_span_state_t state;
+  uint16_t end_nb = 0U;
+  uint16_t span_start = 0U;
+  uint8_t ok = 1U;
+
+  test_span_set(p_init);
+
+  for (uint16_t cut = 0U; (cut < cut_nb) && (ok == 1U); cut++)
+  {
+    uint16_t span_size = p_cut[cut];
+    uint16_t msg_start = 0U;
+    uint16_t msg_size = 1U;
+
+    while ((msg_start < span_size) && (msg_size != 0U) && (ok == 1U))
+    {
+      msg_size = TEST_SPAN_EOM_SPAN(&test_stream[span_start + msg_start], span_size - msg_start);
+      if (msg_size != 0U)
+      {
+        msg_start += msg_size;
+        ok = ((end_nb < test_ref_end_nb) && (test_ref_end[end_nb] == (span_start + msg_start))) ? 1U : 0U;
+        TEST_CHECK(ok == 1U, "%s: span %u (%u bytes at %u): end of message at %u, expected %u", p_name, cut,
+                   span_size, span_start, span_start + msg_start,
+                   (end_nb < test_ref_end_nb) ? test_ref_end[end_nb] : 0U);
+        end_nb++;
+      }
+    }
+
+    span_start += span_size;
+    if ((ok == 1U) && (span_start != 0U))
+    {
+      test_span_get(&state);
+      ok = (memcmp(&state, &test_ref_state[span_start - 1U], sizeof(state)) == 0) ? 1U : 0U;
+      TEST_CHECK(ok == 1U, "%s: span %u (%u bytes, ends at %u): automaton state differs", p_name, cut, span_size,
+                 span_start);
+    }
+  }
+
+  if (ok == 1U)
+  {
+    TEST_CHECK(end_nb == test_ref_end_nb, "%s: %u ends of message, expected %u", p_name, end_nb, test_ref_end_nb);
+  }
+}
+
+/**
+  * @brief  Search the ends of message of the stream: one span, every cut in two spans, random cuts.
+  * @param  p_init - initial state.
+  * @param  p_name - stream name.
+  * @retval -
+  */
+static void test_span_stream(const test_span_init_t *p_init, const char *p_name)
+{
+  static uint16_t cut[TEST_SPAN_STREAM_SIZE];
+  uint16_t cut_nb;
+
+  test_span_reference(p_init);
+
+  cut[0] = test_stream_size;
+  test_span_run(p_init, cut, 1U, p_name);
+
+  for (uint16_t split = 1U; split < test_stream_size; split++)
+  {
+    cut[0] = split;
+    cut[1] = test_stream_size - split;
+    test_span_run(p_init, cut, 2U, p_name);
+  }
+
+  for (uint32_t n = 0U; n < TEST_SPAN_RANDOM_CUTS; n++)
+  {
+    uint16_t remaining = test_stream_size;
+    cut_nb = 0U;
+    while (remaining != 0U)
+    {
+      uint16_t size = (uint16_t)(1U + ((uint32_t)random() % TEST_SPAN_CUT_MAX));
+      cut[cut_nb] = (size < remaining) ? size : remaining;
+      remaining -= cut[cut_nb];
+      cut_nb++;
+    }
+    test_span_run(p_init, cut, cut_nb, p_name);
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  test_span_init_t init;
+  static const uint32_t data_sizes[] = {1U, 2U, 3U, 4U, 5U, 17U, 64U, 255U, 1000U, 1500U};
+
+  srandom(6U);
+
+  /* modem answers, first one after trash characters */
+  init = (test_span_init_t) {WAITING_FOR_INIT_CR, SocketRxDataState_not_started, SocketSendState_No_Activity, 0U};
+  test_stream_size = 0U;
+  test_span_append("trash\r\n+CSQ: 12,99\r\n\r\nOK\r\n\r\n+CEREG: 1,5\r\n\r\nERROR\r\n", 0U);
+  test_span_append(TEST_SPAN_URC, 0U);
+  test_span_append("\r\n\r\nOK\r\n", 0U);
+  test_span_stream(&init, "answers");
+
+  /* socket prompt, after a '>' not followed by a space */
+  init = (test_span_init_t) {WAITING_FOR_FIRST_CHAR, SocketRxDataState_not_started,
+                             SocketSendState_WaitingPrompt1st_greaterthan, 0U
+                            };
+  test_stream_size = 0U;
+  test_span_append("\r\n>x\r\n> ", 0U);
+  test_span_stream(&init, "prompt");
+
+  /* socket data: URC, header, data, OK */
+  for (uint32_t i = 0U; i < (sizeof(data_sizes) / sizeof(data_sizes[0])); i++)
+  {
+    init = (test_span_init_t) {WAITING_FOR_FIRST_CHAR, SocketRxDataState_waiting_header,
+                               SocketSendState_No_Activity, data_sizes[i]
+                              };
+    test_stream_size = 0U;
+    test_span_append(TEST_SPAN_URC, 0U);
+    test_span_append(TEST_SPAN_HEADER, data_sizes[i]);
+    test_span_append_data(data_sizes[i]);
+    test_span_append("\r\n\r\nOK\r\n", 0U);
+    test_span_stream(&init, "socket data");
+
+    /* the character search itself received the data */
+    TEST_CHECK((test_ref_state[test_stream_size - 1U].rx_data == SocketRxDataState_data_received)
+               && (test_ref_state[test_stream_size - 1U].received == data_sizes[i]),
+               "socket data %u: not received by the character search", data_sizes[i]);
+  }
+
+  /* random traffic from every initial state */
+  for (uint32_t n = 0U; n < TEST_SPAN_FUZZ_STREAMS; n++)
+  {
+    init = (test_span_init_t)
+    {
+      (atcustom_modem_SyntaxAutomatonState_t)((uint32_t)random() % ((uint32_t)WAITING_FOR_SOCKET_DATA + 1U)),
+      (atcustom_socket_RxData_state_t)((uint32_t)random() % ((uint32_t)SocketRxDataState_finished + 1U)),
+      (atcustom_socket_send_state_t)((uint32_t)random() % ((uint32_t)SocketSendState_Prompt_Received + 1U)),
+      (uint32_t)random() % 300U
+    };
+    test_stream_size = 0U;
+    test_span_append_data(1U + ((uint32_t)random() % 600U));
+    test_span_stream(&init, "random");
+  }
+
+  return (test_result("test_at_span (" TEST_SPAN_MODEM ")"));
+}
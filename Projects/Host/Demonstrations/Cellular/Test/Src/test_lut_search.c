@@ -0,0 +1,280 @@
+/**
+  ******************************************************************************
+  * @file    test_lut_search.c
+  * @author  MCD Application Team
+  * @brief   Host test of the indexed search of the received commands in the
+  *          modem LUT (LUT_search_indexed) against the linear search
+  *          (LUT_search_linear): both have to return the same LUT entry.
+  *
+  *          Searched strings:
+  *          - every LUT entry, and the same string shortened, lengthened and
+  *            with its last character changed (same length, other hash),
+  *          - the lines of a simulator session (BG96 and TYPE1SC models, boot
+  *            scripts loaded) replaying the queries of every LUT command:
+  *            the whole line and its prefix up to ':'.
+  *
+  *          Built once per modem: the searches are private to
+  *          at_modem_common.c, which is included below.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+/* LUT searches: the index build of the modem init is intercepted to get the modem context */
+#define atcm_build_LUT_index atcm_build_LUT_index_tested
+#include "at_modem_common.c"
+#undef atcm_build_LUT_index
+
+#include "at_custom_modem_specific.h"
+#include "modem_sim.h"
+#include "test_check.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_LUT_LINE_SIZE      (512U)
+#define TEST_LUT_ANSWER_TIMEOUT (200)   /* ms without final result code ending the command */
+
+#if defined(USE_MODEM_BG96)
+#define TEST_LUT_MODEM          "BG96"
+#define TEST_LUT_MODEM_INIT     ATCustom_BG96_init
+#elif defined(USE_MODEM_GM01Q)
+#define TEST_LUT_MODEM          "MONARCH"
+#define TEST_LUT_MODEM_INIT     ATCustom_MONARCH_init
+#elif defined(USE_MODEM_TYPE1SC)
+#define TEST_LUT_MODEM          "TYPE1SC"
+#define TEST_LUT_MODEM_INIT     ATCustom_TYPE1SC_init
+#else
+#error test_lut_search: modem not supported
+#endif /* USE_MODEM_BG96 */
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_found;
+
+static atcustom_modem_context_t *p_test_modem_ctxt;
+static atparser_context_t test_parser_ctxt;
+
+/* Private function prototypes -----------------------------------------------*/
+void atcm_build_LUT_index(atcustom_modem_context_t *p_modem_ctxt);
+static void test_lut_search(const uint8_t *p_str, uint16_t size, const char *p_origin);
+static void test_lut_entries(void);
+static bool test_lut_line(const char *p_line);
+static void test_lut_command(int fd, const char *p_cmd, char *p_line, size_t *p_len);
+static void test_lut_session(modem_sim_model_t model, const char *p_script);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Index build called by the modem init: keep the modem context, then build the index.
+  * @param  p_modem_ctxt - modem context.
+  * @retval -
+  */
+void atcm_build_LUT_index(atcustom_modem_context_t *p_modem_ctxt)
+{
+  p_test_modem_ctxt = p_modem_ctxt;
+  atcm_build_LUT_index_tested(p_modem_ctxt);
+}
+
+/**
+  * @brief  Search a string with both searches and compare the results.
+  * @param  p_str    - string (not null terminated).
+  * @param  size     - string size.
+  * @param  p_origin - origin of the string, for the failure message.
+  * @retval -
+  */
+static void test_lut_search(const uint8_t *p_str, uint16_t size, const char *p_origin)
+{
+  uint16_t linear = LUT_search_linear(p_test_modem_ctxt, p_str, size);
+  uint16_t indexed = LUT_search_indexed(p_test_modem_ctxt, p_str, size);
+
+  TEST_CHECK(linear == indexed, "%s \"%.*s\": linear %u, indexed %u", p_origin, (int)size, (const char *)p_str,
+             linear, indexed);
+  if (linear != LUT_ENTRY_NOT_FOUND)
+  {
+    test_found++;
+  }
+}
+
+/**
+  * @brief  Search every LUT entry, shortened, lengthened and with its last character changed.
+  * @retval -
+  */
+static void test_lut_entries(void)
+{
+  uint8_t str[ATCMD_MAX_NAME_SIZE + 2U];
+
+  for (uint16_t i = 0U; i < (uint16_t)p_test_modem_ctxt->modem_LUT_size; i++)
+  {
+    const AT_CHAR_t *p_cmd_str = p_test_modem_ctxt->p_modem_LUT[i].cmd_str;
+    uint16_t size = (uint16_t)strlen((const char *)p_cmd_str);
+
+    (void)memcpy(str, p_cmd_str, size);
+    str[size] = (uint8_t)'X';
+    test_lut_search(str, size, "LUT entry");
+    test_lut_search(str, size + 1U, "LUT entry + 1");
+    if (size != 0U)
+    {
+      test_lut_search(str, size - 1U, "LUT entry - 1");
+      str[size - 1U] ^= 0x01U;
+      test_lut_search(str, size, "LUT entry changed");
+    }
+  }
+}
+
+/**
+  * @brief  Search a received line: the whole line and its prefix up to ':'.
+  * @param  p_line - line (null terminated).
+  * @retval bool - true if the line is a final result code.
+  */
+static bool test_lut_line(const char *p_line)
+{
+  const char *p_colon = strchr(p_line, ':');
+
+  test_lut_search((const uint8_t *)p_line, (uint16_t)strlen(p_line), "session line");
+  if (p_colon != NULL)
+  {
+    test_lut_search((const uint8_t *)p_line, (uint16_t)(p_colon - p_line), "session prefix");
+  }
+
+  return (((strcmp(p_line, "OK") == 0) || (strcmp(p_line, "ERROR") == 0) ||
+           (strncmp(p_line, "+CME ERROR", 10U) == 0)) ? true : false);
+}
+
+/**
+  * @brief  Send a command to the simulator and search the received lines, until its final result code.
+  * @param  fd     - host side of the simulator UART.
+  * @param  p_cmd  - command line, without <CR>.
+  * @param  p_line - line being received (kept from one command to the next).
+  * @param  p_len  - size of the line being received.
+  * @retval -
+  */
+static void test_lut_command(int fd, const char *p_cmd, char *p_line, size_t *p_len)
+{
+  struct pollfd pfd = {fd, POLLIN, 0};
+  char buffer[256];
+  ssize_t count;
+  bool final = false;
+
+  (void)write(fd, p_cmd, strlen(p_cmd));
+  (void)write(fd, "\r", 1U);
+
+  while ((final == false) && (poll(&pfd, 1U, TEST_LUT_ANSWER_TIMEOUT) > 0))
+  {
+    count = read(fd, buffer, sizeof(buffer));
+    if (count <= 0)
+    {
+      break;
+    }
+    for (ssize_t i = 0; i < count; i++)
+    {
+      if ((buffer[i] == '\r') || (buffer[i] == '\n'))
+      {
+        if (*p_len != 0U)
+        {
+          p_line[*p_len] = '\0';
+          final = (test_lut_line(p_line) == true) ? true : final;
+          *p_len = 0U;
+        }
+      }
+      else if (*p_len < (TEST_LUT_LINE_SIZE - 1U))
+      {
+        p_line[*p_len] = buffer[i];
+        (*p_len)++;
+      }
+      else
+      {
+        /* line truncated */
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Simulator session: boot, then read and execution commands of every LUT command.
+  * @param  model    - simulator model.
+  * @param  p_script - simulator script.
+  * @retval -
+  */
+static void test_lut_session(modem_sim_model_t model, const char *p_script)
+{
+  static const char *const boot[] = {"AT", "ATE0", "AT+CMEE=2", "AT+CEREG?;+CREG?;+CGREG?"};
+  char line[TEST_LUT_LINE_SIZE];
+  char cmd[ATCMD_MAX_NAME_SIZE + 8U];
+  size_t len = 0U;
+  modem_sim_t *p_sim;
+  int fds[2];
+
+  TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "socketpair");
+  p_sim = modem_sim_create(model, fds[1]);
+  TEST_CHECK(p_sim != NULL, "modem_sim_create");
+  if (p_sim != NULL)
+  {
+    TEST_CHECK(modem_sim_load_script(p_sim, p_script) == 0, "script %s", p_script);
+    TEST_CHECK(modem_sim_start(p_sim) == 0, "modem_sim_start");
+
+    for (uint32_t i = 0U; i < (sizeof(boot) / sizeof(boot[0])); i++)
+    {
+      test_lut_command(fds[0], boot[i], line, &len);
+    }
+
+    for (uint16_t i = 0U; i < (uint16_t)p_test_modem_ctxt->modem_LUT_size; i++)
+    {
+      const char *p_cmd_str = (const char *)p_test_modem_ctxt->p_modem_LUT[i].cmd_str;
+
+      /* extended commands only: basic ones (D, O, Z...) change the modem state */
+      if ((p_cmd_str[0] == '+') || (p_cmd_str[0] == '%'))
+      {
+        (void)snprintf(cmd, sizeof(cmd), "AT%s?", p_cmd_str);
+        test_lut_command(fds[0], cmd, line, &len);
+        (void)snprintf(cmd, sizeof(cmd), "AT%s", p_cmd_str);
+        test_lut_command(fds[0], cmd, line, &len);
+      }
+    }
+  }
+  (void)close(fds[0]);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  uint32_t entries_found;
+
+  /* argv[1]: BG96 simulator script, argv[2]: TYPE1SC simulator script */
+  if (argc < 3)
+  {
+    (void)printf("usage: %s <bg96 script> <type1sc script>\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  TEST_LUT_MODEM_INIT(&test_parser_ctxt);
+  TEST_CHECK(p_test_modem_ctxt != NULL, "LUT index not built by the modem init");
+  if (p_test_modem_ctxt != NULL)
+  {
+    TEST_CHECK(p_test_modem_ctxt->LUT_index.is_valid == AT_TRUE, "LUT not indexed (%u entries)",
+               (uint32_t)p_test_modem_ctxt->modem_LUT_size);
+
+    test_lut_entries();
+    entries_found = test_found;
+    test_lut_session(MODEM_SIM_BG96, argv[1]);
+    test_lut_session(MODEM_SIM_TYPE1SC, argv[2]);
+
+    (void)printf("test_lut_search (%s): %u LUT entries, %u strings found in the LUT (%u from the sessions)\n",
+                 TEST_LUT_MODEM, (uint32_t)p_test_modem_ctxt->modem_LUT_size, test_found,
+                 test_found - entries_found);
+  }
+
+  return (test_result("test_lut_search (" TEST_LUT_MODEM ")"));
+}
@@ -0,0 +1,204 @@
+/**
+  ******************************************************************************
+  * @file    test_ppp_fcs.c
+  * @author  MCD Application Team
+  * @brief   Host test of the PPP FCS module (ppposif_fcs.c) against RFC 1662:
+  *          table of RFC 1662 C.2, CRC-16/X.25 check value, good FCS (0xF0B8)
+  *          over a frame followed by its complemented FCS (tryfcs16), and the
+  *          continuation of a FCS over several blocks.
+  *
+  *          Built with PPPOSIF_FCS_HW_CRC 0U (software) and 1U (CRC unit of
+  *          the host HAL emulation, for the blocks of PPPOSIF_FCS_HW_MIN_SIZE
+  *          bytes or more).
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ppposif_fcs.h"
+#include "test_check.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_FCS_POLYNOMIAL   (0x8408U)  /* RFC 1662 C.2, reversed representation */
+#define TEST_FCS_CHECK        (0x906EU)  /* complemented FCS of "123456789" (CRC-16/X.25) */
+#define TEST_FCS_BUFFER_SIZE  (1502U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t test_buffer[TEST_FCS_BUFFER_SIZE + 2U];
+
+/* LCP Configure-Request (address, control, protocol, code, id, length, MRU 1500, magic number) */
+static const uint8_t test_lcp_frame[] =
+{
+  0xFFU, 0x03U, 0xC0U, 0x21U, 0x01U, 0x01U, 0x00U, 0x0EU, 0x01U, 0x04U, 0x05U, 0xDCU, 0x05U, 0x06U,
+  0x12U, 0x34U, 0x56U, 0x78U
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t test_fcs_bitwise(uint16_t fcs, const uint8_t *p_data, uint32_t size);
+static void test_table(void);
+static void test_check_value(void);
+static void test_good_fcs(const uint8_t *p_frame, uint32_t size);
+static void test_blocks(void);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Reference FCS, bit by bit (RFC 1662 C.2 genfcstab loop).
+  * @param  fcs    - current FCS.
+  * @param  p_data - data.
+  * @param  size   - data size.
+  * @retval uint16_t - updated FCS.
+  */
+static uint16_t test_fcs_bitwise(uint16_t fcs, const uint8_t *p_data, uint32_t size)
+{
+  uint16_t result = fcs;
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    result ^= p_data[i];
+    for (uint8_t bit = 0U; bit < 8U; bit++)
+    {
+      result = ((result & 1U) != 0U) ? (uint16_t)((result >> 1) ^ TEST_FCS_POLYNOMIAL) : (uint16_t)(result >> 1);
+    }
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  The lookup table is the one of RFC 1662 C.2.
+  * @retval -
+  */
+static void test_table(void)
+{
+  for (uint32_t b = 0U; b < 256U; b++)
+  {
+    uint16_t v = (uint16_t)b;
+    for (uint8_t bit = 0U; bit < 8U; bit++)
+    {
+      v = ((v & 1U) != 0U) ? (uint16_t)((v >> 1) ^ TEST_FCS_POLYNOMIAL) : (uint16_t)(v >> 1);
+    }
+    TEST_CHECK(ppposif_fcs_table[b] == v, "table[%u] 0x%04x, expected 0x%04x", b, ppposif_fcs_table[b], v);
+  }
+}
+
+/**
+  * @brief  CRC-16/X.25 check value, byte macro and block function.
+  * @retval -
+  */
+static void test_check_value(void)
+{
+  static const uint8_t check[] = "123456789";
+  uint16_t fcs = PPPOSIF_FCS_INIT;
+  uint16_t fcs_check;
+
+  for (uint32_t i = 0U; i < 9U; i++)
+  {
+    fcs = PPPOSIF_FCS_BYTE(fcs, check[i]);
+  }
+  fcs_check = (uint16_t)(fcs ^ 0xFFFFU);
+  TEST_CHECK(fcs_check == TEST_FCS_CHECK, "byte: 0x%04x", fcs_check);
+
+  fcs = ppposif_fcs_block(PPPOSIF_FCS_INIT, check, 9U);
+  fcs_check = (uint16_t)(fcs ^ 0xFFFFU);
+  TEST_CHECK(fcs_check == TEST_FCS_CHECK, "block: 0x%04x", fcs_check);
+
+  fcs = ppposif_fcs_block(PPPOSIF_FCS_INIT, check, 0U);
+  TEST_CHECK(fcs == PPPOSIF_FCS_INIT, "empty block: 0x%04x", fcs);
+}
+
+/**
+  * @brief  RFC 1662 C.2 tryfcs16: the FCS over the frame followed by its complemented FCS
+  *         (least significant byte first) is the good FCS.
+  * @param  p_frame - frame.
+  * @param  size    - frame size (at most TEST_FCS_BUFFER_SIZE).
+  * @retval -
+  */
+static void test_good_fcs(const uint8_t *p_frame, uint32_t size)
+{
+  uint16_t fcs;
+  uint16_t expected = test_fcs_bitwise(PPPOSIF_FCS_INIT, p_frame, size);
+
+  fcs = ppposif_fcs_block(PPPOSIF_FCS_INIT, p_frame, size);
+  TEST_CHECK(fcs == expected, "size %u: 0x%04x, expected 0x%04x", size, fcs, expected);
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    test_buffer[i] = p_frame[i];
+  }
+  fcs ^= 0xFFFFU;
+  test_buffer[size] = (uint8_t)(fcs & 0xFFU);
+  test_buffer[size + 1U] = (uint8_t)(fcs >> 8);
+
+  fcs = ppposif_fcs_block(PPPOSIF_FCS_INIT, test_buffer, size + 2U);
+  TEST_CHECK(fcs == PPPOSIF_FCS_GOOD, "size %u: good FCS 0x%04x", size, fcs);
+}
+
+/**
+  * @brief  A FCS continued over several blocks (on each side of PPPOSIF_FCS_HW_MIN_SIZE)
+  *         is the FCS of the whole data.
+  * @retval -
+  */
+static void test_blocks(void)
+{
+  static uint8_t data[TEST_FCS_BUFFER_SIZE];
+  static const uint32_t splits[] = {1U, 7U, PPPOSIF_FCS_HW_MIN_SIZE - 1U, PPPOSIF_FCS_HW_MIN_SIZE, 333U, 1024U};
+  uint16_t whole;
+
+  for (uint32_t i = 0U; i < TEST_FCS_BUFFER_SIZE; i++)
+  {
+    data[i] = (uint8_t)(random() & 0xFFU);
+  }
+  whole = test_fcs_bitwise(PPPOSIF_FCS_INIT, data, TEST_FCS_BUFFER_SIZE);
+
+  for (uint32_t s = 0U; s < (sizeof(splits) / sizeof(splits[0])); s++)
+  {
+    uint16_t fcs = PPPOSIF_FCS_INIT;
+    uint32_t pos = 0U;
+    while (pos < TEST_FCS_BUFFER_SIZE)
+    {
+      uint32_t size = ((TEST_FCS_BUFFER_SIZE - pos) < splits[s]) ? (TEST_FCS_BUFFER_SIZE - pos) : splits[s];
+      fcs = ppposif_fcs_block(fcs, &data[pos], size);
+      pos += size;
+    }
+    TEST_CHECK(fcs == whole, "blocks of %u: 0x%04x, expected 0x%04x", splits[s], fcs, whole);
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  static uint8_t frame[TEST_FCS_BUFFER_SIZE];
+
+  ppposif_fcs_init();
+  srandom(1662U);
+
+  test_table();
+  test_check_value();
+  test_good_fcs(test_lcp_frame, (uint32_t)sizeof(test_lcp_frame));
+
+  /* all lengths up to beyond the hardware threshold, odd and even, then a full size frame */
+  for (uint32_t size = 0U; size <= TEST_FCS_BUFFER_SIZE; size = (size < 300U) ? (size + 1U) : (size + 1201U))
+  {
+    for (uint32_t i = 0U; i < size; i++)
+    {
+      frame[i] = (uint8_t)(random() & 0xFFU);
+    }
+    test_good_fcs(frame, size);
+  }
+
+  test_blocks();
+
+  return (test_result((PPPOSIF_FCS_HW_CRC == 1U) ? "test_ppp_fcs (CRC unit)" : "test_ppp_fcs (software)"));
+}
@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os.h
+  * @author  MCD Application Team
+  * @brief   CMSIS-RTOS V1 types and constants for the POSIX host port of rtosal
+  * @note    Only the types and constants referenced by the Cellular middleware
+  *          are provided: the services themselves are implemented directly
+  *          by rtosal_posix.c on top of pthreads.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CMSIS_OS_H
+#define CMSIS_OS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Same API version as the FreeRTOS CMSIS-RTOS V1 wrapper used on the boards */
+#define osCMSIS           0x10002U
+
+#define osWaitForever     0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  osPriorityIdle          = -3,
+  osPriorityLow           = -2,
+  osPriorityBelowNormal   = -1,
+  osPriorityNormal        =  0,
+  osPriorityAboveNormal   = +1,
+  osPriorityHigh          = +2,
+  osPriorityRealtime      = +3,
+  osPriorityError         =  0x84
+} osPriority;
+
+typedef enum
+{
+  osOK                    =  0,
+  osEventSignal           =  0x08,
+  osEventMessage          =  0x10,
+  osEventMail             =  0x20,
+  osEventTimeout          =  0x40,
+  osErrorParameter        =  0x80,
+  osErrorResource         =  0x81,
+  osErrorTimeoutResource  =  0xC1,
+  osErrorISR              =  0x82,
+  osErrorISRRecursive     =  0x83,
+  osErrorPriority         =  0x84,
+  osErrorNoMemory         =  0x85,
+  osErrorValue            =  0x86,
+  osErrorOS               =  0xFF,
+  os_status_reserved      =  0x7FFFFFFF
+} osStatus;
+
+typedef enum
+{
+  osTimerOnce             =  0,
+  osTimerPeriodic         =  1
+} os_timer_type;
+
+typedef void (*os_pthread)(void const *argument);
+typedef void (*os_ptimer)(void const *argument);
+
+/* Control blocks are private to rtosal_posix.c */
+typedef struct os_thread_cb    *osThreadId;
+typedef struct os_timer_cb     *osTimerId;
+typedef struct os_mutex_cb     *osMutexId;
+typedef struct os_semaphore_cb *osSemaphoreId;
+typedef struct os_messageQ_cb  *osMessageQId;
+
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Check if the caller runs in an (emulated) interrupt handler.
+  * @note   Provided by the host board (weak default in rtosal_posix.c: never).
+  *         As the CMSIS RTOS "FromISR" services, the waits of a handler do not block.
+  * @retval int32_t - 1 in an interrupt handler, 0 otherwise.
+  */
+int32_t osPosixInHandlerMode(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMSIS_OS_H */
@@ -33,6 +33,11 @@ extern "C" {
 
 /* Exported constants --------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
+/* EchoClt performance mode */
+typedef uint8_t cellular_app_echoclient_perf_mode_t;
+#define CELLULAR_APP_ECHOCLIENT_PERF_RR_MODE     (cellular_app_echoclient_perf_mode_t)0 /* Request/response */
+#define CELLULAR_APP_ECHOCLIENT_PERF_STREAM_MODE (cellular_app_echoclient_perf_mode_t)1 /* Streaming        */
+
 /* External variables --------------------------------------------------------*/
 /* Exported macros -----------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
@@ -125,6 +130,15 @@ bool cellular_app_echoclient_get_performance_status(void);
   */
 bool cellular_app_echoclient_performance(bool status, uint8_t iter_nb);
 
+/**
+  * @brief  Set EchoClt performance mode and result format
+  * @note   Used by the next performance test
+  * @param  mode - request/response or streaming mode
+  * @param  csv  - false/true - result displayed as a table/as CSV lines
+  * @retval bool - false/true - not done (performance in progress)/done
+  */
+bool cellular_app_echoclient_set_performance_mode(cellular_app_echoclient_perf_mode_t mode, bool csv);
+
 /**
   * @brief  Display EchoClt status
   * @param  -
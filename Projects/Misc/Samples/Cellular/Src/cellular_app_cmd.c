@@ -38,7 +38,7 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* cmd 'cellularapp' [help] */
-/* cmd 'echoclient   [help|perf <n>|stat|stat reset|status]' */
+/* cmd 'echoclient   [help|perf [rr|stream] [<n>] [csv]|stat|stat reset|status]' */
 /* cmd 'echoclient i [on|off|period <n>|protocol <type>|server <name>|size <n>]' */
 /* cmd 'ping         [help|ip1|ip2|ddd.ddd.ddd.ddd|status]' */
 #define CELLULAR_APP_CMD_ARG_MAX_NB                5U  /* Maximum number of arguments in a command line      */
@@ -206,40 +206,66 @@ static bool cellular_app_cmd_echoclient_generic(void)
 #else /* USE_LOW_POWER == 0 */
       /* cmd 'echoclient perf ...': start performance snd/rcv test */
       /* all process must be off before to do a performance test */
-      /* cmd 'echoclient perf' <n> */
-      if (cellular_app_cmd_argc == 1U) /* Is <n> provided ? cmd 'echoclient perf' or cmd 'echoclient perf' <n> */
+      /* cmd 'echoclient perf' [rr|stream] [<n>] [csv] - parameters in any order */
+      bool param_ok = true;         /* false: a parameter is incorrect */
+      bool csv = false;             /* false: result as a table, true: result as CSV lines */
+      uint8_t iter_nb = 0U;         /* 0: programmed iterations */
+      cellular_app_echoclient_perf_mode_t mode = CELLULAR_APP_ECHOCLIENT_PERF_RR_MODE;
+
+      for (uint8_t i = 1U; (i < cellular_app_cmd_argc) && (param_ok == true); i++)
       {
-        /* No <n> provided : request performance snd/rcv test with the programmed iterations */
-        if (cellular_app_performance_start(CELLULAR_APP_TYPE_ECHOCLIENT, 0U) == false)
+        len = crs_strlen(p_cellular_app_cmd_argv[i]);
+        if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[i], "rr", len) == 0)
         {
-          __NOP();
-          /* cellular_app_performance_start() already display an error according linked to the error */
+          mode = CELLULAR_APP_ECHOCLIENT_PERF_RR_MODE;
         }
-      }
-      else
-      {
-        int32_t  atoi_res;  /* result of crs_atoi() */
-
-        /* cmd 'echoclient perf <n>': start performance snd/rcv test with <n> iterations */
-        /* Check <n> parameter */
-        atoi_res = crs_atoi(p_cellular_app_cmd_argv[1]);
-        if ((atoi_res > 0) /* conversion is ok */
-            && (atoi_res >= ((int32_t)(ECHOCLIENT_PERF_MIN_ITER)))
-            && (atoi_res <= ((int32_t)(ECHOCLIENT_PERF_MAX_ITER))))
+        else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[i], "stream", len) == 0)
         {
-          /* <n> provided : request performance snd/rcv test with <n> iterations */
-          if (cellular_app_performance_start(CELLULAR_APP_TYPE_ECHOCLIENT, (uint8_t)atoi_res) == false)
+          mode = CELLULAR_APP_ECHOCLIENT_PERF_STREAM_MODE;
+        }
+        else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[i], "csv", len) == 0)
+        {
+          csv = true;
+        }
+        else
+        {
+          int32_t  atoi_res;  /* result of crs_atoi() */
+
+          /* cmd 'echoclient perf <n>': start performance snd/rcv test with <n> iterations */
+          /* Check <n> parameter */
+          atoi_res = crs_atoi(p_cellular_app_cmd_argv[i]);
+          if ((atoi_res > 0) /* conversion is ok */
+              && (atoi_res >= ((int32_t)(ECHOCLIENT_PERF_MIN_ITER)))
+              && (atoi_res <= ((int32_t)(ECHOCLIENT_PERF_MAX_ITER))))
+          {
+            iter_nb = (uint8_t)atoi_res;
+          }
+          else
           {
-            __NOP();
-            /* cellular_app_performance_start() already display an error according linked to the error */
+            /* <n> parameter is incorrect */
+            /* Display a reminder about iter [min,max] */
+            PRINT_FORCE("%s: Parameter iter must be [%d,%d] !", trace_label,
+                        ECHOCLIENT_PERF_MIN_ITER, ECHOCLIENT_PERF_MAX_ITER)
+            param_ok = false;
           }
         }
+      }
+
+      if (param_ok == true)
+      {
+        if (cellular_app_echoclient_set_performance_mode(mode, csv) == false)
+        {
+          PRINT_FORCE("%s: Performance already requested!", trace_label)
+        }
+        /* <n> provided or not : request performance snd/rcv test with <n> or the programmed iterations */
+        else if (cellular_app_performance_start(CELLULAR_APP_TYPE_ECHOCLIENT, iter_nb) == false)
+        {
+          __NOP();
+          /* cellular_app_performance_start() already display an error according linked to the error */
+        }
         else
         {
-          /* <n> parameter is incorrect */
-          /* Display a reminder about iter [min,max] */
-          PRINT_FORCE("%s: Parameter iter must be [%d,%d] !", trace_label,
-                      ECHOCLIENT_PERF_MIN_ITER, ECHOCLIENT_PERF_MAX_ITER)
+          __NOP();
         }
       }
 #endif /* USE_LOW_POWER == 1 */
@@ -872,6 +898,11 @@ static void cellular_app_cmd_echoclient_help(void)
   PRINT_FORCE("                        Server Name, IP and Port, Protocol, Period, Size value and state")
   PRINT_FORCE("echoclient perf       : using echoclient 1, start performance snd/rcv test with default iterations nb")
   PRINT_FORCE("echoclient perf <n>   : using echoclient 1, start performance snd/rcv test with only n iterations")
+  PRINT_FORCE("echoclient perf [rr|stream] [<n>] [csv] : performance test options:")
+  PRINT_FORCE("                        rr: request/response (default) - stream: several trames in flight (TCP only)")
+  PRINT_FORCE("                        csv: display the result (goodput, latency min/p50/p95/p99) as CSV lines")
+  PRINT_FORCE("                        use 'echoclient 1 server %s' to measure against a local echo server",
+              cellular_app_distant_string[CELLULAR_APP_DISTANT_LOCAL_TYPE])
   PRINT_FORCE("echoclient stat       : display statistic of all echoclients")
   PRINT_FORCE("echoclient stat reset : reset statistic of all echoclients")
 }
@@ -46,6 +46,10 @@ typedef struct
 {
   uint16_t iter_ok;
   uint32_t total_time;
+  uint16_t latency_min; /* latency of an echo (in ms) */
+  uint16_t latency_p50;
+  uint16_t latency_p95;
+  uint16_t latency_p99;
 } echoclient_performance_result_t; /* ToDo: only used for EchoClt */
 
 /* Private defines -----------------------------------------------------------*/
@@ -63,6 +67,10 @@ typedef struct
 #define ECHOCLIENT_NFM_ERROR_LIMIT_NB_MAX      (uint8_t)(5)      /* Maximum number of consecutive errors
                                                                     before to start NFM feature */
 
+#define ECHOCLIENT_PERF_SAMPLE_NB              (uint16_t)(1000)  /* Latency samples kept per trame size     */
+#define ECHOCLIENT_PERF_STREAM_INFLIGHT_NB     (uint16_t)(4)     /* Trames sent and not yet echoed
+                                                                    in streaming performance mode          */
+
 #if (USE_RTC == 1)
 /* Important : check echoclient_obtain_datetime() for re-ordering Date Time parameter */
 /* Re-ordering date-time is supported with mbedcloudtesting server */
@@ -94,6 +102,12 @@ static osMutexId cellular_app_echoclient_index_mutex_handle;
 /* Current status of EchoClt performance */
 static bool cellular_app_echoclient_perf_start; /* false: inactive, true: active */
 static uint16_t cellular_app_echoclient_perf_iter_nb;
+static cellular_app_echoclient_perf_mode_t cellular_app_echoclient_perf_mode;
+static bool cellular_app_echoclient_perf_csv; /* false: result displayed as a table, true: as CSV lines */
+
+/* Latency samples (in ms) of the current performance trame size */
+static uint16_t echoclient_perf_sample[ECHOCLIENT_PERF_SAMPLE_NB];
+static uint16_t echoclient_perf_sample_nb;
 
 #if (USE_RTC == 1)
 /* Set or not Date/Time => a specific request will be send to the EchoClt distant server */
@@ -119,10 +133,18 @@ static uint16_t echoclient_format_buffer(uint16_t length, uint8_t *p_buffer);
 /* Process a EchoClt request */
 static bool echoclient_process(uint8_t index, cellular_app_socket_desc_t *const p_socket, uint32_t *p_snd_rcv_time,
                                cellular_app_socket_change_t *p_change);
+/* Save a EchoClt performance latency sample */
+static void echoclient_performance_add_sample(uint32_t time_snd_rcv);
+/* Compute EchoClt performance latency percentiles */
+static void echoclient_performance_latency(echoclient_performance_result_t *p_perf_result);
 /* Process a EchoClt performance test iteration loop */
 static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p_socket,
                                              uint16_t iteration_nb, uint16_t trame_size,
                                              echoclient_performance_result_t *p_perf_result);
+/* Process a EchoClt performance test streaming loop */
+static void echoclient_performance_stream(cellular_app_socket_desc_t *const p_socket,
+                                          uint16_t iteration_nb, uint16_t trame_size,
+                                          echoclient_performance_result_t *p_perf_result);
 /* Process a EchoClt performance test */
 static void echoclient_performance(cellular_app_socket_desc_t *const p_socket);
 /* Check if EchoClt is blocked or not(e.g data not ready, performance in progress, process status inactive) */
@@ -664,8 +686,56 @@ static bool echoclient_process(uint8_t index, cellular_app_socket_desc_t *p_sock
   return (result);
 }
 
+/**
+  * @brief  Save a EchoClt performance latency sample
+  * @note   Samples after the ECHOCLIENT_PERF_SAMPLE_NB first ones are ignored
+  * @param  time_snd_rcv - time between the send of a trame and the reception of its echo (in ms)
+  * @retval -
+  */
+static void echoclient_performance_add_sample(uint32_t time_snd_rcv)
+{
+  if (echoclient_perf_sample_nb < ECHOCLIENT_PERF_SAMPLE_NB)
+  {
+    echoclient_perf_sample[echoclient_perf_sample_nb] = (uint16_t)CELLULAR_APP_MIN(time_snd_rcv, 0xFFFFU);
+    echoclient_perf_sample_nb++;
+  }
+}
+
+/**
+  * @brief  Compute EchoClt performance latency percentiles
+  * @note   Samples are sorted and nearest-rank percentiles are taken
+  * @param  p_perf_result - pointer on performance result to update
+  * @retval -
+  */
+static void echoclient_performance_latency(echoclient_performance_result_t *p_perf_result)
+{
+  uint16_t sample;
+  uint16_t j;
+
+  if (echoclient_perf_sample_nb > 0U)
+  {
+    /* Insertion sort: samples are few and stored in a static array */
+    for (uint16_t i = 1U; i < echoclient_perf_sample_nb; i++)
+    {
+      sample = echoclient_perf_sample[i];
+      j = i;
+      while ((j > 0U) && (echoclient_perf_sample[j - 1U] > sample))
+      {
+        echoclient_perf_sample[j] = echoclient_perf_sample[j - 1U];
+        j--;
+      }
+      echoclient_perf_sample[j] = sample;
+    }
+    p_perf_result->latency_min = echoclient_perf_sample[0];
+    p_perf_result->latency_p50 = echoclient_perf_sample[((echoclient_perf_sample_nb * 50U) + 99U) / 100U - 1U];
+    p_perf_result->latency_p95 = echoclient_perf_sample[((echoclient_perf_sample_nb * 95U) + 99U) / 100U - 1U];
+    p_perf_result->latency_p99 = echoclient_perf_sample[((echoclient_perf_sample_nb * 99U) + 99U) / 100U - 1U];
+  }
+}
+
 /**
   * @brief  Process a EchoClt performance test iteration loop (same snd buffer len)
+  * @note   Request/response mode: next trame is sent when the echo of the previous one is received
   * @param  p_socket      - pointer on the socket to use
   * @param  iteration_nb  - iteration number to do
   * @param  trame_size    - trame size to send
@@ -692,6 +762,7 @@ static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p
         /* Process ok, update iter ok and total time of transaction */
         p_perf_result->iter_ok++;
         p_perf_result->total_time += time_snd_rcv;
+        echoclient_performance_add_sample(time_snd_rcv);
       }
       else /* Process nok */
       {
@@ -705,6 +776,111 @@ static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p
   }
 }
 
+/**
+  * @brief  Process a EchoClt performance test streaming loop (same snd buffer len)
+  * @note   Streaming mode: up to ECHOCLIENT_PERF_STREAM_INFLIGHT_NB trames are sent before their echo is received
+  *         A first request/response exchange opens the socket; only TCP protocol is supported
+  * @param  p_socket      - pointer on the socket to use
+  * @param  iteration_nb  - number of trames to send
+  * @param  trame_size    - trame size to send
+  * @param  p_perf_result - pointer on performance result
+  * @retval -
+  */
+static void echoclient_performance_stream(cellular_app_socket_desc_t *const p_socket,
+                                          uint16_t iteration_nb, uint16_t trame_size,
+                                          echoclient_performance_result_t *p_perf_result)
+{
+  bool exit = false;          /* false: continue the treatment, true: stop the treatment */
+  uint16_t snd_nb = 0U;       /* number of trames sent */
+  uint16_t rcv_nb = 0U;       /* number of trames echoed */
+  uint16_t rcv_len = 0U;      /* number of bytes received for the current echoed trame */
+  uint32_t time_begin;        /* tick when the streaming starts */
+  uint32_t time_snd[ECHOCLIENT_PERF_STREAM_INFLIGHT_NB]; /* tick when each trame in flight is sent */
+  int32_t ret;
+
+  /* Update buffer with new data and potentially new length */
+  p_socket->snd_buffer_len = echoclient_format_buffer(trame_size, p_socket->p_snd_buffer);
+  if (p_socket->protocol != CELLULAR_APP_SOCKET_TCP_PROTO)
+  {
+    PRINT_FORCE("%s 1: Streaming performance only supported with protocol %s!", p_cellular_app_echoclient_trace,
+                cellular_app_protocol_string[CELLULAR_APP_SOCKET_TCP_PROTO])
+  }
+  /* A request/response exchange to obtain a connected socket */
+  else if ((p_socket->snd_buffer_len != 0U) && (echoclient_process(1U, p_socket, NULL, NULL) == true)
+           && (p_socket->state == CELLULAR_APP_SOCKET_CONNECTED))
+  {
+    time_begin = HAL_GetTick();
+    while ((rcv_nb < iteration_nb) && (exit == false))
+    {
+      if ((snd_nb < iteration_nb) && ((snd_nb - rcv_nb) < ECHOCLIENT_PERF_STREAM_INFLIGHT_NB))
+      {
+        /* Keep the pipe full */
+        time_snd[snd_nb % ECHOCLIENT_PERF_STREAM_INFLIGHT_NB] = HAL_GetTick();
+        ret = com_send(p_socket->id, (const com_char_t *)p_socket->p_snd_buffer, (int32_t)p_socket->snd_buffer_len,
+                       COM_MSG_WAIT);
+        if (ret == (int32_t)p_socket->snd_buffer_len)
+        {
+          p_socket->stat.send.ok++;
+          snd_nb++;
+        }
+        else
+        {
+          p_socket->stat.send.ko++;
+          PRINT_FORCE("%s 1: SND NOK! error:%ld data:%d!", p_cellular_app_echoclient_trace, ret,
+                      p_socket->snd_buffer_len)
+          exit = true;
+        }
+      }
+      else
+      {
+        /* Receive at most the end of the oldest trame in flight to check each echo */
+        ret = com_recv(p_socket->id, &(p_socket->p_rcv_buffer[rcv_len]),
+                       ((int32_t)p_socket->snd_buffer_len - (int32_t)rcv_len), COM_MSG_WAIT);
+        if (ret > 0)
+        {
+          rcv_len += (uint16_t)ret;
+          if (rcv_len == p_socket->snd_buffer_len)
+          {
+            if (memcmp((const void *)p_socket->p_snd_buffer, (const void *)p_socket->p_rcv_buffer,
+                       (size_t)p_socket->snd_buffer_len) == 0)
+            {
+              p_socket->stat.receive.ok++;
+              p_perf_result->iter_ok++;
+              echoclient_performance_add_sample(HAL_GetTick() - time_snd[rcv_nb % ECHOCLIENT_PERF_STREAM_INFLIGHT_NB]);
+            }
+            else
+            {
+              p_socket->stat.receive.ko++;
+              PRINT_FORCE("%s 1: RSP received NOK! memcmp error!", p_cellular_app_echoclient_trace)
+              exit = true;
+            }
+            rcv_nb++;
+            rcv_len = 0U;
+          }
+        }
+        else
+        {
+          p_socket->stat.receive.ko++;
+          PRINT_FORCE("%s 1: RSP received NOK! error:%ld data:%d/%d!", p_cellular_app_echoclient_trace, ret,
+                      rcv_len, p_socket->snd_buffer_len)
+          exit = true;
+        }
+      }
+    }
+    p_perf_result->total_time = HAL_GetTick() - time_begin;
+
+    if (exit == true)
+    {
+      /* Trames still in flight: the socket can not be reused */
+      cellular_app_socket_close(CELLULAR_APP_TYPE_ECHOCLIENT, 1U, p_socket);
+    }
+  }
+  else
+  {
+    __NOP(); /* First exchange NOK: error already displayed */
+  }
+}
+
 /**
   * @brief  Process a EchoClt performance test
   * @param  p_socket - pointer on the socket to use
@@ -734,6 +910,11 @@ static void echoclient_performance(cellular_app_socket_desc_t *const p_socket)
   /* Performance result table for each iteration */
   static echoclient_performance_result_t perf_result[ECHOCLIENT_PERFORMANCE_NB_ITER];
   uint16_t *p_trame_size; /* according to the protocol, point on trame_size_in_TCP or on trame_size_in_UDP */
+  uint16_t iter_nb;       /* iteration number of a trame size */
+  const uint8_t *p_mode;  /* performance mode used for the display */
+
+  p_mode = (cellular_app_echoclient_perf_mode == CELLULAR_APP_ECHOCLIENT_PERF_STREAM_MODE) ?
+           (const uint8_t *)"stream" : (const uint8_t *)"rr";
 
   /* Update p_trame_size according to the socket protocol */
   if (p_socket->protocol == CELLULAR_APP_SOCKET_TCP_PROTO)
@@ -746,26 +927,22 @@ static void echoclient_performance(cellular_app_socket_desc_t *const p_socket)
   }
 
   /* perf_result initialization */
-  for (uint8_t i = 0U; i < ECHOCLIENT_PERFORMANCE_NB_ITER; i++)
-  {
-    perf_result[i].iter_ok    = 0U;
-    perf_result[i].total_time = 0U;
-  }
+  (void)memset((void *)&perf_result[0], 0, sizeof(perf_result));
   /* Performance execution for each iteration */
   for (uint8_t i = 0U; i < ECHOCLIENT_PERFORMANCE_NB_ITER; i++)
   {
     /* Use default iteration number: iter[] or a specific iteration number has been defined ? */
-    if (cellular_app_echoclient_perf_iter_nb == 0U)
+    iter_nb = (cellular_app_echoclient_perf_iter_nb == 0U) ? iter[i] : cellular_app_echoclient_perf_iter_nb;
+    echoclient_perf_sample_nb = 0U;
+    if (cellular_app_echoclient_perf_mode == CELLULAR_APP_ECHOCLIENT_PERF_STREAM_MODE)
     {
-      /* Use default iteration number: iter[] */
-      echoclient_performance_iteration(p_socket, iter[i], p_trame_size[i], &perf_result[i]);
+      echoclient_performance_stream(p_socket, iter_nb, p_trame_size[i], &perf_result[i]);
     }
     else
     {
-      /* Use a specific iteration number */
-      echoclient_performance_iteration(p_socket, cellular_app_echoclient_perf_iter_nb, p_trame_size[i],
-                                       &perf_result[i]);
+      echoclient_performance_iteration(p_socket, iter_nb, p_trame_size[i], &perf_result[i]);
     }
+    echoclient_performance_latency(&perf_result[i]);
   }
   /* Close the performance test socket */
   cellular_app_socket_close(CELLULAR_APP_TYPE_ECHOCLIENT, 1U, p_socket);
@@ -774,45 +951,56 @@ static void echoclient_performance(cellular_app_socket_desc_t *const p_socket)
   if (CELLULAR_APP_GET_DISTANTIP(p_socket->distant.ip) != 0U)
   {
     /* Distant Server IP known */
-    PRINT_FORCE("%s 1: Distant:%s Name:%s IP:%d.%d.%d.%d Port:%d Protocol:%s", p_cellular_app_echoclient_trace,
+    PRINT_FORCE("%s 1: Distant:%s Name:%s IP:%d.%d.%d.%d Port:%d Protocol:%s Mode:%s",
+                p_cellular_app_echoclient_trace,
                 cellular_app_distant_string[p_socket->distant.type], p_socket->distant.p_name,
                 COM_IP4_ADDR1(&(p_socket->distant.ip)), COM_IP4_ADDR2(&(p_socket->distant.ip)),
                 COM_IP4_ADDR3(&(p_socket->distant.ip)), COM_IP4_ADDR4(&(p_socket->distant.ip)),
-                p_socket->distant.port, cellular_app_protocol_string[p_socket->protocol])
+                p_socket->distant.port, cellular_app_protocol_string[p_socket->protocol], p_mode)
   }
   else
   {
     /* Distant Server IP unknown */
-    PRINT_FORCE("%s: Distant:%s Name:%s IP:Unknown Port:%d Protocol:%s", p_cellular_app_echoclient_trace,
+    PRINT_FORCE("%s: Distant:%s Name:%s IP:Unknown Port:%d Protocol:%s Mode:%s", p_cellular_app_echoclient_trace,
                 cellular_app_distant_string[p_socket->distant.type], p_socket->distant.p_name,
-                p_socket->distant.port, cellular_app_protocol_string[p_socket->protocol])
+                p_socket->distant.port, cellular_app_protocol_string[p_socket->protocol], p_mode)
   }
 
-  PRINT_FORCE("%s: Size  IterMax  IterOK   Data(B)   Time(ms) Throughput(Byte/s)", p_cellular_app_echoclient_trace)
+  if (cellular_app_echoclient_perf_csv == true)
+  {
+    PRINT_FORCE("csv,mode,protocol,size,iter,iter_ok,data_B,time_ms,goodput_kbps,lat_min_ms,lat_p50_ms,lat_p95_ms,"
+                "lat_p99_ms")
+  }
+  else
+  {
+    PRINT_FORCE("%s: Size  IterMax  IterOK   Data(B)   Time(ms) Goodput(kbit/s)  Latency(ms) min  p50  p95  p99",
+                p_cellular_app_echoclient_trace)
+  }
 
   for (uint8_t i = 0U; i < ECHOCLIENT_PERFORMANCE_NB_ITER; i++)
   {
-    /* Calculate the number of bytes correctly send and received */
-    uint32_t data_snd_rcv = (uint32_t)(p_trame_size[i]) * 2U * (uint32_t)(perf_result[i].iter_ok);
-    /* Number of iteration done for each loop ? */
-    if (cellular_app_echoclient_perf_iter_nb == 0U)
+    /* Calculate the number of bytes correctly echoed: goodput counts the application data in one direction */
+    uint32_t data_snd_rcv = (uint32_t)(p_trame_size[i]) * (uint32_t)(perf_result[i].iter_ok);
+    uint32_t goodput = (perf_result[i].total_time != 0U) ? ((data_snd_rcv * 8U) / perf_result[i].total_time) : 0U;
+
+    iter_nb = (cellular_app_echoclient_perf_iter_nb == 0U) ? iter[i] : cellular_app_echoclient_perf_iter_nb;
+    if (cellular_app_echoclient_perf_csv == true)
     {
-      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld", p_cellular_app_echoclient_trace,
-                  p_trame_size[i], iter[i], perf_result[i].iter_ok, data_snd_rcv, perf_result[i].total_time,
-                  ((data_snd_rcv * 1000U) / (perf_result[i].total_time)))
-      /* Update trace valid data */
-      iter_total += iter[i];
-      iter_ok    += perf_result[i].iter_ok;
+      PRINT_FORCE("csv,%s,%s,%d,%d,%d,%ld,%ld,%ld,%d,%d,%d,%d", p_mode,
+                  cellular_app_protocol_string[p_socket->protocol], p_trame_size[i], iter_nb, perf_result[i].iter_ok,
+                  data_snd_rcv, perf_result[i].total_time, goodput, perf_result[i].latency_min,
+                  perf_result[i].latency_p50, perf_result[i].latency_p95, perf_result[i].latency_p99)
     }
     else
     {
-      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld", p_cellular_app_echoclient_trace,
-                  p_trame_size[i], cellular_app_echoclient_perf_iter_nb, perf_result[i].iter_ok, data_snd_rcv,
-                  perf_result[i].total_time, ((data_snd_rcv * 1000U) / (perf_result[i].total_time)))
-      /* Update trace valid data */
-      iter_total += cellular_app_echoclient_perf_iter_nb;
-      iter_ok    += perf_result[i].iter_ok;
+      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld            %5d%5d%5d%5d", p_cellular_app_echoclient_trace,
+                  p_trame_size[i], iter_nb, perf_result[i].iter_ok, data_snd_rcv, perf_result[i].total_time, goodput,
+                  perf_result[i].latency_min, perf_result[i].latency_p50, perf_result[i].latency_p95,
+                  perf_result[i].latency_p99)
     }
+    /* Update trace valid data */
+    iter_total += iter_nb;
+    iter_ok    += perf_result[i].iter_ok;
   }
   TRACE_VALID("@valid@:echoclient:stat:%d/%d\n\r", iter_ok, iter_total)
 }
@@ -1374,6 +1562,27 @@ bool cellular_app_echoclient_performance(bool status, uint8_t iter_nb)
   return (result);
 }
 
+/**
+  * @brief  Set EchoClt performance mode and result format
+  * @note   Used by the next performance test
+  * @param  mode - request/response or streaming mode
+  * @param  csv  - false/true - result displayed as a table/as CSV lines
+  * @retval bool - false/true - not done (performance in progress)/done
+  */
+bool cellular_app_echoclient_set_performance_mode(cellular_app_echoclient_perf_mode_t mode, bool csv)
+{
+  bool result = false;
+
+  if (cellular_app_echoclient_perf_start == false)
+  {
+    cellular_app_echoclient_perf_mode = mode;
+    cellular_app_echoclient_perf_csv = csv;
+    result = true;
+  }
+
+  return (result);
+}
+
 /**
   * @brief  Display EchoClt status
   * @param  -
@@ -1465,6 +1674,10 @@ void cellular_app_echoclient_init(void)
   /* EchoClt Index Initialization */
   cellular_app_echoclient_index = 0U;
 
+  /* EchoClt Performance Initialization */
+  cellular_app_echoclient_perf_mode = CELLULAR_APP_ECHOCLIENT_PERF_RR_MODE;
+  cellular_app_echoclient_perf_csv = false;
+
   /* Initialize trace shortcut */
   p_cellular_app_echoclient_trace = cellular_app_type_string[CELLULAR_APP_TYPE_ECHOCLIENT];
 